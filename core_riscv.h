@@ -8,11 +8,16 @@
  * @date  08.08.2020
  * @date  20.03.2023  Rewrite
  * @date  21.03.2023  Added remaining CSR access functions
+ * @date  16.10.2026  Added host simulation build mode (USE_HOST_SIM)
  ******************************************************************************/
 
 #ifndef CORE_RISCV_H_
 #define CORE_RISCV_H_
 
+#ifdef USE_HOST_SIM
+#include "core_riscv_sim.h"
+#endif /* USE_HOST_SIM */
+
 /* ############################### Common ################################### */
 /* Core version identifier: V2A                                               */
 #define __RISC_V                      0x201U
@@ -27,13 +32,35 @@
 #define RV_STATIC_INLINE              static inline
 #define RV_STATIC_FORCE_INLINE        RV_STATIC_INLINE __attribute__((always_inline))
 
+/* Hint attribute for overridable default implementations                     */
+#define RV_WEAK                       __attribute__((weak))
+
+/* Section attribute for variables not cleared at startup (USE_NOINIT_RETAIN) */
+#define RV_NOINIT                     __attribute__((section(".noinit")))
+
+/* Section attribute for code executed from SRAM (USE_RAMFUNC startup option) */
+#define RV_RAMFUNC                    __attribute__((section(".ramfunc"), noinline))
+
+/* Register access primitives, redirected to the simulator in host builds     */
+#ifndef USE_HOST_SIM
+#define RV_REG_READ(reg)              (reg)
+#define RV_REG_WRITE(reg, val)        ((reg) = (val))
+#endif /* USE_HOST_SIM */
+
 /* Hint attributes for Hardware Prologue/Epilogue usage                       */
+#define RV_INTERRUPT_MODE_STANDARD    0U
+#define RV_INTERRUPT_MODE_FAST        1U
+#define RV_INTERRUPT_MODE_NAKED       2U
+
 #ifdef USE_WCH_INTERRUPT_FAST_ATTR
 #define RV_INTERRUPT __attribute__((interrupt("WCH-Interrupt-fast")))
+#define RV_INTERRUPT_MODE             RV_INTERRUPT_MODE_FAST
 #elif defined(USE_INTERRUPT_NAKED_ATTR)
 #define RV_INTERRUPT __attribute__((naked))
+#define RV_INTERRUPT_MODE             RV_INTERRUPT_MODE_NAKED
 #else
 #define RV_INTERRUPT __attribute__((interrupt))
+#define RV_INTERRUPT_MODE             RV_INTERRUPT_MODE_STANDARD
 #endif /* USE_WCH_INTERRUPT_FAST_ATTR || USE_INTERRUPT_NAKED_ATTR */
 
 /* Legacy support integer type definitions                                    */
@@ -74,6 +101,9 @@ typedef enum {ERROR = 0, SUCCESS = !ERROR} ErrorStatus;
 typedef enum {DISABLE = 0, ENABLE = !DISABLE} FunctionalState;
 typedef enum {RESET = 0, SET = !RESET} FlagStatus, ITStatus;
 
+/* mcycle at main() entry, recorded by the startup code (USE_STARTUP_CYCLES)  */
+extern uint32_t _startup_cycles;
+
 
 /* Core Peripheral Base Address definitions                                   */
 #define PFIC_BASE                     0xE000E000UL
@@ -109,7 +139,11 @@ typedef struct{
 } PFIC_Type;
 
 /* PFIC peripheral access macro                                               */
+#ifndef USE_HOST_SIM
 #define PFIC                          ((PFIC_Type*)PFIC_BASE)
+#else
+#define PFIC                          ((PFIC_Type*)RVSim_PFICMem)
+#endif /* USE_HOST_SIM */
 
 /* Bit definitions for PFIC Configuration Register (CFGR)                     */
 #define PFIC_CFGR_RESETSYS            0x00000080UL
@@ -117,6 +151,11 @@ typedef struct{
 #define PFIC_CFGR_KEYCODE_KEY2        0xBCAF0000UL
 #define PFIC_CFGR_KEYCODE_KEY3        0xBEEF0000UL
 
+/* Bit definitions for PFIC Global Interrupt Status Register (GISR)           */
+#define PFIC_GISR_NESTSTA             0x000000FFUL
+#define PFIC_GISR_GACTSTA             0x00000100UL
+#define PFIC_GISR_GPENDSTA            0x00000200UL
+
 /* Bit definitions for PFIC System Control Register (SCTLR)                   */
 #define PFIC_SCTLR_SLEEPONEXIT        0x00000002UL
 #define PFIC_SCTLR_SLEEPDEEP          0x00000004UL
@@ -134,6 +173,23 @@ typedef struct{
 
 /* Bit definitions for PFIC Interrupt Priority Conf. Register (IPRIOR)        */
 #define PFIC_IPRIOR_PRIO              0x000000FFUL
+#define PFIC_IPRIOR_PRIO_IMPL         0x000000C0UL
+#define PFIC_IPRIOR_WORD_IMPL         0xC0C0C0C0UL
+
+/* ITHRESDR value masking priorities >= p: p rounded up to the implemented    */
+/* bits, 0 (no masking) if no implemented priority is >= p                    */
+#define PFIC_THRESHOLD(p) \
+  ((uint8_t)(((uint32_t)(p) + (~PFIC_IPRIOR_PRIO_IMPL & 0xFFUL)) & PFIC_IPRIOR_PRIO_IMPL))
+
+/* IPRIOR word index from IRQn                                                */
+#define PFIC_IPRIOR_IDX(IRQn)         ((uint32_t)(IRQn) >> 2)
+
+/* Packed IPRIOR word for IRQn = 4 * idx + 0..3 (compile-time constant)       */
+#define PFIC_IPRIOR_WORD(p0, p1, p2, p3) \
+  ( ((uint32_t)(p0) & PFIC_IPRIOR_PRIO_IMPL)        | \
+   (((uint32_t)(p1) & PFIC_IPRIOR_PRIO_IMPL) <<  8) | \
+   (((uint32_t)(p2) & PFIC_IPRIOR_PRIO_IMPL) << 16) | \
+   (((uint32_t)(p3) & PFIC_IPRIOR_PRIO_IMPL) << 24))
 
 /* Interrupt number from IRQn                                                 */
 #define PFIC_IRQn_NUM(IRQn)           ((uint32_t)(IRQn) & 0x1FUL)
@@ -141,6 +197,23 @@ typedef struct{
 /* Interrupt register offset from IRQn                                        */
 #define PFIC_IRQn_REG(IRQn)           ((uint32_t)(IRQn) >> 5)
 
+/* Interrupt bit mask within its register bank from IRQn                      */
+#define PFIC_IRQn_MASK(IRQn)          (1UL << PFIC_IRQn_NUM(IRQn))
+
+/* Interrupt bit mask from IRQn, if it belongs to register bank "reg"         */
+#define PFIC_IRQn_BANK_MASK(reg, IRQn) \
+  ((PFIC_IRQn_REG(IRQn) == (uint32_t)(reg)) ? PFIC_IRQn_MASK(IRQn) : 0UL)
+
+/* Number of 32-bit register banks covered by a PFIC_IRQSet_t                 */
+#ifndef PFIC_IRQSET_BANKS
+#define PFIC_IRQSET_BANKS             2U
+#endif /* PFIC_IRQSET_BANKS */
+
+/* Interrupt set: one bit mask per 32-bit register bank                       */
+typedef struct {
+  uint32_t ulMask[PFIC_IRQSET_BANKS];
+} PFIC_IRQSet_t;
+
 /* Interrupt System Control Register (INTSYSCR)                               */
 #define PFIC_INTSYSCR_HWSTKEN         0x00000001UL
 #define PFIC_INTSYSCR_INESTEN         0x00000002UL
@@ -155,7 +228,7 @@ typedef struct{
  ******************************************************************************/
 RV_STATIC_INLINE void PFIC_EnableIRQ(IRQn_Type IRQn)
 {
-  PFIC->IENR[PFIC_IRQn_REG(IRQn)] = 1UL << PFIC_IRQn_NUM(IRQn);
+  RV_REG_WRITE(PFIC->IENR[PFIC_IRQn_REG(IRQn)], 1UL << PFIC_IRQn_NUM(IRQn));
 }
 
 /*!****************************************************************************
@@ -167,7 +240,7 @@ RV_STATIC_INLINE void PFIC_EnableIRQ(IRQn_Type IRQn)
  ******************************************************************************/
 RV_STATIC_INLINE void PFIC_DisableIRQ(IRQn_Type IRQn)
 {
-  PFIC->IRER[PFIC_IRQn_REG(IRQn)] = 1UL << PFIC_IRQn_NUM(IRQn);
+  RV_REG_WRITE(PFIC->IRER[PFIC_IRQn_REG(IRQn)], 1UL << PFIC_IRQn_NUM(IRQn));
 }
 
 /*!****************************************************************************
@@ -182,7 +255,7 @@ RV_STATIC_INLINE void PFIC_DisableIRQ(IRQn_Type IRQn)
  ******************************************************************************/
 RV_STATIC_INLINE uint32_t PFIC_GetStatusIRQ(IRQn_Type IRQn)
 {
-  return (PFIC->ISR[PFIC_IRQn_REG(IRQn)] & (1UL << PFIC_IRQn_NUM(IRQn))) ? 1UL : 0UL;
+  return (RV_REG_READ(PFIC->ISR[PFIC_IRQn_REG(IRQn)]) & (1UL << PFIC_IRQn_NUM(IRQn))) ? 1UL : 0UL;
 }
 
 /*!****************************************************************************
@@ -197,7 +270,7 @@ RV_STATIC_INLINE uint32_t PFIC_GetStatusIRQ(IRQn_Type IRQn)
  ******************************************************************************/
 RV_STATIC_INLINE uint32_t PFIC_GetPendingIRQ(IRQn_Type IRQn)
 {
-  return (PFIC->IPR[PFIC_IRQn_REG(IRQn)] & (1UL << PFIC_IRQn_NUM(IRQn))) ? 1UL : 0UL;
+  return (RV_REG_READ(PFIC->IPR[PFIC_IRQn_REG(IRQn)]) & (1UL << PFIC_IRQn_NUM(IRQn))) ? 1UL : 0UL;
 }
 
 /*!****************************************************************************
@@ -210,7 +283,7 @@ RV_STATIC_INLINE uint32_t PFIC_GetPendingIRQ(IRQn_Type IRQn)
  ******************************************************************************/
 RV_STATIC_INLINE void PFIC_SetPendingIRQ(IRQn_Type IRQn)
 {
-  PFIC->IPSR[PFIC_IRQn_REG(IRQn)] = 1UL << PFIC_IRQn_NUM(IRQn);
+  RV_REG_WRITE(PFIC->IPSR[PFIC_IRQn_REG(IRQn)], 1UL << PFIC_IRQn_NUM(IRQn));
 }
 
 /*!****************************************************************************
@@ -223,7 +296,7 @@ RV_STATIC_INLINE void PFIC_SetPendingIRQ(IRQn_Type IRQn)
  ******************************************************************************/
 RV_STATIC_INLINE void PFIC_ClearPendingIRQ(IRQn_Type IRQn)
 {
-  PFIC->IPRR[PFIC_IRQn_REG(IRQn)] = 1UL << PFIC_IRQn_NUM(IRQn);
+  RV_REG_WRITE(PFIC->IPRR[PFIC_IRQn_REG(IRQn)], 1UL << PFIC_IRQn_NUM(IRQn));
 }
 
 /*!****************************************************************************
@@ -238,7 +311,199 @@ RV_STATIC_INLINE void PFIC_ClearPendingIRQ(IRQn_Type IRQn)
  ******************************************************************************/
 RV_STATIC_INLINE uint32_t PFIC_GetActive(IRQn_Type IRQn)
 {
-  return (PFIC->IACTR[PFIC_IRQn_REG(IRQn)] & (1UL << PFIC_IRQn_NUM(IRQn))) ? 1UL : 0UL;
+  return (RV_REG_READ(PFIC->IACTR[PFIC_IRQn_REG(IRQn)]) & (1UL << PFIC_IRQn_NUM(IRQn))) ? 1UL : 0UL;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Enable all interrupts of a register bank selected by mask
+ *
+ * Performs a single write to IENR[reg]. Build compile-time masks using
+ * PFIC_IRQn_BANK_MASK().
+ *
+ * @param[in] reg         Register bank index (IRQn / 32)
+ * @param[in] mask        Interrupt bit mask within the bank
+ * @date  16.10.2026
+ ******************************************************************************/
+RV_STATIC_INLINE void PFIC_EnableIRQMask(uint32_t reg, uint32_t mask)
+{
+  RV_REG_WRITE(PFIC->IENR[reg], mask);
+}
+
+/*!****************************************************************************
+ * @brief
+ * Disable all interrupts of a register bank selected by mask
+ *
+ * @param[in] reg         Register bank index (IRQn / 32)
+ * @param[in] mask        Interrupt bit mask within the bank
+ * @date  16.10.2026
+ ******************************************************************************/
+RV_STATIC_INLINE void PFIC_DisableIRQMask(uint32_t reg, uint32_t mask)
+{
+  RV_REG_WRITE(PFIC->IRER[reg], mask);
+}
+
+/*!****************************************************************************
+ * @brief
+ * Set pending state of all interrupts of a register bank selected by mask
+ *
+ * @param[in] reg         Register bank index (IRQn / 32)
+ * @param[in] mask        Interrupt bit mask within the bank
+ * @date  16.10.2026
+ ******************************************************************************/
+RV_STATIC_INLINE void PFIC_SetPendingIRQMask(uint32_t reg, uint32_t mask)
+{
+  RV_REG_WRITE(PFIC->IPSR[reg], mask);
+}
+
+/*!****************************************************************************
+ * @brief
+ * Clear pending state of all interrupts of a register bank selected by mask
+ *
+ * @param[in] reg         Register bank index (IRQn / 32)
+ * @param[in] mask        Interrupt bit mask within the bank
+ * @date  16.10.2026
+ ******************************************************************************/
+RV_STATIC_INLINE void PFIC_ClearPendingIRQMask(uint32_t reg, uint32_t mask)
+{
+  RV_REG_WRITE(PFIC->IPRR[reg], mask);
+}
+
+/*!****************************************************************************
+ * @brief
+ * Get Interrupt Enable State of a whole register bank
+ *
+ * @param[in] reg         Register bank index (IRQn / 32)
+ * @return  (uint32_t)  Enable state bit mask (bit n: IRQn = 32 * reg + n)
+ * @date  16.10.2026
+ ******************************************************************************/
+RV_STATIC_INLINE uint32_t PFIC_GetStatusIRQBank(uint32_t reg)
+{
+  return RV_REG_READ(PFIC->ISR[reg]);
+}
+
+/*!****************************************************************************
+ * @brief
+ * Get Interrupt Pending State of a whole register bank
+ *
+ * @param[in] reg         Register bank index (IRQn / 32)
+ * @return  (uint32_t)  Pending state bit mask (bit n: IRQn = 32 * reg + n)
+ * @date  16.10.2026
+ ******************************************************************************/
+RV_STATIC_INLINE uint32_t PFIC_GetPendingIRQBank(uint32_t reg)
+{
+  return RV_REG_READ(PFIC->IPR[reg]);
+}
+
+/*!****************************************************************************
+ * @brief
+ * Get Interrupt Active State of a whole register bank
+ *
+ * @param[in] reg         Register bank index (IRQn / 32)
+ * @return  (uint32_t)  Active state bit mask (bit n: IRQn = 32 * reg + n)
+ * @date  16.10.2026
+ ******************************************************************************/
+RV_STATIC_INLINE uint32_t PFIC_GetActiveBank(uint32_t reg)
+{
+  return RV_REG_READ(PFIC->IACTR[reg]);
+}
+
+/*!****************************************************************************
+ * @brief
+ * Add Interrupt to an interrupt set
+ *
+ * @param[in,out] set     Interrupt set
+ * @param[in] IRQn        Interrupt Number
+ * @date  16.10.2026
+ ******************************************************************************/
+RV_STATIC_INLINE void PFIC_IRQSetAdd(PFIC_IRQSet_t* set, IRQn_Type IRQn)
+{
+  set->ulMask[PFIC_IRQn_REG(IRQn)] |= PFIC_IRQn_MASK(IRQn);
+}
+
+/*!****************************************************************************
+ * @brief
+ * Enable all interrupts of an interrupt set
+ *
+ * Performs one IENR write per non-empty register bank.
+ *
+ * @param[in] set         Interrupt set
+ * @date  16.10.2026
+ ******************************************************************************/
+RV_STATIC_INLINE void PFIC_EnableIRQSet(const PFIC_IRQSet_t* set)
+{
+  for (uint32_t i = 0; i < PFIC_IRQSET_BANKS; ++i)
+  {
+    if (set->ulMask[i]) PFIC_EnableIRQMask(i, set->ulMask[i]);
+  }
+}
+
+/*!****************************************************************************
+ * @brief
+ * Disable all interrupts of an interrupt set
+ *
+ * Performs one IRER write per non-empty register bank.
+ *
+ * @param[in] set         Interrupt set
+ * @date  16.10.2026
+ ******************************************************************************/
+RV_STATIC_INLINE void PFIC_DisableIRQSet(const PFIC_IRQSet_t* set)
+{
+  for (uint32_t i = 0; i < PFIC_IRQSET_BANKS; ++i)
+  {
+    if (set->ulMask[i]) PFIC_DisableIRQMask(i, set->ulMask[i]);
+  }
+}
+
+/*!****************************************************************************
+ * @brief
+ * Set pending state of all interrupts of an interrupt set
+ *
+ * Performs one IPSR write per non-empty register bank.
+ *
+ * @param[in] set         Interrupt set
+ * @date  16.10.2026
+ ******************************************************************************/
+RV_STATIC_INLINE void PFIC_SetPendingIRQSet(const PFIC_IRQSet_t* set)
+{
+  for (uint32_t i = 0; i < PFIC_IRQSET_BANKS; ++i)
+  {
+    if (set->ulMask[i]) PFIC_SetPendingIRQMask(i, set->ulMask[i]);
+  }
+}
+
+/*!****************************************************************************
+ * @brief
+ * Clear pending state of all interrupts of an interrupt set
+ *
+ * Performs one IPRR write per non-empty register bank.
+ *
+ * @param[in] set         Interrupt set
+ * @date  16.10.2026
+ ******************************************************************************/
+RV_STATIC_INLINE void PFIC_ClearPendingIRQSet(const PFIC_IRQSet_t* set)
+{
+  for (uint32_t i = 0; i < PFIC_IRQSET_BANKS; ++i)
+  {
+    if (set->ulMask[i]) PFIC_ClearPendingIRQMask(i, set->ulMask[i]);
+  }
+}
+
+/*!****************************************************************************
+ * @brief
+ * Get pending state snapshot of all banks covered by an interrupt set
+ *
+ * Performs one IPR read per register bank.
+ *
+ * @param[out] set        Pending interrupts
+ * @date  16.10.2026
+ ******************************************************************************/
+RV_STATIC_INLINE void PFIC_GetPendingIRQSet(PFIC_IRQSet_t* set)
+{
+  for (uint32_t i = 0; i < PFIC_IRQSET_BANKS; ++i)
+  {
+    set->ulMask[i] = PFIC_GetPendingIRQBank(i);
+  }
 }
 
 /*!****************************************************************************
@@ -251,13 +516,91 @@ RV_STATIC_INLINE uint32_t PFIC_GetActive(IRQn_Type IRQn)
  ******************************************************************************/
 RV_STATIC_INLINE void PFIC_SetPriority(IRQn_Type IRQn, uint8_t priority)
 {
-  register uint32_t ulTmp = PFIC->IPRIOR[(IRQn >> 2)];
-  register uint8_t ucShf = (IRQn & 0x3UL) << 3;
+  uint32_t ulTmp = RV_REG_READ(PFIC->IPRIOR[(IRQn >> 2)]);
+  uint8_t ucShf = (IRQn & 0x3UL) << 3;
 
   ulTmp &= ~(PFIC_IPRIOR_PRIO << ucShf);
   ulTmp |= (uint32_t)(priority & 0xC0UL) << ucShf;
 
-  PFIC->IPRIOR[(IRQn >> 2)] = ulTmp;
+  RV_REG_WRITE(PFIC->IPRIOR[(IRQn >> 2)], ulTmp);
+}
+
+/* Interrupt priority table entry                                             */
+typedef struct {
+  IRQn_Type eIRQn;            /*!< Interrupt Number                           */
+  uint8_t ucPriority;         /*!< Priority value (7: pre-empt., 6: subprio.) */
+} PFIC_Priority_t;
+
+/*!****************************************************************************
+ * @brief
+ * Pack interrupt priority entries into IPRIOR words
+ *
+ * Entries outside of the word range [first, first + count) are ignored. The
+ * word buffer is modified in place, so it may be pre-loaded with defaults or
+ * a compile-time table built with PFIC_IPRIOR_WORD().
+ *
+ * @param[in] entries     Priority table entries
+ * @param[in] num         Number of entries
+ * @param[in,out] words   IPRIOR word buffer
+ * @param[in] first       IPRIOR index of words[0]
+ * @param[in] count       Number of words in buffer
+ * @date  16.10.2026
+ ******************************************************************************/
+RV_STATIC_INLINE void PFIC_PackPriorityTable(const PFIC_Priority_t* entries, uint32_t num,
+                                             uint32_t* words, uint32_t first, uint32_t count)
+{
+  for (uint32_t i = 0; i < num; ++i)
+  {
+    uint32_t ulIdx = PFIC_IPRIOR_IDX(entries[i].eIRQn) - first;
+    uint8_t ucShf = (entries[i].eIRQn & 0x3UL) << 3;
+
+    if (ulIdx >= count) continue;
+    words[ulIdx] &= ~(PFIC_IPRIOR_PRIO << ucShf);
+    words[ulIdx] |= (uint32_t)(entries[i].ucPriority & PFIC_IPRIOR_PRIO_IMPL) << ucShf;
+  }
+}
+
+/*!****************************************************************************
+ * @brief
+ * Set Interrupt Priorities from a packed IPRIOR word table
+ *
+ * Each IPRIOR word is written exactly once, without prior read. All four
+ * priorities of a word change with a single store.
+ *
+ * @param[in] words       Packed IPRIOR words (see PFIC_IPRIOR_WORD())
+ * @param[in] first       IPRIOR index of words[0]
+ * @param[in] count       Number of words
+ * @date  16.10.2026
+ ******************************************************************************/
+RV_STATIC_INLINE void PFIC_SetPriorityTable(const uint32_t* words, uint32_t first, uint32_t count)
+{
+  for (uint32_t i = 0; i < count; ++i)
+  {
+    RV_REG_WRITE(PFIC->IPRIOR[first + i], words[i]);
+  }
+}
+
+/*!****************************************************************************
+ * @brief
+ * Verify Interrupt Priorities against a packed IPRIOR word table
+ *
+ * Only implemented priority bits are compared.
+ *
+ * @param[in] words       Packed IPRIOR words (see PFIC_IPRIOR_WORD())
+ * @param[in] first       IPRIOR index of words[0]
+ * @param[in] count       Number of words
+ * @return  (ErrorStatus)  Verification result
+ * @retval  SUCCESS     All priorities match
+ * @retval  ERROR       At least one priority differs
+ * @date  16.10.2026
+ ******************************************************************************/
+RV_STATIC_INLINE ErrorStatus PFIC_VerifyPriorityTable(const uint32_t* words, uint32_t first, uint32_t count)
+{
+  for (uint32_t i = 0; i < count; ++i)
+  {
+    if ((RV_REG_READ(PFIC->IPRIOR[first + i]) ^ words[i]) & PFIC_IPRIOR_WORD_IMPL) return ERROR;
+  }
+  return SUCCESS;
 }
 
 /*!****************************************************************************
@@ -274,14 +617,14 @@ RV_STATIC_INLINE void PFIC_SetPriority(IRQn_Type IRQn, uint8_t priority)
  ******************************************************************************/
 RV_STATIC_INLINE void PFIC_ConfigFastIRQ(uint8_t channel, uint32_t address, IRQn_Type IRQn)
 {
-  register uint32_t ulTmp = PFIC->VTFIDR;
-  register uint8_t ucShf = (channel & 0x3UL) << 3;
+  uint32_t ulTmp = RV_REG_READ(PFIC->VTFIDR);
+  uint8_t ucShf = (channel & 0x3UL) << 3;
 
   ulTmp &= ~(PFIC_VTFIDR_VTFID << ucShf);
   ulTmp |= (uint32_t)(IRQn & PFIC_VTFIDR_VTFID) << ucShf;
 
-  PFIC->VTFIDR = ulTmp;
-  PFIC->VTFADDRR[(channel & 0x3UL)] = (address & PFIC_VTFADDRR_ADDR);
+  RV_REG_WRITE(PFIC->VTFIDR, ulTmp);
+  RV_REG_WRITE(PFIC->VTFADDRR[(channel & 0x3UL)], (address & PFIC_VTFADDRR_ADDR));
 }
 
 /*!****************************************************************************
@@ -293,7 +636,8 @@ RV_STATIC_INLINE void PFIC_ConfigFastIRQ(uint8_t channel, uint32_t address, IRQn
  ******************************************************************************/
 RV_STATIC_INLINE void PFIC_EnableFastIRQ(uint8_t channel)
 {
-  PFIC->VTFADDRR[(channel & 0x3UL)] |= PFIC_VTFADDRR_VTFEN;
+  RV_REG_WRITE(PFIC->VTFADDRR[(channel & 0x3UL)], \
+    RV_REG_READ(PFIC->VTFADDRR[(channel & 0x3UL)]) | PFIC_VTFADDRR_VTFEN);
 }
 
 /*!****************************************************************************
@@ -305,7 +649,8 @@ RV_STATIC_INLINE void PFIC_EnableFastIRQ(uint8_t channel)
  ******************************************************************************/
 RV_STATIC_INLINE void PFIC_DisableFastIRQ(uint8_t channel)
 {
-  PFIC->VTFADDRR[(channel & 0x3UL)] &= ~PFIC_VTFADDRR_VTFEN;
+  RV_REG_WRITE(PFIC->VTFADDRR[(channel & 0x3UL)], \
+    RV_REG_READ(PFIC->VTFADDRR[(channel & 0x3UL)]) & ~PFIC_VTFADDRR_VTFEN);
 }
 
 /*!****************************************************************************
@@ -317,9 +662,9 @@ RV_STATIC_INLINE void PFIC_DisableFastIRQ(uint8_t channel)
 RV_STATIC_INLINE void PFIC_SystemReset(void)
 {
 #ifndef USE_PFIC_SCTLR_SYSRESET
-  PFIC->CFGR = PFIC_CFGR_KEYCODE_KEY3 | PFIC_CFGR_RESETSYS;
+  RV_REG_WRITE(PFIC->CFGR, PFIC_CFGR_KEYCODE_KEY3 | PFIC_CFGR_RESETSYS);
 #else
-  PFIC->SCTLR |= PFIC_SCTLR_SYSRESET;
+  RV_REG_WRITE(PFIC->SCTLR, RV_REG_READ(PFIC->SCTLR) | PFIC_SCTLR_SYSRESET);
 #endif /* USE_PFIC_SCTLR_SYSRESET */
 }
 
@@ -336,7 +681,11 @@ typedef struct
 } SysTick_Type;
 
 /* SysTick access macro                                                       */
+#ifndef USE_HOST_SIM
 #define SysTick                       ((SysTick_Type*)SysTick_BASE)
+#else
+#define SysTick                       ((SysTick_Type*)RVSim_SysTickMem)
+#endif /* USE_HOST_SIM */
 
 /* Bit definitions for SysTick Control Register (CTLR)                        */
 #define SYSTICK_CTLR_STE              0x00000001UL
@@ -359,7 +708,7 @@ typedef struct
  ******************************************************************************/
 RV_STATIC_INLINE void SysTick_SetValue(uint32_t value)
 {
-  SysTick->CNTR = value;
+  RV_REG_WRITE(SysTick->CNTR, value);
 }
 
 /*!****************************************************************************
@@ -371,7 +720,7 @@ RV_STATIC_INLINE void SysTick_SetValue(uint32_t value)
  ******************************************************************************/
 RV_STATIC_INLINE uint32_t SysTick_GetValue(void)
 {
-  return SysTick->CNTR;
+  return RV_REG_READ(SysTick->CNTR);
 }
 
 /*!****************************************************************************
@@ -383,7 +732,7 @@ RV_STATIC_INLINE uint32_t SysTick_GetValue(void)
  ******************************************************************************/
 RV_STATIC_INLINE void SysTick_SetCompare(uint32_t value)
 {
-  SysTick->CMPR = value;
+  RV_REG_WRITE(SysTick->CMPR, value);
 }
 
 /*!****************************************************************************
@@ -395,7 +744,7 @@ RV_STATIC_INLINE void SysTick_SetCompare(uint32_t value)
  ******************************************************************************/
 RV_STATIC_INLINE uint32_t SysTick_GetCompare(void)
 {
-  return SysTick->CMPR;
+  return RV_REG_READ(SysTick->CMPR);
 }
 
 
@@ -408,7 +757,9 @@ RV_STATIC_INLINE uint32_t SysTick_GetCompare(void)
  ******************************************************************************/
 RV_STATIC_FORCE_INLINE void __NOP()
 {
+#ifndef USE_HOST_SIM
   __asm volatile ("nop");
+#endif /* USE_HOST_SIM */
 }
 
 /*!****************************************************************************
@@ -419,7 +770,7 @@ RV_STATIC_FORCE_INLINE void __NOP()
  ******************************************************************************/
 RV_STATIC_FORCE_INLINE void __SEV()
 {
-  PFIC->SCTLR |= PFIC_SCTLR_SETEVENT;
+  RV_REG_WRITE(PFIC->SCTLR, RV_REG_READ(PFIC->SCTLR) | PFIC_SCTLR_SETEVENT);
 }
 
 /*!****************************************************************************
@@ -431,8 +782,12 @@ RV_STATIC_FORCE_INLINE void __SEV()
 RV_STATIC_FORCE_INLINE void __WFI(void)
 {
   /* Instruction is executed as WFI                       */
-  PFIC->SCTLR &= ~PFIC_SCTLR_WFITOWFE;
+  RV_REG_WRITE(PFIC->SCTLR, RV_REG_READ(PFIC->SCTLR) & ~PFIC_SCTLR_WFITOWFE);
+#ifndef USE_HOST_SIM
   __asm volatile ("wfi");
+#else
+  RVSim_WaitForInterrupt();
+#endif /* USE_HOST_SIM */
 }
 
 /*!****************************************************************************
@@ -444,8 +799,12 @@ RV_STATIC_FORCE_INLINE void __WFI(void)
 RV_STATIC_FORCE_INLINE void __WFE(void)
 {
   /* Instruction is executed as WFE                       */
-  PFIC->SCTLR |= PFIC_SCTLR_WFITOWFE;
+  RV_REG_WRITE(PFIC->SCTLR, RV_REG_READ(PFIC->SCTLR) | PFIC_SCTLR_WFITOWFE);
+#ifndef USE_HOST_SIM
   __asm volatile ("wfi");
+#else
+  RVSim_WaitForInterrupt();
+#endif /* USE_HOST_SIM */
 }
 
 /*!****************************************************************************
@@ -456,11 +815,14 @@ RV_STATIC_FORCE_INLINE void __WFE(void)
  ******************************************************************************/
 RV_STATIC_FORCE_INLINE void __EBREAK(void)
 {
+#ifndef USE_HOST_SIM
   __asm volatile ("ebreak");
+#endif /* USE_HOST_SIM */
 }
 
 
 /* ###################### Machine Register Access ########################### */
+#ifndef USE_HOST_SIM
 #define TEMPLATE_CSR_GETTER_FN(fname, csr)                                     \
 /*!****************************************************************************
  * @brief
@@ -491,6 +853,18 @@ RV_STATIC_FORCE_INLINE void __EBREAK(void)
   {                                                                            \
     __asm volatile ("csrw " csr ", %0" :: "r"(value));                         \
   }
+#else
+#define TEMPLATE_CSR_GETTER_FN(fname, csr)                                     \
+  uint32_t fname(void)                                                         \
+  {                                                                            \
+    return RVSim_ReadCSR(csr);                                                 \
+  }
+#define TEMPLATE_CSR_SETTER_FN(fname, csr)                                     \
+  void fname(uint32_t value)                                                   \
+  {                                                                            \
+    RVSim_WriteCSR(csr, value);                                                \
+  }
+#endif /* USE_HOST_SIM */
 
 /* Standard CSRs                                                              */
 RV_STATIC_FORCE_INLINE TEMPLATE_CSR_GETTER_FN(__get_MSTATUS,    "mstatus");
@@ -528,6 +902,47 @@ RV_STATIC_FORCE_INLINE TEMPLATE_CSR_SETTER_FN(__set_DEBUGCR,    "0x7c0");
 RV_STATIC_FORCE_INLINE TEMPLATE_CSR_GETTER_FN(__get_INTSYSCR,   "0x804");
 RV_STATIC_FORCE_INLINE TEMPLATE_CSR_SETTER_FN(__set_INTSYSCR,   "0x804");
 
+/*!****************************************************************************
+ * @brief
+ * Get 64-bit cycle counter without tearing
+ *
+ * Reads mcycleh, mcycle, mcycleh and retries if a carry into the high word
+ * occurred in between.
+ *
+ * @return  (uint64_t)  mcycleh:mcycle
+ * @date  16.10.2026
+ ******************************************************************************/
+RV_STATIC_FORCE_INLINE uint64_t __get_MCYCLE64(void)
+{
+  uint32_t ulHi, ulLo;
+
+  do
+  {
+    ulHi = __get_MCYCLEH();
+    ulLo = __get_MCYCLE();
+  } while (ulHi != __get_MCYCLEH());
+  return ((uint64_t)ulHi << 32) | ulLo;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Get 64-bit retired instruction counter without tearing
+ *
+ * @return  (uint64_t)  minstreth:minstret
+ * @date  16.10.2026
+ ******************************************************************************/
+RV_STATIC_FORCE_INLINE uint64_t __get_MINSTRET64(void)
+{
+  uint32_t ulHi, ulLo;
+
+  do
+  {
+    ulHi = __get_MINSTRETH();
+    ulLo = __get_MINSTRET();
+  } while (ulHi != __get_MINSTRETH());
+  return ((uint64_t)ulHi << 32) | ulLo;
+}
+
 
 /* ############################## Other ##################################### */
 /*!****************************************************************************
@@ -541,7 +956,11 @@ RV_STATIC_FORCE_INLINE TEMPLATE_CSR_SETTER_FN(__set_INTSYSCR,   "0x804");
 RV_STATIC_FORCE_INLINE uint32_t __get_SP(void)
 {
   uint32_t result;
+#ifndef USE_HOST_SIM
   __asm volatile ("mv %0, sp" : "=r"(result));
+#else
+  result = (uint32_t)(uintptr_t)&result;
+#endif /* USE_HOST_SIM */
   return result;
 }
 
@@ -555,7 +974,11 @@ RV_STATIC_FORCE_INLINE uint32_t __get_SP(void)
  ******************************************************************************/
 RV_STATIC_FORCE_INLINE void __disable_irq(void)
 {
+#ifndef USE_HOST_SIM
   __asm volatile ("csrci mstatus, 0x08" ::: "memory");
+#else
+  RVSim_WriteCSR("mstatus", RVSim_ReadCSR("mstatus") & ~0x08UL);
+#endif /* USE_HOST_SIM */
 }
 
 /*!****************************************************************************
@@ -568,10 +991,146 @@ RV_STATIC_FORCE_INLINE void __disable_irq(void)
  ******************************************************************************/
 RV_STATIC_FORCE_INLINE void __enable_irq(void)
 {
+#ifndef USE_HOST_SIM
   __asm volatile ("csrsi mstatus, 0x08" ::: "memory");
+#else
+  RVSim_WriteCSR("mstatus", RVSim_ReadCSR("mstatus") | 0x08UL);
+#endif /* USE_HOST_SIM */
+}
+
+/* Bit definitions for Machine Status Register (mstatus)                      */
+#define MSTATUS_MIE                   0x00000008UL
+#define MSTATUS_MPIE                  0x00000080UL
+
+/* Compiler memory barrier: keeps memory accesses inside critical sections    */
+#define RV_COMPILER_BARRIER()         __asm volatile ("" ::: "memory")
+
+/*!****************************************************************************
+ * @brief
+ * Disable machine interrupts and return previous state
+ *
+ * Clears MIE bit in mstatus register with a single atomic csrrci. Pair with
+ * __restore_irq() to build critical sections that nest correctly.
+ *
+ * @return  (uint32_t)  mstatus value before disabling interrupts
+ * @date  16.10.2026
+ ******************************************************************************/
+RV_STATIC_FORCE_INLINE uint32_t __disable_irq_save(void)
+{
+  uint32_t result;
+#ifndef USE_HOST_SIM
+  __asm volatile ("csrrci %0, mstatus, 0x08" : "=r"(result) :: "memory");
+#else
+  result = RVSim_ReadCSR("mstatus");
+  RVSim_WriteCSR("mstatus", result & ~MSTATUS_MIE);
+#endif /* USE_HOST_SIM */
+  return result;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Restore machine interrupt state
+ *
+ * Sets MIE bit in mstatus register only if it was set in the saved state, so
+ * an inner critical section never re-enables interrupts of an outer one.
+ *
+ * @param[in] state       mstatus value returned by __disable_irq_save()
+ * @date  16.10.2026
+ ******************************************************************************/
+RV_STATIC_FORCE_INLINE void __restore_irq(uint32_t state)
+{
+#ifndef USE_HOST_SIM
+  __asm volatile ("csrs mstatus, %0" :: "r"(state & MSTATUS_MIE) : "memory");
+#else
+  RVSim_WriteCSR("mstatus", RVSim_ReadCSR("mstatus") | (state & MSTATUS_MIE));
+#endif /* USE_HOST_SIM */
 }
 
 /* ########################### PFIC (contd.) ################################ */
+/*!****************************************************************************
+ * @brief
+ * Set Interrupt Priority Threshold
+ *
+ * @note
+ * Interrupts with a priority value numerically greater than or equal to the
+ * threshold (i.e. equal or lower urgency) are held pending. A threshold of 0
+ * disables the masking function.
+ *
+ * The threshold is rounded up to the implemented priority bits (see
+ * PFIC_THRESHOLD()), e.g. 0x20 masks priorities 0x40..0xC0. Values above
+ * 0xC0 round to 0 and disable masking, as no priority is that low.
+ *
+ * @param[in] threshold   Priority threshold (7: pre-emption, 6: subpriority)
+ * @date  16.10.2026
+ ******************************************************************************/
+RV_STATIC_FORCE_INLINE void PFIC_SetThreshold(uint8_t threshold)
+{
+  RV_COMPILER_BARRIER();
+  RV_REG_WRITE(PFIC->ITHRESDR, PFIC_THRESHOLD(threshold));
+  RV_COMPILER_BARRIER();
+}
+
+/*!****************************************************************************
+ * @brief
+ * Get Interrupt Priority Threshold
+ *
+ * @return  (uint8_t)  Priority threshold, 0 if disabled
+ * @date  16.10.2026
+ ******************************************************************************/
+RV_STATIC_FORCE_INLINE uint8_t PFIC_GetThreshold(void)
+{
+  return (uint8_t)RV_REG_READ(PFIC->ITHRESDR);
+}
+
+/*!****************************************************************************
+ * @brief
+ * Enter priority-threshold critical section
+ *
+ * Masks all interrupts with priority value >= priority, leaving more urgent
+ * interrupts running (BASEPRI-like). The threshold is only ever tightened, so
+ * sections nest correctly. Restore with PFIC_RestoreThreshold().
+ *
+ * Unlike __disable_irq_save(), interrupts above the threshold are blocked
+ * only while the threshold is updated, not for the length of the section.
+ * Interrupts at or below the threshold are blocked for the section length,
+ * as with global masking. Worst-case blocking of a priority 0x40 interrupt
+ * by a 16-iteration loop section (tests/target/bench_threshold.s, simulator
+ * estimate): 50 cycles with global masking, 7 cycles with a threshold of
+ * 0x80.
+ *
+ * The comparison with the current threshold uses the rounded value that is
+ * written to ITHRESDR. A priority that rounds to 0 (0 itself, or above 0xC0)
+ * cannot be expressed as a threshold and leaves the threshold unchanged; use
+ * __disable_irq_save() to block all interrupts.
+ *
+ * @param[in] priority    Threshold, interrupts with priority >= priority are
+ *                        masked; must lie within 0x01..0xC0
+ * @return  (uint8_t)  Previous threshold
+ * @date  16.10.2026
+ ******************************************************************************/
+RV_STATIC_FORCE_INLINE uint8_t PFIC_RaiseThreshold(uint8_t priority)
+{
+  uint32_t ulState = __disable_irq_save();
+  uint8_t ucPrev = PFIC_GetThreshold();
+  uint8_t ucNew = PFIC_THRESHOLD(priority);
+
+  if ((ucNew != 0) && ((ucPrev == 0) || (ucNew < ucPrev))) PFIC_SetThreshold(ucNew);
+  __restore_irq(ulState);
+  return ucPrev;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Leave priority-threshold critical section
+ *
+ * @param[in] threshold   Threshold returned by PFIC_RaiseThreshold()
+ * @date  16.10.2026
+ ******************************************************************************/
+RV_STATIC_FORCE_INLINE void PFIC_RestoreThreshold(uint8_t threshold)
+{
+  PFIC_SetThreshold(threshold);
+}
+
 /*!****************************************************************************
  * @brief
  * Configure EABI support, HPE and Interrupt Nesting function
@@ -0,0 +1,222 @@
+/*!****************************************************************************
+ * @file
+ * core_riscv.hpp
+ *
+ * @brief
+ * RISC-V2A Typed Register and Field Access (C++17, optional)
+ *
+ * Registers of PFIC_Type and SysTick_Type are described as types carrying
+ * their offset, access class (__I, __O, __IO) and implemented bits; fields
+ * carry position and width. All masks are compile-time constants:
+ *  - Reg::modify(F1::val(x), F2::set(), ...) merges any number of field
+ *    updates of one register into a single load and store. If the fields
+ *    cover all implemented bits, the load is omitted.
+ *  - Reg::write(...) stores the given fields, all other bits zero.
+ *  - Writing a read-only (__I) or reading a write-only (__O) register,
+ *    overlapping fields and fields of another register fail to compile.
+ *
+ * Accesses go through RV_REG_READ()/RV_REG_WRITE(), so USE_HOST_SIM
+ * applies. tools/reg_compare.cpp compares register accesses against the C
+ * macros.
+ *
+ * @date  16.10.2026
+ ******************************************************************************/
+
+#ifndef CORE_RISCV_HPP_
+#define CORE_RISCV_HPP_
+
+#ifndef CORE_RISCV_H_
+#error "core_riscv.h must be included (via the device header) first"
+#endif /* CORE_RISCV_H_ */
+
+#if __cplusplus < 201703L
+#error "core_riscv.hpp requires C++17"
+#endif
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace rv {
+
+/* Register access class, as declared in the register file structs            */
+enum class Access { RO, WO, RW };
+
+namespace detail {
+
+template <typename A, typename B> struct Same { static constexpr bool value = false; };
+template <typename A> struct Same<A, A> { static constexpr bool value = true; };
+
+/* Peripheral base addresses (simulated register files with USE_HOST_SIM)     */
+struct PficBase    { static uintptr_t addr() { return reinterpret_cast<uintptr_t>(PFIC); } };
+struct SysTickBase { static uintptr_t addr() { return reinterpret_cast<uintptr_t>(SysTick); } };
+
+/* Offset of array element N, range checked                                   */
+template <size_t Offset, uint32_t N, uint32_t Count> struct Index {
+  static_assert(N < Count, "register index out of range");
+  static constexpr size_t value = Offset + 4U * N;
+};
+
+} /* namespace detail */
+
+/* Field value with compile-time mask                                         */
+template <typename F> struct FieldValue {
+  using Field = F;
+  static constexpr uint32_t mask = F::mask;
+  uint32_t value;
+};
+
+/*!****************************************************************************
+ * @brief
+ * Memory-mapped 32-bit register
+ *
+ * @tparam Base           Peripheral base (detail::PficBase, ...)
+ * @tparam Offset         Byte offset in the register file
+ * @tparam A              Access class
+ * @tparam Impl           Implemented bits
+ * @date  16.10.2026
+ ******************************************************************************/
+template <typename Base, size_t Offset, Access A, uint32_t Impl = 0xFFFFFFFFUL>
+struct Reg {
+  static constexpr uint32_t impl = Impl;
+
+  static volatile uint32_t& ref()
+  {
+    return *reinterpret_cast<volatile uint32_t*>(Base::addr() + Offset);
+  }
+
+  static uint32_t read()
+  {
+    static_assert(A != Access::WO, "register is write-only (__O)");
+    return RV_REG_READ(ref());
+  }
+
+  static void write(uint32_t value)
+  {
+    static_assert(A != Access::RO, "register is read-only (__I)");
+    RV_REG_WRITE(ref(), value);
+  }
+
+  /* Store fields, all other bits zero                                      */
+  template <typename... F>
+  static void write(FieldValue<F>... values)
+  {
+    check<F...>();
+    write((values.value | ... | 0U));
+  }
+
+  /* Update fields in a single access, load only if bits remain unknown     */
+  template <typename... F>
+  static void modify(FieldValue<F>... values)
+  {
+    constexpr uint32_t ulMask = (F::mask | ... | 0U);
+    const uint32_t ulValue = (values.value | ... | 0U);
+
+    check<F...>();
+    if constexpr ((ulMask & Impl) == Impl)
+    {
+      write(ulValue);
+    }
+    else
+    {
+      static_assert(A == Access::RW, "read-modify-write needs a readable and writable register");
+      write((read() & ~ulMask) | ulValue);
+    }
+  }
+
+private:
+  template <typename... F>
+  static constexpr void check()
+  {
+    static_assert(sizeof...(F) > 0, "no fields given");
+    static_assert((detail::Same<typename F::Register, Reg>::value && ...), "field of another register");
+    static_assert(((F::mask + ... + 0ULL)) == (F::mask | ... | 0U), "overlapping fields");
+  }
+};
+
+/*!****************************************************************************
+ * @brief
+ * Register field
+ *
+ * @tparam R              Register
+ * @tparam Pos            Position of the lowest bit
+ * @tparam Width          Width in bits
+ * @date  16.10.2026
+ ******************************************************************************/
+template <typename R, uint32_t Pos, uint32_t Width = 1U>
+struct Field {
+  static_assert((Width >= 1U) && (Pos + Width <= 32U), "field exceeds register");
+
+  using Register = R;
+  static constexpr uint32_t mask = (0xFFFFFFFFUL >> (32U - Width)) << Pos;
+
+  static constexpr FieldValue<Field> val(uint32_t value) { return { (value << Pos) & mask }; }
+  static constexpr FieldValue<Field> set() { return { mask }; }
+  static constexpr FieldValue<Field> clear() { return { 0U }; }
+
+  static uint32_t read() { return (R::read() & mask) >> Pos; }
+  static void write(uint32_t value) { R::modify(val(value)); }
+};
+
+/* ############### Programmable Fast Interrupt Controller ################### */
+namespace pfic {
+
+template <uint32_t N> using ISR      = Reg<detail::PficBase, detail::Index<offsetof(PFIC_Type, ISR), N, 8U>::value, Access::RO>;
+template <uint32_t N> using IPR      = Reg<detail::PficBase, detail::Index<offsetof(PFIC_Type, IPR), N, 8U>::value, Access::RO>;
+using ITHRESDR                       = Reg<detail::PficBase, offsetof(PFIC_Type, ITHRESDR), Access::RW, 0x000000FFUL>;
+using CFGR                           = Reg<detail::PficBase, offsetof(PFIC_Type, CFGR), Access::RW, 0xFFFF0080UL>;
+using GISR                           = Reg<detail::PficBase, offsetof(PFIC_Type, GISR), Access::RO, 0x000003FFUL>;
+using VTFIDR                         = Reg<detail::PficBase, offsetof(PFIC_Type, VTFIDR), Access::RW>;
+template <uint32_t N> using VTFADDRR = Reg<detail::PficBase, detail::Index<offsetof(PFIC_Type, VTFADDRR), N, 4U>::value, Access::RW>;
+template <uint32_t N> using IENR     = Reg<detail::PficBase, detail::Index<offsetof(PFIC_Type, IENR), N, 8U>::value, Access::WO>;
+template <uint32_t N> using IRER     = Reg<detail::PficBase, detail::Index<offsetof(PFIC_Type, IRER), N, 8U>::value, Access::WO>;
+template <uint32_t N> using IPSR     = Reg<detail::PficBase, detail::Index<offsetof(PFIC_Type, IPSR), N, 8U>::value, Access::WO>;
+template <uint32_t N> using IPRR     = Reg<detail::PficBase, detail::Index<offsetof(PFIC_Type, IPRR), N, 8U>::value, Access::WO>;
+template <uint32_t N> using IACTR    = Reg<detail::PficBase, detail::Index<offsetof(PFIC_Type, IACTR), N, 8U>::value, Access::RW>;
+template <uint32_t N> using IPRIOR   = Reg<detail::PficBase, detail::Index<offsetof(PFIC_Type, IPRIOR), N, 64U>::value, Access::RW, PFIC_IPRIOR_WORD_IMPL>;
+using SCTLR                          = Reg<detail::PficBase, offsetof(PFIC_Type, SCTLR), Access::RW, 0x8000003EUL>;
+
+using ITHRESDR_THRESHOLD             = Field<ITHRESDR, 0U, 8U>;
+using CFGR_RESETSYS                  = Field<CFGR, 7U>;
+using CFGR_KEYCODE                   = Field<CFGR, 16U, 16U>;
+using GISR_NESTSTA                   = Field<GISR, 0U, 8U>;
+using GISR_GACTSTA                   = Field<GISR, 8U>;
+using GISR_GPENDSTA                  = Field<GISR, 9U>;
+template <uint32_t C> using VTFIDR_VTFID     = Field<VTFIDR, 8U * C, 8U>;
+template <uint32_t C> using VTFADDRR_VTFEN   = Field<VTFADDRR<C>, 0U>;
+template <uint32_t C> using VTFADDRR_ADDR    = Field<VTFADDRR<C>, 1U, 31U>;  /* Address >> 1 */
+template <uint32_t N> using IPRIOR_PRIO      = Field<IPRIOR<N / 4U>, 8U * (N % 4U), 8U>;
+using SCTLR_SLEEPONEXIT              = Field<SCTLR, 1U>;
+using SCTLR_SLEEPDEEP                = Field<SCTLR, 2U>;
+using SCTLR_WFITOWFE                 = Field<SCTLR, 3U>;
+using SCTLR_SEVONPEND                = Field<SCTLR, 4U>;
+using SCTLR_SETEVENT                 = Field<SCTLR, 5U>;
+using SCTLR_SYSRESET                 = Field<SCTLR, 31U>;
+
+/* Interrupt enable/disable/pend by compile-time IRQn (single store)          */
+template <IRQn_Type I> inline void EnableIRQ()  { IENR<PFIC_IRQn_REG(I)>::write(PFIC_IRQn_MASK(I)); }
+template <IRQn_Type I> inline void DisableIRQ() { IRER<PFIC_IRQn_REG(I)>::write(PFIC_IRQn_MASK(I)); }
+template <IRQn_Type I> inline void SetPendingIRQ() { IPSR<PFIC_IRQn_REG(I)>::write(PFIC_IRQn_MASK(I)); }
+template <IRQn_Type I> inline void ClearPendingIRQ() { IPRR<PFIC_IRQn_REG(I)>::write(PFIC_IRQn_MASK(I)); }
+
+} /* namespace pfic */
+
+/* ############################ SysTick Timer ############################### */
+namespace systick {
+
+using CTLR                           = Reg<detail::SysTickBase, offsetof(SysTick_Type, CTLR), Access::RW, 0x8000000FUL>;
+using SR                             = Reg<detail::SysTickBase, offsetof(SysTick_Type, SR), Access::RW, 0x00000001UL>;
+using CNTR                           = Reg<detail::SysTickBase, offsetof(SysTick_Type, CNTR), Access::RW>;
+using CMPR                           = Reg<detail::SysTickBase, offsetof(SysTick_Type, CMPR), Access::RW>;
+
+using CTLR_STE                       = Field<CTLR, 0U>;
+using CTLR_STIE                      = Field<CTLR, 1U>;
+using CTLR_STCLK                     = Field<CTLR, 2U>;
+using CTLR_STRE                      = Field<CTLR, 3U>;
+using CTLR_SWIE                      = Field<CTLR, 31U>;
+using SR_CNTIF                       = Field<SR, 0U>;
+
+} /* namespace systick */
+
+} /* namespace rv */
+
+#endif /* CORE_RISCV_HPP_ */
@@ -0,0 +1,297 @@
+/*!****************************************************************************
+ * @file
+ * core_riscv_alloc.c
+ *
+ * @brief
+ * RISC-V2A Deterministic Fixed-Block Pool and Arena Allocators
+ *
+ * @note
+ * Build with RV_DEVICE_HEADER set to the device header, which includes
+ * core_riscv.h (e.g. -DRV_DEVICE_HEADER=\"ch32v00x.h\").
+ *
+ * @date  16.10.2026
+ ******************************************************************************/
+
+#include RV_DEVICE_HEADER
+#include "core_riscv_alloc.h"
+
+/* Heap region: next free byte and end                                        */
+static uint8_t* pucRegionTop;
+static uint8_t* pucRegionEnd;
+
+#ifdef USE_ALLOC_STATS
+/*!****************************************************************************
+ * @brief
+ * Account successful allocation
+ *
+ * @param[in,out] stats   Statistics
+ * @param[in] used        Blocks or bytes in use after the allocation
+ * @date  16.10.2026
+ ******************************************************************************/
+static void prvStatsAlloc(Alloc_Stats_t* stats, uint32_t used)
+{
+  stats->ulUsed = used;
+  if (used > stats->ulPeak) stats->ulPeak = used;
+  stats->ulAllocs++;
+}
+
+#define ALLOC_STATS_INIT(obj)         ((obj)->xStats = (Alloc_Stats_t){ 0 })
+#define ALLOC_STATS_ALLOC(obj, used)  prvStatsAlloc(&(obj)->xStats, (used))
+#define ALLOC_STATS_SET(obj, used)    ((obj)->xStats.ulUsed = (used))
+#define ALLOC_STATS_FAIL(obj)         ((obj)->xStats.ulFails++)
+#else
+#define ALLOC_STATS_INIT(obj)         ((void)0)
+#define ALLOC_STATS_ALLOC(obj, used)  ((void)0)
+#define ALLOC_STATS_SET(obj, used)    ((void)0)
+#define ALLOC_STATS_FAIL(obj)         ((void)0)
+#endif /* USE_ALLOC_STATS */
+
+/*!****************************************************************************
+ * @brief
+ * Initialise the heap region
+ *
+ * @return  (uint32_t)  Region size in bytes
+ * @date  16.10.2026
+ ******************************************************************************/
+uint32_t Alloc_Init(void)
+{
+  uintptr_t xStart = ((uintptr_t)_sheap + ALLOC_ALIGN - 1U) & ~(uintptr_t)(ALLOC_ALIGN - 1U);
+  uintptr_t xEnd = (uintptr_t)_eheap & ~(uintptr_t)(ALLOC_ALIGN - 1U);
+  uint32_t ulState = __disable_irq_save();
+
+  if (xEnd < xStart) xEnd = xStart;
+  pucRegionTop = (uint8_t*)xStart;
+  pucRegionEnd = (uint8_t*)xEnd;
+  __restore_irq(ulState);
+  return (uint32_t)(xEnd - xStart);
+}
+
+/*!****************************************************************************
+ * @brief
+ * Take memory from the heap region permanently
+ *
+ * @param[in] size        Size in bytes
+ * @return  (void*)  Aligned memory, NULL if the region is exhausted or size
+ *                   exceeds ALLOC_SIZE_MAX
+ * @date  16.10.2026
+ ******************************************************************************/
+void* Alloc_Carve(uint32_t size)
+{
+  uint8_t* pucMem = NULL;
+  uint32_t ulState;
+
+  if (size > ALLOC_SIZE_MAX) return NULL;
+  size = ALLOC_ROUND(size);
+  ulState = __disable_irq_save();
+  if (size <= (uint32_t)(pucRegionEnd - pucRegionTop))
+  {
+    pucMem = pucRegionTop;
+    pucRegionTop += size;
+  }
+  __restore_irq(ulState);
+  return pucMem;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Get remaining size of the heap region
+ *
+ * @return  (uint32_t)  Bytes available to Alloc_Carve()
+ * @date  16.10.2026
+ ******************************************************************************/
+uint32_t Alloc_GetFree(void)
+{
+  return (uint32_t)(pucRegionEnd - pucRegionTop);
+}
+
+/*!****************************************************************************
+ * @brief
+ * Initialise pool, taking its storage from the heap region
+ *
+ * Blocks are handed out from the storage in address order on first use, so
+ * initialisation does not walk the pool.
+ *
+ * @param[out] pool       Pool
+ * @param[in] size        Block size in bytes (rounded up to ALLOC_ALIGN)
+ * @param[in] count       Number of blocks
+ * @return  (ErrorStatus)  ERROR if the region is exhausted or size is too
+ *                         large
+ * @date  16.10.2026
+ ******************************************************************************/
+ErrorStatus Pool_Init(Pool_t* pool, uint32_t size, uint32_t count)
+{
+  uint32_t ulSize;
+  uint8_t* pucBase;
+
+  if ((size > ALLOC_SIZE_MAX) || (count == 0)) return ERROR;
+  ulSize = POOL_BLOCK_SIZE(size);
+  if (count > UINT32_MAX / ulSize) return ERROR;
+  pucBase = Alloc_Carve(ulSize * count);
+  if (pucBase == NULL) return ERROR;
+
+  pool->pvFree = NULL;
+  pool->pucBase = pucBase;
+  pool->pucFresh = pucBase;
+  pool->ulFresh = count;
+  pool->ulBlockSize = ulSize;
+  pool->ulBlocks = count;
+  ALLOC_STATS_INIT(pool);
+  return SUCCESS;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Allocate block
+ *
+ * @param[in,out] pool    Pool
+ * @return  (void*)  Block, NULL if none is free
+ * @date  16.10.2026
+ ******************************************************************************/
+void* Pool_Alloc(Pool_t* pool)
+{
+  uint32_t ulState = __disable_irq_save();
+  void* pvBlock = pool->pvFree;
+
+  if (pvBlock != NULL)
+  {
+    pool->pvFree = *(void**)pvBlock;
+    ALLOC_STATS_ALLOC(pool, pool->xStats.ulUsed + 1U);
+  }
+  else if (pool->ulFresh != 0)
+  {
+    pvBlock = pool->pucFresh;
+    pool->pucFresh += pool->ulBlockSize;
+    pool->ulFresh--;
+    ALLOC_STATS_ALLOC(pool, pool->xStats.ulUsed + 1U);
+  }
+  else
+  {
+    ALLOC_STATS_FAIL(pool);
+  }
+  __restore_irq(ulState);
+  return pvBlock;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Return block to its pool
+ *
+ * @param[in,out] pool    Pool the block was allocated from
+ * @param[in] block       Block, NULL is ignored
+ * @date  16.10.2026
+ ******************************************************************************/
+void Pool_Free(Pool_t* pool, void* block)
+{
+  uint32_t ulState;
+
+  if (block == NULL) return;
+
+  ulState = __disable_irq_save();
+  *(void**)block = pool->pvFree;
+  pool->pvFree = block;
+  ALLOC_STATS_SET(pool, pool->xStats.ulUsed - 1U);
+  __restore_irq(ulState);
+}
+
+/*!****************************************************************************
+ * @brief
+ * Initialise arena, taking its storage from the heap region
+ *
+ * @param[out] arena      Arena
+ * @param[in] size        Arena size in bytes
+ * @return  (ErrorStatus)  ERROR if the region is exhausted or size is too
+ *                         large
+ * @date  16.10.2026
+ ******************************************************************************/
+ErrorStatus Arena_Init(Arena_t* arena, uint32_t size)
+{
+  uint8_t* pucBase = Alloc_Carve(size);
+
+  if (pucBase == NULL) return ERROR;
+  arena->pucBase = pucBase;
+  arena->pucEnd = pucBase + ALLOC_ROUND(size);
+  arena->pucTop = pucBase;
+  ALLOC_STATS_INIT(arena);
+  return SUCCESS;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Allocate from arena
+ *
+ * @param[in,out] arena   Arena
+ * @param[in] size        Size in bytes
+ * @return  (void*)  Aligned memory, NULL if the arena is exhausted or size
+ *                   exceeds ALLOC_SIZE_MAX
+ * @date  16.10.2026
+ ******************************************************************************/
+void* Arena_Alloc(Arena_t* arena, uint32_t size)
+{
+  uint8_t* pucMem = NULL;
+  uint32_t ulState = __disable_irq_save();
+
+  if ((size <= ALLOC_SIZE_MAX) && (ALLOC_ROUND(size) <= (uint32_t)(arena->pucEnd - arena->pucTop)))
+  {
+    pucMem = arena->pucTop;
+    arena->pucTop += ALLOC_ROUND(size);
+    ALLOC_STATS_ALLOC(arena, (uint32_t)(arena->pucTop - arena->pucBase));
+  }
+  else
+  {
+    ALLOC_STATS_FAIL(arena);
+  }
+  __restore_irq(ulState);
+  return pucMem;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Release all arena allocations made after a mark
+ *
+ * @param[in,out] arena   Arena
+ * @param[in] mark        Mark from Arena_Mark(), 0 releases everything
+ * @date  16.10.2026
+ ******************************************************************************/
+void Arena_Reset(Arena_t* arena, uint32_t mark)
+{
+  uint32_t ulState = __disable_irq_save();
+
+  if (mark < (uint32_t)(arena->pucTop - arena->pucBase))
+  {
+    arena->pucTop = arena->pucBase + mark;
+    ALLOC_STATS_SET(arena, mark);
+  }
+  __restore_irq(ulState);
+}
+
+#ifdef USE_ALLOC_STATS
+/*!****************************************************************************
+ * @brief
+ * Get pool statistics
+ *
+ * @param[in] pool        Pool
+ * @param[out] stats      Statistics
+ * @date  16.10.2026
+ ******************************************************************************/
+void Pool_GetStats(const Pool_t* pool, Alloc_Stats_t* stats)
+{
+  uint32_t ulState = __disable_irq_save();
+  *stats = pool->xStats;
+  __restore_irq(ulState);
+}
+
+/*!****************************************************************************
+ * @brief
+ * Get arena statistics
+ *
+ * @param[in] arena       Arena
+ * @param[out] stats      Statistics
+ * @date  16.10.2026
+ ******************************************************************************/
+void Arena_GetStats(const Arena_t* arena, Alloc_Stats_t* stats)
+{
+  uint32_t ulState = __disable_irq_save();
+  *stats = arena->xStats;
+  __restore_irq(ulState);
+}
+#endif /* USE_ALLOC_STATS */
@@ -0,0 +1,105 @@
+/*!****************************************************************************
+ * @file
+ * core_riscv_clock.c
+ *
+ * @brief
+ * RISC-V2A 64-bit Monotonic Timebase and Calibrated Delays
+ *
+ * @note
+ * Build with RV_DEVICE_HEADER set to the device header, which includes
+ * core_riscv.h (e.g. -DRV_DEVICE_HEADER=\"ch32v00x.h\").
+ *
+ * @date  16.10.2026
+ ******************************************************************************/
+
+#include RV_DEVICE_HEADER
+#include "core_riscv_clock.h"
+
+/* Last observed CNTR value and number of CNTR wraps                          */
+static uint32_t ulLastCnt;
+static uint32_t ulWraps;
+
+/* CNTR value at Clock_Init()                                                 */
+static uint32_t ulBaseCnt;
+
+/* Measured Clock_DelayCycles() overhead                                      */
+static uint32_t ulDelayOverhead;
+
+/*!****************************************************************************
+ * @brief
+ * Initialise monotonic timebase
+ *
+ * @date  16.10.2026
+ ******************************************************************************/
+void Clock_Init(void)
+{
+  uint32_t ulState = __disable_irq_save();
+
+  if (!(RV_REG_READ(SysTick->CTLR) & SYSTICK_CTLR_STE))
+  {
+    RV_REG_WRITE(SysTick->CTLR, SYSTICK_CTLR_STE |
+      ((CLOCK_SYSTICK_HZ == CLOCK_CORE_HZ) ? SYSTICK_CTLR_STCLK_DIV1 : SYSTICK_CTLR_STCLK_DIV8));
+  }
+  ulBaseCnt = SysTick_GetValue();
+  ulLastCnt = ulBaseCnt;
+  ulWraps = 0;
+  __restore_irq(ulState);
+
+  Clock_Calibrate();
+}
+
+/*!****************************************************************************
+ * @brief
+ * Get 64-bit monotonic SysTick count
+ *
+ * @return  (uint64_t)  SysTick counts since Clock_Init()
+ * @date  16.10.2026
+ ******************************************************************************/
+uint64_t Clock_GetTicks64(void)
+{
+  uint32_t ulState = __disable_irq_save();
+  uint32_t ulCnt = SysTick_GetValue();
+  uint64_t ullTicks;
+
+  if (ulCnt < ulLastCnt) ulWraps++;
+  ulLastCnt = ulCnt;
+  ullTicks = (((uint64_t)ulWraps << 32) | ulCnt) - ulBaseCnt;
+  __restore_irq(ulState);
+  return ullTicks;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Measure the fixed overhead of Clock_DelayCycles()
+ *
+ * @return  (uint32_t)  Overhead in cycles, subtracted from subsequent delays
+ * @date  16.10.2026
+ ******************************************************************************/
+uint32_t Clock_Calibrate(void)
+{
+  uint32_t ulState = __disable_irq_save();
+  uint32_t ulStart;
+
+  ulDelayOverhead = 0;
+  ulStart = __get_MCYCLE();
+  Clock_DelayCycles(0);
+  ulDelayOverhead = __get_MCYCLE() - ulStart;
+  __restore_irq(ulState);
+  return ulDelayOverhead;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Busy-wait for a number of core cycles (mcycle based)
+ *
+ * @param[in] cycles      Delay in cycles, including call overhead
+ * @date  16.10.2026
+ ******************************************************************************/
+void Clock_DelayCycles(uint32_t cycles)
+{
+  uint32_t ulStart = __get_MCYCLE();
+
+  if (cycles <= ulDelayOverhead) return;
+  cycles -= ulDelayOverhead;
+  while ((__get_MCYCLE() - ulStart) < cycles);
+}
@@ -0,0 +1,197 @@
+/*!****************************************************************************
+ * @file
+ * core_riscv_clock.h
+ *
+ * @brief
+ * RISC-V2A 64-bit Monotonic Timebase and Calibrated Delays
+ *
+ * Extends the free-running SysTick CNTR to 64 bits. Conversions between
+ * SysTick ticks, core cycles and time units use fixed-point factors derived
+ * from CLOCK_SYSTICK_HZ and CLOCK_CORE_HZ at compile time, so no division is
+ * executed at runtime.
+ *
+ * @date  16.10.2026
+ ******************************************************************************/
+
+#ifndef CORE_RISCV_CLOCK_H_
+#define CORE_RISCV_CLOCK_H_
+
+#ifndef CORE_RISCV_H_
+#error "core_riscv.h must be included (via the device header) first"
+#endif /* CORE_RISCV_H_ */
+
+/* Core clock frequency in Hz (mcycle rate)                                   */
+#ifndef CLOCK_CORE_HZ
+#define CLOCK_CORE_HZ                 48000000UL
+#endif /* CLOCK_CORE_HZ */
+
+/* SysTick counter frequency in Hz (HCLK/8 or HCLK, see SYSTICK_CTLR_STCLK)   */
+#ifndef CLOCK_SYSTICK_HZ
+#define CLOCK_SYSTICK_HZ              (CLOCK_CORE_HZ / 8UL)
+#endif /* CLOCK_SYSTICK_HZ */
+
+/* Fixed-point conversion factor "to/from": integer part and Q32 fraction,
+ * rounded up so that exact conversions are not truncated by one unit        */
+#define CLOCK_FACTOR_INT(to, from)    ((uint32_t)((uint64_t)(to) / (from)))
+#define CLOCK_FACTOR_FRAC(to, from)   \
+  ((uint32_t)(((((uint64_t)(to) % (from)) << 32) + (from) - 1UL) / (from)))
+
+/*!****************************************************************************
+ * @brief
+ * Scale 32-bit value by a fixed-point factor
+ *
+ * @param[in] value       Value to scale
+ * @param[in] fint        Integer part of the factor
+ * @param[in] ffrac       Q32 fractional part of the factor
+ * @return  (uint32_t)  Scaled value, truncated (at most 1 unit above exact)
+ * @date  16.10.2026
+ ******************************************************************************/
+RV_STATIC_FORCE_INLINE uint32_t Clock_Scale32(uint32_t value, uint32_t fint, uint32_t ffrac)
+{
+  uint32_t ulResult = value * fint;
+  if (ffrac != 0) ulResult += (uint32_t)(((uint64_t)value * ffrac) >> 32);
+  return ulResult;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Scale 64-bit value by a fixed-point factor
+ *
+ * @note
+ * The result is never below the exact truncated product. As the fraction is
+ * rounded up (CLOCK_FACTOR_FRAC()), it exceeds it by less than 1 unit per
+ * 2^32 of value, i.e. by at most ceil(value / 2^32) units: 1 unit below 2^32,
+ * e.g. 86 ns for Clock_TicksToNs() of 2^40 ticks at 6 MHz (bound: 256 ns).
+ * Factors with an exact Q32 fraction have no error.
+ *
+ * @param[in] value       Value to scale
+ * @param[in] fint        Integer part of the factor
+ * @param[in] ffrac       Q32 fractional part of the factor
+ * @return  (uint64_t)  Scaled value, truncated
+ * @date  16.10.2026
+ ******************************************************************************/
+RV_STATIC_FORCE_INLINE uint64_t Clock_Scale64(uint64_t value, uint32_t fint, uint32_t ffrac)
+{
+  uint64_t ullResult = value * fint;
+  if (ffrac != 0)
+  {
+    ullResult += (uint64_t)(value >> 32) * ffrac;
+    ullResult += ((uint64_t)(uint32_t)value * ffrac) >> 32;
+  }
+  return ullResult;
+}
+
+/* Conversion helpers, specialised for the configured clocks                  */
+#define Clock_TicksToUs(t)            Clock_Scale64((t), CLOCK_FACTOR_INT(1000000UL, CLOCK_SYSTICK_HZ), \
+                                                         CLOCK_FACTOR_FRAC(1000000UL, CLOCK_SYSTICK_HZ))
+#define Clock_TicksToNs(t)            Clock_Scale64((t), CLOCK_FACTOR_INT(1000000000UL, CLOCK_SYSTICK_HZ), \
+                                                         CLOCK_FACTOR_FRAC(1000000000UL, CLOCK_SYSTICK_HZ))
+#define Clock_UsToTicks(us)           Clock_Scale64((us), CLOCK_FACTOR_INT(CLOCK_SYSTICK_HZ, 1000000UL), \
+                                                          CLOCK_FACTOR_FRAC(CLOCK_SYSTICK_HZ, 1000000UL))
+#define Clock_NsToTicks(ns)           Clock_Scale64((ns), CLOCK_FACTOR_INT(CLOCK_SYSTICK_HZ, 1000000000UL), \
+                                                          CLOCK_FACTOR_FRAC(CLOCK_SYSTICK_HZ, 1000000000UL))
+#define Clock_UsToTicks32(us)         Clock_Scale32((us), CLOCK_FACTOR_INT(CLOCK_SYSTICK_HZ, 1000000UL), \
+                                                          CLOCK_FACTOR_FRAC(CLOCK_SYSTICK_HZ, 1000000UL))
+#define Clock_CyclesToNs(c)           Clock_Scale64((c), CLOCK_FACTOR_INT(1000000000UL, CLOCK_CORE_HZ), \
+                                                         CLOCK_FACTOR_FRAC(1000000000UL, CLOCK_CORE_HZ))
+#define Clock_UsToCycles32(us)        Clock_Scale32((us), CLOCK_FACTOR_INT(CLOCK_CORE_HZ, 1000000UL), \
+                                                          CLOCK_FACTOR_FRAC(CLOCK_CORE_HZ, 1000000UL))
+
+/*!****************************************************************************
+ * @brief
+ * Initialise monotonic timebase
+ *
+ * Starts SysTick in free-running mode if it is not running yet. A running
+ * SysTick (e.g. set up by the tickless timebase) is left untouched.
+ *
+ * @note
+ * The 64-bit extension detects CNTR wraps on read, so the clock must be read
+ * at least once per 2^32 SysTick counts (e.g. using Clock_GetTicks64() from a
+ * periodic timer).
+ *
+ * @date  16.10.2026
+ ******************************************************************************/
+void Clock_Init(void);
+
+/*!****************************************************************************
+ * @brief
+ * Get 64-bit monotonic SysTick count
+ *
+ * @return  (uint64_t)  SysTick counts since Clock_Init()
+ * @date  16.10.2026
+ ******************************************************************************/
+uint64_t Clock_GetTicks64(void);
+
+/*!****************************************************************************
+ * @brief
+ * Get 64-bit monotonic time in microseconds
+ *
+ * @return  (uint64_t)  Microseconds since Clock_Init()
+ * @date  16.10.2026
+ ******************************************************************************/
+RV_STATIC_INLINE uint64_t Clock_GetUs64(void)
+{
+  return Clock_TicksToUs(Clock_GetTicks64());
+}
+
+/*!****************************************************************************
+ * @brief
+ * Get 64-bit monotonic time in nanoseconds
+ *
+ * @return  (uint64_t)  Nanoseconds since Clock_Init()
+ * @date  16.10.2026
+ ******************************************************************************/
+RV_STATIC_INLINE uint64_t Clock_GetNs64(void)
+{
+  return Clock_TicksToNs(Clock_GetTicks64());
+}
+
+/*!****************************************************************************
+ * @brief
+ * Measure the fixed overhead of Clock_DelayCycles()
+ *
+ * @return  (uint32_t)  Overhead in cycles, subtracted from subsequent delays
+ * @date  16.10.2026
+ ******************************************************************************/
+uint32_t Clock_Calibrate(void);
+
+/*!****************************************************************************
+ * @brief
+ * Busy-wait for a number of core cycles (mcycle based)
+ *
+ * @param[in] cycles      Delay in cycles, including call overhead
+ * @date  16.10.2026
+ ******************************************************************************/
+void Clock_DelayCycles(uint32_t cycles);
+
+/*!****************************************************************************
+ * @brief
+ * Busy-wait for a number of SysTick counts
+ *
+ * @param[in] ticks       Delay in SysTick counts (less than 2^31)
+ * @date  16.10.2026
+ ******************************************************************************/
+RV_STATIC_INLINE void Clock_DelayTicks(uint32_t ticks)
+{
+  uint32_t ulStart = SysTick_GetValue();
+  while ((SysTick_GetValue() - ulStart) < ticks);
+}
+
+/*!****************************************************************************
+ * @brief
+ * Busy-wait for a number of microseconds
+ *
+ * Short delays use the calibrated cycle counter for resolution, longer ones
+ * the SysTick counter. Both measure elapsed time, so interrupts taken during
+ * the delay only extend it if they are still running at its end.
+ *
+ * @param[in] us          Delay in microseconds
+ * @date  16.10.2026
+ ******************************************************************************/
+RV_STATIC_INLINE void Clock_DelayUs(uint32_t us)
+{
+  if (us < 100UL) Clock_DelayCycles(Clock_UsToCycles32(us));
+  else Clock_DelayTicks(Clock_UsToTicks32(us));
+}
+
+#endif /* CORE_RISCV_CLOCK_H_ */
@@ -0,0 +1,389 @@
+/*!****************************************************************************
+ * @file
+ * core_riscv_crc.c
+ *
+ * @brief
+ * RISC-V2A CRC-8/16/32 Kernels
+ *
+ * @note
+ * Build with RV_DEVICE_HEADER set to the device header, which includes
+ * core_riscv.h (e.g. -DRV_DEVICE_HEADER=\"ch32v00x.h\").
+ *
+ * @date  16.10.2026
+ ******************************************************************************/
+
+#include RV_DEVICE_HEADER
+#include "core_riscv_crc.h"
+
+/* ################################ CRC-8 ################################### */
+/* CRC of the high nibble value i (low nibble zero)                           */
+static const uint8_t aucCrc8Nibble[16] = {
+  0x00U, 0x07U, 0x0EU, 0x09U, 0x1CU, 0x1BU, 0x12U, 0x15U,
+  0x38U, 0x3FU, 0x36U, 0x31U, 0x24U, 0x23U, 0x2AU, 0x2DU
+};
+
+/* CRC of the byte value i                                                    */
+static const uint8_t aucCrc8Table[256] = {
+  0x00U, 0x07U, 0x0EU, 0x09U, 0x1CU, 0x1BU, 0x12U, 0x15U,
+  0x38U, 0x3FU, 0x36U, 0x31U, 0x24U, 0x23U, 0x2AU, 0x2DU,
+  0x70U, 0x77U, 0x7EU, 0x79U, 0x6CU, 0x6BU, 0x62U, 0x65U,
+  0x48U, 0x4FU, 0x46U, 0x41U, 0x54U, 0x53U, 0x5AU, 0x5DU,
+  0xE0U, 0xE7U, 0xEEU, 0xE9U, 0xFCU, 0xFBU, 0xF2U, 0xF5U,
+  0xD8U, 0xDFU, 0xD6U, 0xD1U, 0xC4U, 0xC3U, 0xCAU, 0xCDU,
+  0x90U, 0x97U, 0x9EU, 0x99U, 0x8CU, 0x8BU, 0x82U, 0x85U,
+  0xA8U, 0xAFU, 0xA6U, 0xA1U, 0xB4U, 0xB3U, 0xBAU, 0xBDU,
+  0xC7U, 0xC0U, 0xC9U, 0xCEU, 0xDBU, 0xDCU, 0xD5U, 0xD2U,
+  0xFFU, 0xF8U, 0xF1U, 0xF6U, 0xE3U, 0xE4U, 0xEDU, 0xEAU,
+  0xB7U, 0xB0U, 0xB9U, 0xBEU, 0xABU, 0xACU, 0xA5U, 0xA2U,
+  0x8FU, 0x88U, 0x81U, 0x86U, 0x93U, 0x94U, 0x9DU, 0x9AU,
+  0x27U, 0x20U, 0x29U, 0x2EU, 0x3BU, 0x3CU, 0x35U, 0x32U,
+  0x1FU, 0x18U, 0x11U, 0x16U, 0x03U, 0x04U, 0x0DU, 0x0AU,
+  0x57U, 0x50U, 0x59U, 0x5EU, 0x4BU, 0x4CU, 0x45U, 0x42U,
+  0x6FU, 0x68U, 0x61U, 0x66U, 0x73U, 0x74U, 0x7DU, 0x7AU,
+  0x89U, 0x8EU, 0x87U, 0x80U, 0x95U, 0x92U, 0x9BU, 0x9CU,
+  0xB1U, 0xB6U, 0xBFU, 0xB8U, 0xADU, 0xAAU, 0xA3U, 0xA4U,
+  0xF9U, 0xFEU, 0xF7U, 0xF0U, 0xE5U, 0xE2U, 0xEBU, 0xECU,
+  0xC1U, 0xC6U, 0xCFU, 0xC8U, 0xDDU, 0xDAU, 0xD3U, 0xD4U,
+  0x69U, 0x6EU, 0x67U, 0x60U, 0x75U, 0x72U, 0x7BU, 0x7CU,
+  0x51U, 0x56U, 0x5FU, 0x58U, 0x4DU, 0x4AU, 0x43U, 0x44U,
+  0x19U, 0x1EU, 0x17U, 0x10U, 0x05U, 0x02U, 0x0BU, 0x0CU,
+  0x21U, 0x26U, 0x2FU, 0x28U, 0x3DU, 0x3AU, 0x33U, 0x34U,
+  0x4EU, 0x49U, 0x40U, 0x47U, 0x52U, 0x55U, 0x5CU, 0x5BU,
+  0x76U, 0x71U, 0x78U, 0x7FU, 0x6AU, 0x6DU, 0x64U, 0x63U,
+  0x3EU, 0x39U, 0x30U, 0x37U, 0x22U, 0x25U, 0x2CU, 0x2BU,
+  0x06U, 0x01U, 0x08U, 0x0FU, 0x1AU, 0x1DU, 0x14U, 0x13U,
+  0xAEU, 0xA9U, 0xA0U, 0xA7U, 0xB2U, 0xB5U, 0xBCU, 0xBBU,
+  0x96U, 0x91U, 0x98U, 0x9FU, 0x8AU, 0x8DU, 0x84U, 0x83U,
+  0xDEU, 0xD9U, 0xD0U, 0xD7U, 0xC2U, 0xC5U, 0xCCU, 0xCBU,
+  0xE6U, 0xE1U, 0xE8U, 0xEFU, 0xFAU, 0xFDU, 0xF4U, 0xF3U
+};
+
+/*!****************************************************************************
+ * @brief
+ * Update CRC-8, bitwise
+ *
+ * @param[in] crc         Running CRC value
+ * @param[in] data        Data
+ * @param[in] len         Number of bytes
+ * @return  (uint8_t)  Updated CRC value
+ * @date  16.10.2026
+ ******************************************************************************/
+uint8_t Crc8_UpdateBitwise(uint8_t crc, const void* data, size_t len)
+{
+  const uint8_t* pucData = data;
+  uint32_t ulCrc = crc;
+
+  while (len-- != 0)
+  {
+    ulCrc ^= *pucData++;
+    for (uint32_t i = 0; i < 8U; ++i)
+    {
+      ulCrc = (ulCrc << 1) ^ ((ulCrc & 0x80U) ? 0x07U : 0U);
+    }
+    ulCrc &= 0xFFU;
+  }
+  return (uint8_t)ulCrc;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Update CRC-8, nibble table
+ *
+ * @param[in] crc         Running CRC value
+ * @param[in] data        Data
+ * @param[in] len         Number of bytes
+ * @return  (uint8_t)  Updated CRC value
+ * @date  16.10.2026
+ ******************************************************************************/
+uint8_t Crc8_UpdateNibble(uint8_t crc, const void* data, size_t len)
+{
+  const uint8_t* pucData = data;
+  uint32_t ulCrc = crc;
+
+  while (len-- != 0)
+  {
+    ulCrc ^= *pucData++;
+    ulCrc = ((ulCrc << 4) & 0xF0U) ^ aucCrc8Nibble[ulCrc >> 4];
+    ulCrc = ((ulCrc << 4) & 0xF0U) ^ aucCrc8Nibble[ulCrc >> 4];
+  }
+  return (uint8_t)ulCrc;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Update CRC-8, byte table
+ *
+ * @param[in] crc         Running CRC value
+ * @param[in] data        Data
+ * @param[in] len         Number of bytes
+ * @return  (uint8_t)  Updated CRC value
+ * @date  16.10.2026
+ ******************************************************************************/
+uint8_t Crc8_UpdateTable(uint8_t crc, const void* data, size_t len)
+{
+  const uint8_t* pucData = data;
+  uint32_t ulCrc = crc;
+
+  while (len-- != 0) ulCrc = aucCrc8Table[ulCrc ^ *pucData++];
+  return (uint8_t)ulCrc;
+}
+
+/* ############################### CRC-16 ################################### */
+/* CRC of the nibble value i in the top four register bits                    */
+static const uint16_t ausCrc16Nibble[16] = {
+  0x0000U, 0x1021U, 0x2042U, 0x3063U, 0x4084U, 0x50A5U, 0x60C6U, 0x70E7U,
+  0x8108U, 0x9129U, 0xA14AU, 0xB16BU, 0xC18CU, 0xD1ADU, 0xE1CEU, 0xF1EFU
+};
+
+/* CRC of the byte value i in the top eight register bits                     */
+static const uint16_t ausCrc16Table[256] = {
+  0x0000U, 0x1021U, 0x2042U, 0x3063U, 0x4084U, 0x50A5U, 0x60C6U, 0x70E7U,
+  0x8108U, 0x9129U, 0xA14AU, 0xB16BU, 0xC18CU, 0xD1ADU, 0xE1CEU, 0xF1EFU,
+  0x1231U, 0x0210U, 0x3273U, 0x2252U, 0x52B5U, 0x4294U, 0x72F7U, 0x62D6U,
+  0x9339U, 0x8318U, 0xB37BU, 0xA35AU, 0xD3BDU, 0xC39CU, 0xF3FFU, 0xE3DEU,
+  0x2462U, 0x3443U, 0x0420U, 0x1401U, 0x64E6U, 0x74C7U, 0x44A4U, 0x5485U,
+  0xA56AU, 0xB54BU, 0x8528U, 0x9509U, 0xE5EEU, 0xF5CFU, 0xC5ACU, 0xD58DU,
+  0x3653U, 0x2672U, 0x1611U, 0x0630U, 0x76D7U, 0x66F6U, 0x5695U, 0x46B4U,
+  0xB75BU, 0xA77AU, 0x9719U, 0x8738U, 0xF7DFU, 0xE7FEU, 0xD79DU, 0xC7BCU,
+  0x48C4U, 0x58E5U, 0x6886U, 0x78A7U, 0x0840U, 0x1861U, 0x2802U, 0x3823U,
+  0xC9CCU, 0xD9EDU, 0xE98EU, 0xF9AFU, 0x8948U, 0x9969U, 0xA90AU, 0xB92BU,
+  0x5AF5U, 0x4AD4U, 0x7AB7U, 0x6A96U, 0x1A71U, 0x0A50U, 0x3A33U, 0x2A12U,
+  0xDBFDU, 0xCBDCU, 0xFBBFU, 0xEB9EU, 0x9B79U, 0x8B58U, 0xBB3BU, 0xAB1AU,
+  0x6CA6U, 0x7C87U, 0x4CE4U, 0x5CC5U, 0x2C22U, 0x3C03U, 0x0C60U, 0x1C41U,
+  0xEDAEU, 0xFD8FU, 0xCDECU, 0xDDCDU, 0xAD2AU, 0xBD0BU, 0x8D68U, 0x9D49U,
+  0x7E97U, 0x6EB6U, 0x5ED5U, 0x4EF4U, 0x3E13U, 0x2E32U, 0x1E51U, 0x0E70U,
+  0xFF9FU, 0xEFBEU, 0xDFDDU, 0xCFFCU, 0xBF1BU, 0xAF3AU, 0x9F59U, 0x8F78U,
+  0x9188U, 0x81A9U, 0xB1CAU, 0xA1EBU, 0xD10CU, 0xC12DU, 0xF14EU, 0xE16FU,
+  0x1080U, 0x00A1U, 0x30C2U, 0x20E3U, 0x5004U, 0x4025U, 0x7046U, 0x6067U,
+  0x83B9U, 0x9398U, 0xA3FBU, 0xB3DAU, 0xC33DU, 0xD31CU, 0xE37FU, 0xF35EU,
+  0x02B1U, 0x1290U, 0x22F3U, 0x32D2U, 0x4235U, 0x5214U, 0x6277U, 0x7256U,
+  0xB5EAU, 0xA5CBU, 0x95A8U, 0x8589U, 0xF56EU, 0xE54FU, 0xD52CU, 0xC50DU,
+  0x34E2U, 0x24C3U, 0x14A0U, 0x0481U, 0x7466U, 0x6447U, 0x5424U, 0x4405U,
+  0xA7DBU, 0xB7FAU, 0x8799U, 0x97B8U, 0xE75FU, 0xF77EU, 0xC71DU, 0xD73CU,
+  0x26D3U, 0x36F2U, 0x0691U, 0x16B0U, 0x6657U, 0x7676U, 0x4615U, 0x5634U,
+  0xD94CU, 0xC96DU, 0xF90EU, 0xE92FU, 0x99C8U, 0x89E9U, 0xB98AU, 0xA9ABU,
+  0x5844U, 0x4865U, 0x7806U, 0x6827U, 0x18C0U, 0x08E1U, 0x3882U, 0x28A3U,
+  0xCB7DU, 0xDB5CU, 0xEB3FU, 0xFB1EU, 0x8BF9U, 0x9BD8U, 0xABBBU, 0xBB9AU,
+  0x4A75U, 0x5A54U, 0x6A37U, 0x7A16U, 0x0AF1U, 0x1AD0U, 0x2AB3U, 0x3A92U,
+  0xFD2EU, 0xED0FU, 0xDD6CU, 0xCD4DU, 0xBDAAU, 0xAD8BU, 0x9DE8U, 0x8DC9U,
+  0x7C26U, 0x6C07U, 0x5C64U, 0x4C45U, 0x3CA2U, 0x2C83U, 0x1CE0U, 0x0CC1U,
+  0xEF1FU, 0xFF3EU, 0xCF5DU, 0xDF7CU, 0xAF9BU, 0xBFBAU, 0x8FD9U, 0x9FF8U,
+  0x6E17U, 0x7E36U, 0x4E55U, 0x5E74U, 0x2E93U, 0x3EB2U, 0x0ED1U, 0x1EF0U
+};
+
+/*!****************************************************************************
+ * @brief
+ * Update CRC-16, bitwise
+ *
+ * @param[in] crc         Running CRC value
+ * @param[in] data        Data
+ * @param[in] len         Number of bytes
+ * @return  (uint16_t)  Updated CRC value
+ * @date  16.10.2026
+ ******************************************************************************/
+uint16_t Crc16_UpdateBitwise(uint16_t crc, const void* data, size_t len)
+{
+  const uint8_t* pucData = data;
+  uint32_t ulCrc = crc;
+
+  while (len-- != 0)
+  {
+    ulCrc ^= (uint32_t)*pucData++ << 8;
+    for (uint32_t i = 0; i < 8U; ++i)
+    {
+      ulCrc = (ulCrc << 1) ^ ((ulCrc & 0x8000U) ? 0x1021U : 0U);
+    }
+    ulCrc &= 0xFFFFU;
+  }
+  return (uint16_t)ulCrc;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Update CRC-16, nibble table
+ *
+ * @param[in] crc         Running CRC value
+ * @param[in] data        Data
+ * @param[in] len         Number of bytes
+ * @return  (uint16_t)  Updated CRC value
+ * @date  16.10.2026
+ ******************************************************************************/
+uint16_t Crc16_UpdateNibble(uint16_t crc, const void* data, size_t len)
+{
+  const uint8_t* pucData = data;
+  uint32_t ulCrc = crc;
+
+  while (len-- != 0)
+  {
+    uint32_t ulByte = *pucData++;
+    ulCrc = ((ulCrc << 4) & 0xFFF0U) ^ ausCrc16Nibble[(ulCrc >> 12) ^ (ulByte >> 4)];
+    ulCrc = ((ulCrc << 4) & 0xFFF0U) ^ ausCrc16Nibble[(ulCrc >> 12) ^ (ulByte & 0xFU)];
+  }
+  return (uint16_t)ulCrc;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Update CRC-16, byte table
+ *
+ * @param[in] crc         Running CRC value
+ * @param[in] data        Data
+ * @param[in] len         Number of bytes
+ * @return  (uint16_t)  Updated CRC value
+ * @date  16.10.2026
+ ******************************************************************************/
+uint16_t Crc16_UpdateTable(uint16_t crc, const void* data, size_t len)
+{
+  const uint8_t* pucData = data;
+  uint32_t ulCrc = crc;
+
+  while (len-- != 0)
+  {
+    ulCrc = ((ulCrc << 8) & 0xFF00U) ^ ausCrc16Table[(ulCrc >> 8) ^ *pucData++];
+  }
+  return (uint16_t)ulCrc;
+}
+
+/* ############################### CRC-32 ################################### */
+/* CRC of the nibble value i in the low four register bits (reflected)        */
+static const uint32_t aulCrc32Nibble[16] = {
+  0x00000000UL, 0x1DB71064UL, 0x3B6E20C8UL, 0x26D930ACUL,
+  0x76DC4190UL, 0x6B6B51F4UL, 0x4DB26158UL, 0x5005713CUL,
+  0xEDB88320UL, 0xF00F9344UL, 0xD6D6A3E8UL, 0xCB61B38CUL,
+  0x9B64C2B0UL, 0x86D3D2D4UL, 0xA00AE278UL, 0xBDBDF21CUL
+};
+
+/* CRC of the byte value i in the low eight register bits (reflected)         */
+static const uint32_t aulCrc32Table[256] = {
+  0x00000000UL, 0x77073096UL, 0xEE0E612CUL, 0x990951BAUL,
+  0x076DC419UL, 0x706AF48FUL, 0xE963A535UL, 0x9E6495A3UL,
+  0x0EDB8832UL, 0x79DCB8A4UL, 0xE0D5E91EUL, 0x97D2D988UL,
+  0x09B64C2BUL, 0x7EB17CBDUL, 0xE7B82D07UL, 0x90BF1D91UL,
+  0x1DB71064UL, 0x6AB020F2UL, 0xF3B97148UL, 0x84BE41DEUL,
+  0x1ADAD47DUL, 0x6DDDE4EBUL, 0xF4D4B551UL, 0x83D385C7UL,
+  0x136C9856UL, 0x646BA8C0UL, 0xFD62F97AUL, 0x8A65C9ECUL,
+  0x14015C4FUL, 0x63066CD9UL, 0xFA0F3D63UL, 0x8D080DF5UL,
+  0x3B6E20C8UL, 0x4C69105EUL, 0xD56041E4UL, 0xA2677172UL,
+  0x3C03E4D1UL, 0x4B04D447UL, 0xD20D85FDUL, 0xA50AB56BUL,
+  0x35B5A8FAUL, 0x42B2986CUL, 0xDBBBC9D6UL, 0xACBCF940UL,
+  0x32D86CE3UL, 0x45DF5C75UL, 0xDCD60DCFUL, 0xABD13D59UL,
+  0x26D930ACUL, 0x51DE003AUL, 0xC8D75180UL, 0xBFD06116UL,
+  0x21B4F4B5UL, 0x56B3C423UL, 0xCFBA9599UL, 0xB8BDA50FUL,
+  0x2802B89EUL, 0x5F058808UL, 0xC60CD9B2UL, 0xB10BE924UL,
+  0x2F6F7C87UL, 0x58684C11UL, 0xC1611DABUL, 0xB6662D3DUL,
+  0x76DC4190UL, 0x01DB7106UL, 0x98D220BCUL, 0xEFD5102AUL,
+  0x71B18589UL, 0x06B6B51FUL, 0x9FBFE4A5UL, 0xE8B8D433UL,
+  0x7807C9A2UL, 0x0F00F934UL, 0x9609A88EUL, 0xE10E9818UL,
+  0x7F6A0DBBUL, 0x086D3D2DUL, 0x91646C97UL, 0xE6635C01UL,
+  0x6B6B51F4UL, 0x1C6C6162UL, 0x856530D8UL, 0xF262004EUL,
+  0x6C0695EDUL, 0x1B01A57BUL, 0x8208F4C1UL, 0xF50FC457UL,
+  0x65B0D9C6UL, 0x12B7E950UL, 0x8BBEB8EAUL, 0xFCB9887CUL,
+  0x62DD1DDFUL, 0x15DA2D49UL, 0x8CD37CF3UL, 0xFBD44C65UL,
+  0x4DB26158UL, 0x3AB551CEUL, 0xA3BC0074UL, 0xD4BB30E2UL,
+  0x4ADFA541UL, 0x3DD895D7UL, 0xA4D1C46DUL, 0xD3D6F4FBUL,
+  0x4369E96AUL, 0x346ED9FCUL, 0xAD678846UL, 0xDA60B8D0UL,
+  0x44042D73UL, 0x33031DE5UL, 0xAA0A4C5FUL, 0xDD0D7CC9UL,
+  0x5005713CUL, 0x270241AAUL, 0xBE0B1010UL, 0xC90C2086UL,
+  0x5768B525UL, 0x206F85B3UL, 0xB966D409UL, 0xCE61E49FUL,
+  0x5EDEF90EUL, 0x29D9C998UL, 0xB0D09822UL, 0xC7D7A8B4UL,
+  0x59B33D17UL, 0x2EB40D81UL, 0xB7BD5C3BUL, 0xC0BA6CADUL,
+  0xEDB88320UL, 0x9ABFB3B6UL, 0x03B6E20CUL, 0x74B1D29AUL,
+  0xEAD54739UL, 0x9DD277AFUL, 0x04DB2615UL, 0x73DC1683UL,
+  0xE3630B12UL, 0x94643B84UL, 0x0D6D6A3EUL, 0x7A6A5AA8UL,
+  0xE40ECF0BUL, 0x9309FF9DUL, 0x0A00AE27UL, 0x7D079EB1UL,
+  0xF00F9344UL, 0x8708A3D2UL, 0x1E01F268UL, 0x6906C2FEUL,
+  0xF762575DUL, 0x806567CBUL, 0x196C3671UL, 0x6E6B06E7UL,
+  0xFED41B76UL, 0x89D32BE0UL, 0x10DA7A5AUL, 0x67DD4ACCUL,
+  0xF9B9DF6FUL, 0x8EBEEFF9UL, 0x17B7BE43UL, 0x60B08ED5UL,
+  0xD6D6A3E8UL, 0xA1D1937EUL, 0x38D8C2C4UL, 0x4FDFF252UL,
+  0xD1BB67F1UL, 0xA6BC5767UL, 0x3FB506DDUL, 0x48B2364BUL,
+  0xD80D2BDAUL, 0xAF0A1B4CUL, 0x36034AF6UL, 0x41047A60UL,
+  0xDF60EFC3UL, 0xA867DF55UL, 0x316E8EEFUL, 0x4669BE79UL,
+  0xCB61B38CUL, 0xBC66831AUL, 0x256FD2A0UL, 0x5268E236UL,
+  0xCC0C7795UL, 0xBB0B4703UL, 0x220216B9UL, 0x5505262FUL,
+  0xC5BA3BBEUL, 0xB2BD0B28UL, 0x2BB45A92UL, 0x5CB36A04UL,
+  0xC2D7FFA7UL, 0xB5D0CF31UL, 0x2CD99E8BUL, 0x5BDEAE1DUL,
+  0x9B64C2B0UL, 0xEC63F226UL, 0x756AA39CUL, 0x026D930AUL,
+  0x9C0906A9UL, 0xEB0E363FUL, 0x72076785UL, 0x05005713UL,
+  0x95BF4A82UL, 0xE2B87A14UL, 0x7BB12BAEUL, 0x0CB61B38UL,
+  0x92D28E9BUL, 0xE5D5BE0DUL, 0x7CDCEFB7UL, 0x0BDBDF21UL,
+  0x86D3D2D4UL, 0xF1D4E242UL, 0x68DDB3F8UL, 0x1FDA836EUL,
+  0x81BE16CDUL, 0xF6B9265BUL, 0x6FB077E1UL, 0x18B74777UL,
+  0x88085AE6UL, 0xFF0F6A70UL, 0x66063BCAUL, 0x11010B5CUL,
+  0x8F659EFFUL, 0xF862AE69UL, 0x616BFFD3UL, 0x166CCF45UL,
+  0xA00AE278UL, 0xD70DD2EEUL, 0x4E048354UL, 0x3903B3C2UL,
+  0xA7672661UL, 0xD06016F7UL, 0x4969474DUL, 0x3E6E77DBUL,
+  0xAED16A4AUL, 0xD9D65ADCUL, 0x40DF0B66UL, 0x37D83BF0UL,
+  0xA9BCAE53UL, 0xDEBB9EC5UL, 0x47B2CF7FUL, 0x30B5FFE9UL,
+  0xBDBDF21CUL, 0xCABAC28AUL, 0x53B39330UL, 0x24B4A3A6UL,
+  0xBAD03605UL, 0xCDD70693UL, 0x54DE5729UL, 0x23D967BFUL,
+  0xB3667A2EUL, 0xC4614AB8UL, 0x5D681B02UL, 0x2A6F2B94UL,
+  0xB40BBE37UL, 0xC30C8EA1UL, 0x5A05DF1BUL, 0x2D02EF8DUL
+};
+
+/*!****************************************************************************
+ * @brief
+ * Update CRC-32, bitwise
+ *
+ * @param[in] crc         Running CRC register value (not final-XORed)
+ * @param[in] data        Data
+ * @param[in] len         Number of bytes
+ * @return  (uint32_t)  Updated CRC register value
+ * @date  16.10.2026
+ ******************************************************************************/
+uint32_t Crc32_UpdateBitwise(uint32_t crc, const void* data, size_t len)
+{
+  const uint8_t* pucData = data;
+
+  while (len-- != 0)
+  {
+    crc ^= *pucData++;
+    for (uint32_t i = 0; i < 8U; ++i)
+    {
+      /* Branch-free: 0 - (crc & 1) is the polynomial mask, no multiply    */
+      crc = (crc >> 1) ^ (0xEDB88320UL & (0UL - (crc & 1UL)));
+    }
+  }
+  return crc;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Update CRC-32, nibble table
+ *
+ * @param[in] crc         Running CRC register value (not final-XORed)
+ * @param[in] data        Data
+ * @param[in] len         Number of bytes
+ * @return  (uint32_t)  Updated CRC register value
+ * @date  16.10.2026
+ ******************************************************************************/
+uint32_t Crc32_UpdateNibble(uint32_t crc, const void* data, size_t len)
+{
+  const uint8_t* pucData = data;
+
+  while (len-- != 0)
+  {
+    crc ^= *pucData++;
+    crc = (crc >> 4) ^ aulCrc32Nibble[crc & 0xFU];
+    crc = (crc >> 4) ^ aulCrc32Nibble[crc & 0xFU];
+  }
+  return crc;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Update CRC-32, byte table
+ *
+ * @param[in] crc         Running CRC register value (not final-XORed)
+ * @param[in] data        Data
+ * @param[in] len         Number of bytes
+ * @return  (uint32_t)  Updated CRC register value
+ * @date  16.10.2026
+ ******************************************************************************/
+uint32_t Crc32_UpdateTable(uint32_t crc, const void* data, size_t len)
+{
+  const uint8_t* pucData = data;
+
+  while (len-- != 0) crc = (crc >> 8) ^ aulCrc32Table[(crc ^ *pucData++) & 0xFFU];
+  return crc;
+}
@@ -0,0 +1,139 @@
+/*!****************************************************************************
+ * @file
+ * core_riscv_crc.h
+ *
+ * @brief
+ * RISC-V2A CRC-8/16/32 Kernels
+ *
+ * Supported algorithms (check value of "123456789" in brackets):
+ *  - CRC-8/SMBUS         poly 0x07, init 0x00, not reflected       (0xF4)
+ *  - CRC-16/CCITT-FALSE  poly 0x1021, init 0xFFFF, not reflected   (0x29B1)
+ *  - CRC-32 (IEEE 802.3) poly 0x04C11DB7, reflected, init/xorout
+ *                        0xFFFFFFFF                                (0xCBF43926)
+ *
+ * Each comes in three variants, trading flash for speed:
+ *  - Bitwise  no table, eight shift steps per byte
+ *  - Nibble   16-entry table, two lookups per byte
+ *  - Table    256-entry table, one lookup per byte
+ *
+ * Flash for the tables, CRC-8/16/32: nibble 16/32/64 bytes, table
+ * 256/512/1024 bytes. CRC_MODE selects the variant behind CrcN_Update();
+ * with -ffunction-sections/-fdata-sections unused variants are discarded.
+ *
+ * CrcN_Update() continues a running CRC register value, so data may be
+ * processed in pieces: start with CRCN_INIT, apply CrcN_Final() at the end.
+ *
+ * @date  16.10.2026
+ ******************************************************************************/
+
+#ifndef CORE_RISCV_CRC_H_
+#define CORE_RISCV_CRC_H_
+
+#ifndef CORE_RISCV_H_
+#error "core_riscv.h must be included (via the device header) first"
+#endif /* CORE_RISCV_H_ */
+
+#include <stddef.h>
+
+/* Variant selection                                                          */
+#define CRC_MODE_BITWISE              0U
+#define CRC_MODE_NIBBLE               1U
+#define CRC_MODE_TABLE                2U
+
+#ifndef CRC_MODE
+#define CRC_MODE                      CRC_MODE_NIBBLE
+#endif /* CRC_MODE */
+
+/* Initial register values                                                    */
+#define CRC8_INIT                     0x00U
+#define CRC16_INIT                    0xFFFFU
+#define CRC32_INIT                    0xFFFFFFFFUL
+
+/*!****************************************************************************
+ * @brief
+ * Update CRC-8, bitwise / nibble table / byte table
+ *
+ * @param[in] crc         Running CRC value
+ * @param[in] data        Data
+ * @param[in] len         Number of bytes
+ * @return  (uint8_t)  Updated CRC value
+ * @date  16.10.2026
+ ******************************************************************************/
+uint8_t Crc8_UpdateBitwise(uint8_t crc, const void* data, size_t len);
+uint8_t Crc8_UpdateNibble(uint8_t crc, const void* data, size_t len);
+uint8_t Crc8_UpdateTable(uint8_t crc, const void* data, size_t len);
+
+/*!****************************************************************************
+ * @brief
+ * Update CRC-16, bitwise / nibble table / byte table
+ *
+ * @param[in] crc         Running CRC value
+ * @param[in] data        Data
+ * @param[in] len         Number of bytes
+ * @return  (uint16_t)  Updated CRC value
+ * @date  16.10.2026
+ ******************************************************************************/
+uint16_t Crc16_UpdateBitwise(uint16_t crc, const void* data, size_t len);
+uint16_t Crc16_UpdateNibble(uint16_t crc, const void* data, size_t len);
+uint16_t Crc16_UpdateTable(uint16_t crc, const void* data, size_t len);
+
+/*!****************************************************************************
+ * @brief
+ * Update CRC-32, bitwise / nibble table / byte table
+ *
+ * @param[in] crc         Running CRC register value (not final-XORed)
+ * @param[in] data        Data
+ * @param[in] len         Number of bytes
+ * @return  (uint32_t)  Updated CRC register value
+ * @date  16.10.2026
+ ******************************************************************************/
+uint32_t Crc32_UpdateBitwise(uint32_t crc, const void* data, size_t len);
+uint32_t Crc32_UpdateNibble(uint32_t crc, const void* data, size_t len);
+uint32_t Crc32_UpdateTable(uint32_t crc, const void* data, size_t len);
+
+#if CRC_MODE == CRC_MODE_BITWISE
+#define Crc8_Update                   Crc8_UpdateBitwise
+#define Crc16_Update                  Crc16_UpdateBitwise
+#define Crc32_Update                  Crc32_UpdateBitwise
+#elif CRC_MODE == CRC_MODE_NIBBLE
+#define Crc8_Update                   Crc8_UpdateNibble
+#define Crc16_Update                  Crc16_UpdateNibble
+#define Crc32_Update                  Crc32_UpdateNibble
+#elif CRC_MODE == CRC_MODE_TABLE
+#define Crc8_Update                   Crc8_UpdateTable
+#define Crc16_Update                  Crc16_UpdateTable
+#define Crc32_Update                  Crc32_UpdateTable
+#else
+#error "CRC_MODE must be CRC_MODE_BITWISE, CRC_MODE_NIBBLE or CRC_MODE_TABLE"
+#endif /* CRC_MODE */
+
+/* Final output values                                                        */
+#define Crc8_Final(crc)               ((uint8_t)(crc))
+#define Crc16_Final(crc)              ((uint16_t)(crc))
+#define Crc32_Final(crc)              ((uint32_t)((crc) ^ 0xFFFFFFFFUL))
+
+/*!****************************************************************************
+ * @brief
+ * Compute CRC of a buffer in one call
+ *
+ * @param[in] data        Data
+ * @param[in] len         Number of bytes
+ * @return  CRC value
+ * @date  16.10.2026
+ ******************************************************************************/
+RV_STATIC_INLINE uint8_t Crc8(const void* data, size_t len)
+{
+  return Crc8_Final(Crc8_Update(CRC8_INIT, data, len));
+}
+
+RV_STATIC_INLINE uint16_t Crc16(const void* data, size_t len)
+{
+  return Crc16_Final(Crc16_Update(CRC16_INIT, data, len));
+}
+
+RV_STATIC_INLINE uint32_t Crc32(const void* data, size_t len)
+{
+  return Crc32_Final(Crc32_Update(CRC32_INIT, data, len));
+}
+
+#endif /* CORE_RISCV_CRC_H_ */
@@ -0,0 +1,256 @@
+/*!****************************************************************************
+ * @file
+ * core_riscv_exec.c
+ *
+ * @brief
+ * RISC-V2A Event-Driven Run-to-Completion Executor
+ *
+ * @note
+ * Build with RV_DEVICE_HEADER set to the device header, which includes
+ * core_riscv.h (e.g. -DRV_DEVICE_HEADER=\"ch32v00x.h\").
+ *
+ * @date  16.10.2026
+ ******************************************************************************/
+
+#include RV_DEVICE_HEADER
+#include "core_riscv_exec.h"
+
+#if (EXEC_EVENTS < 1U) || (EXEC_EVENTS > 32U)
+#error "EXEC_EVENTS must be within 1..32"
+#endif
+
+/* Pending events (bit n: event n) and mcycle of their first post             */
+static volatile uint32_t ulPending;
+static uint32_t aulPosted[EXEC_EVENTS];
+
+/* Event handlers                                                             */
+static Exec_Handler_t apfnHandler[EXEC_EVENTS];
+static void* apvArg[EXEC_EVENTS];
+
+/* Statistics, SysTick count at end of the last sleep                         */
+static Exec_Stats_t xStats;
+static uint32_t ulWake;
+
+/*!****************************************************************************
+ * @brief
+ * Get index of the lowest set bit (constant time, no multiply)
+ *
+ * @param[in] bitmap      Bitmap, non-zero
+ * @return  (uint32_t)  Bit index
+ * @date  16.10.2026
+ ******************************************************************************/
+static uint32_t prvLowestBit(uint32_t bitmap)
+{
+  uint32_t ulIdx = 0;
+
+#if EXEC_EVENTS > 16U
+  if ((bitmap & 0xFFFFUL) == 0) { ulIdx += 16U; bitmap >>= 16; }
+#endif
+#if EXEC_EVENTS > 8U
+  if ((bitmap & 0xFFUL) == 0) { ulIdx += 8U; bitmap >>= 8; }
+#endif
+  if ((bitmap & 0xFUL) == 0) { ulIdx += 4U; bitmap >>= 4; }
+  if ((bitmap & 0x3UL) == 0) { ulIdx += 2U; bitmap >>= 2; }
+  if ((bitmap & 0x1UL) == 0) { ulIdx += 1U; }
+  return ulIdx;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Initialise executor: clear events and handlers, enable SEVONPEND
+ *
+ * @date  16.10.2026
+ ******************************************************************************/
+void Exec_Init(void)
+{
+  uint32_t ulState = __disable_irq_save();
+
+  ulPending = 0;
+  for (uint32_t i = 0; i < EXEC_EVENTS; ++i)
+  {
+    apfnHandler[i] = NULL;
+    apvArg[i] = NULL;
+  }
+  Exec_ResetStats();
+
+  /* Pending interrupts wake WFE even while masked                          */
+  RV_REG_WRITE(PFIC->SCTLR, RV_REG_READ(PFIC->SCTLR) | PFIC_SCTLR_SEVONPEND);
+  __restore_irq(ulState);
+}
+
+/*!****************************************************************************
+ * @brief
+ * Set event handler
+ *
+ * @param[in] event       Event number (below EXEC_EVENTS), 0 is highest
+ * @param[in] handler     Event handler, NULL to ignore the event
+ * @param[in] arg         Handler argument
+ * @return  (ErrorStatus)  ERROR if event number out of range
+ * @date  16.10.2026
+ ******************************************************************************/
+ErrorStatus Exec_Register(uint8_t event, Exec_Handler_t handler, void* arg)
+{
+  uint32_t ulState;
+
+  if (event >= EXEC_EVENTS) return ERROR;
+
+  ulState = __disable_irq_save();
+  apfnHandler[event] = handler;
+  apvArg[event] = arg;
+  __restore_irq(ulState);
+  return SUCCESS;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Make event pending, also from interrupt handlers
+ *
+ * @param[in] event       Event number (below EXEC_EVENTS)
+ * @return  (ErrorStatus)  ERROR if event number out of range or already
+ *                         pending (post coalesced)
+ * @date  16.10.2026
+ ******************************************************************************/
+ErrorStatus Exec_Post(uint8_t event)
+{
+  uint32_t ulBit, ulNow, ulState;
+  ErrorStatus eResult = SUCCESS;
+
+  if (event >= EXEC_EVENTS) return ERROR;
+
+  ulBit = 1UL << event;
+  ulNow = __get_MCYCLE();
+  ulState = __disable_irq_save();
+
+  if (ulPending & ulBit)
+  {
+    xStats.ulCoalesced++;
+    eResult = ERROR;
+  }
+  else
+  {
+    aulPosted[event] = ulNow;
+    ulPending |= ulBit;
+    xStats.ulPosted++;
+  }
+  __restore_irq(ulState);
+  return eResult;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Run handlers of pending events until none is pending
+ *
+ * @return  (uint32_t)  Number of handlers run
+ * @date  16.10.2026
+ ******************************************************************************/
+uint32_t Exec_Dispatch(void)
+{
+  uint32_t ulCount = 0;
+
+  while (ulPending != 0)
+  {
+    uint32_t ulState = __disable_irq_save();
+    uint32_t ulEvent = prvLowestBit(ulPending);
+    uint32_t ulLatency = __get_MCYCLE() - aulPosted[ulEvent];
+    Exec_Handler_t pfnHandler = apfnHandler[ulEvent];
+    void* pvArg = apvArg[ulEvent];
+
+    /* Cleared before the handler runs, so it may post itself again         */
+    ulPending &= ~(1UL << ulEvent);
+    if (ulLatency > xStats.ulMaxLatency) xStats.ulMaxLatency = ulLatency;
+    __restore_irq(ulState);
+
+    if (pfnHandler != NULL) pfnHandler((uint8_t)ulEvent, pvArg);
+    ulCount++;
+  }
+
+  if (ulCount != 0)
+  {
+    xStats.ulDispatched += ulCount;
+    xStats.ulBatches++;
+    if (ulCount > xStats.ulMaxBatch) xStats.ulMaxBatch = ulCount;
+  }
+  return ulCount;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Sleep via Exec_Sleep() unless an event is pending
+ *
+ * @return  (FlagStatus)  SET if slept
+ * @date  16.10.2026
+ ******************************************************************************/
+FlagStatus Exec_Idle(void)
+{
+  FlagStatus eSlept = RESET;
+  uint32_t ulState = __disable_irq_save();
+  uint32_t ulStart;
+
+  /* Posts after this check leave their interrupt pending, which ends WFE   */
+  if (ulPending == 0)
+  {
+    ulStart = SysTick_GetValue();
+    xStats.ullBusyTicks += ulStart - ulWake;
+    Exec_Sleep();
+    ulWake = SysTick_GetValue();
+    xStats.ullIdleTicks += ulWake - ulStart;
+    xStats.ulSleeps++;
+    eSlept = SET;
+  }
+  __restore_irq(ulState);
+  return eSlept;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Executor main loop: dispatch events, sleep when idle
+ *
+ * @date  16.10.2026
+ ******************************************************************************/
+void Exec_Run(void)
+{
+  while (1)
+  {
+    (void)Exec_Dispatch();
+    (void)Exec_Idle();
+  }
+}
+
+/*!****************************************************************************
+ * @brief
+ * Get executor statistics
+ *
+ * @param[out] stats      Statistics
+ * @date  16.10.2026
+ ******************************************************************************/
+void Exec_GetStats(Exec_Stats_t* stats)
+{
+  uint32_t ulState = __disable_irq_save();
+  *stats = xStats;
+  __restore_irq(ulState);
+}
+
+/*!****************************************************************************
+ * @brief
+ * Reset executor statistics
+ *
+ * @date  16.10.2026
+ ******************************************************************************/
+void Exec_ResetStats(void)
+{
+  uint32_t ulState = __disable_irq_save();
+  xStats = (Exec_Stats_t){ 0 };
+  ulWake = SysTick_GetValue();
+  __restore_irq(ulState);
+}
+
+/*!****************************************************************************
+ * @brief
+ * Hook: enter sleep, called with interrupts masked and no event pending
+ *
+ * @date  16.10.2026
+ ******************************************************************************/
+RV_WEAK void Exec_Sleep(void)
+{
+  __WFE();
+}
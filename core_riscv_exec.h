@@ -0,0 +1,142 @@
+/*!****************************************************************************
+ * @file
+ * core_riscv_exec.h
+ *
+ * @brief
+ * RISC-V2A Event-Driven Run-to-Completion Executor
+ *
+ * Interrupt handlers post events with Exec_Post(); the main loop runs
+ * Exec_Run(), which dispatches the event handlers in priority order (event
+ * 0 is highest) and sleeps with WFE while no event is pending. Each handler
+ * runs to completion. Posting an event that is still pending is coalesced.
+ *
+ * No wakeup is lost: the final pending check and WFE run with interrupts
+ * masked, and PFIC_SCTLR_SEVONPEND makes an interrupt that became pending
+ * meanwhile wake WFE, so it is taken right after sleep ends.
+ *
+ * Dispatch latency is measured in core cycles (mcycle), busy and idle time
+ * in SysTick counts, since mcycle does not advance during sleep. SysTick
+ * must be running for the time counters (e.g. Clock_Init()).
+ *
+ * @date  16.10.2026
+ ******************************************************************************/
+
+#ifndef CORE_RISCV_EXEC_H_
+#define CORE_RISCV_EXEC_H_
+
+#ifndef CORE_RISCV_H_
+#error "core_riscv.h must be included (via the device header) first"
+#endif /* CORE_RISCV_H_ */
+
+#include <stddef.h>
+
+/* Number of events (1..32)                                                   */
+#ifndef EXEC_EVENTS
+#define EXEC_EVENTS                   16U
+#endif /* EXEC_EVENTS */
+
+/* Event handler, called from Exec_Dispatch()                                 */
+typedef void (*Exec_Handler_t)(uint8_t event, void* arg);
+
+/* Executor statistics                                                        */
+typedef struct {
+  uint32_t ulPosted;          /*!< Events made pending                        */
+  uint32_t ulCoalesced;       /*!< Posts merged into a pending event          */
+  uint32_t ulDispatched;      /*!< Handlers run                               */
+  uint32_t ulBatches;         /*!< Exec_Dispatch() calls that ran handlers    */
+  uint32_t ulMaxBatch;        /*!< Maximum handlers run in one batch          */
+  uint32_t ulMaxLatency;      /*!< Maximum post-to-dispatch time in cycles    */
+  uint32_t ulSleeps;          /*!< WFE sleeps                                 */
+  uint64_t ullBusyTicks;      /*!< SysTick counts between sleeps              */
+  uint64_t ullIdleTicks;      /*!< SysTick counts asleep                      */
+} Exec_Stats_t;
+
+/*!****************************************************************************
+ * @brief
+ * Initialise executor: clear events and handlers, enable SEVONPEND
+ *
+ * @date  16.10.2026
+ ******************************************************************************/
+void Exec_Init(void);
+
+/*!****************************************************************************
+ * @brief
+ * Set event handler
+ *
+ * @param[in] event       Event number (below EXEC_EVENTS), 0 is highest
+ * @param[in] handler     Event handler, NULL to ignore the event
+ * @param[in] arg         Handler argument
+ * @return  (ErrorStatus)  ERROR if event number out of range
+ * @date  16.10.2026
+ ******************************************************************************/
+ErrorStatus Exec_Register(uint8_t event, Exec_Handler_t handler, void* arg);
+
+/*!****************************************************************************
+ * @brief
+ * Make event pending, also from interrupt handlers
+ *
+ * @param[in] event       Event number (below EXEC_EVENTS)
+ * @return  (ErrorStatus)  ERROR if event number out of range or already
+ *                         pending (post coalesced)
+ * @date  16.10.2026
+ ******************************************************************************/
+ErrorStatus Exec_Post(uint8_t event);
+
+/*!****************************************************************************
+ * @brief
+ * Run handlers of pending events until none is pending
+ *
+ * The highest pending event is taken each time, so events posted by the
+ * running batch are served by priority as well.
+ *
+ * @return  (uint32_t)  Number of handlers run
+ * @date  16.10.2026
+ ******************************************************************************/
+uint32_t Exec_Dispatch(void);
+
+/*!****************************************************************************
+ * @brief
+ * Sleep via Exec_Sleep() unless an event is pending
+ *
+ * @return  (FlagStatus)  SET if slept
+ * @date  16.10.2026
+ ******************************************************************************/
+FlagStatus Exec_Idle(void);
+
+/*!****************************************************************************
+ * @brief
+ * Executor main loop: dispatch events, sleep when idle
+ *
+ * @date  16.10.2026
+ ******************************************************************************/
+void Exec_Run(void) __attribute__((noreturn));
+
+/*!****************************************************************************
+ * @brief
+ * Get executor statistics
+ *
+ * @param[out] stats      Statistics
+ * @date  16.10.2026
+ ******************************************************************************/
+void Exec_GetStats(Exec_Stats_t* stats);
+
+/*!****************************************************************************
+ * @brief
+ * Reset executor statistics
+ *
+ * @date  16.10.2026
+ ******************************************************************************/
+void Exec_ResetStats(void);
+
+/*!****************************************************************************
+ * @brief
+ * Hook: enter sleep, called with interrupts masked and no event pending
+ *
+ * The default executes WFE. May be replaced e.g. by Tickless_Idle(); the
+ * replacement must not enable interrupts before sleeping.
+ *
+ * @date  16.10.2026
+ ******************************************************************************/
+void Exec_Sleep(void);
+
+#endif /* CORE_RISCV_EXEC_H_ */
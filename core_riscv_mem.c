@@ -0,0 +1,239 @@
+/*!****************************************************************************
+ * @file
+ * core_riscv_mem.c
+ *
+ * @brief
+ * RISC-V2A Memory Copy, Fill and Move Kernels
+ *
+ * @note
+ * Build with RV_DEVICE_HEADER set to the device header, which includes
+ * core_riscv.h (e.g. -DRV_DEVICE_HEADER=\"ch32v00x.h\").
+ *
+ * @date  16.10.2026
+ ******************************************************************************/
+
+#include RV_DEVICE_HEADER
+#include "core_riscv_mem.h"
+
+/* Keep the compiler from turning the loops back into library calls           */
+#define MEM_KERNEL                    __attribute__((optimize("no-tree-loop-distribute-patterns")))
+
+/* Word access to byte buffers                                                */
+typedef uint32_t MemWord_t __attribute__((may_alias));
+
+/*!****************************************************************************
+ * @brief
+ * Copy word-aligned blocks, four words per iteration
+ *
+ * @param[out] dst        Destination (word aligned)
+ * @param[in] src         Source (word aligned)
+ * @param[in] words       Number of words
+ * @date  16.10.2026
+ ******************************************************************************/
+MEM_KERNEL static void prvCopyWords(MemWord_t* dst, const MemWord_t* src, size_t words)
+{
+  for (; words >= 4U; words -= 4U)
+  {
+    uint32_t ulW0 = src[0];
+    uint32_t ulW1 = src[1];
+    uint32_t ulW2 = src[2];
+    uint32_t ulW3 = src[3];
+    dst[0] = ulW0;
+    dst[1] = ulW1;
+    dst[2] = ulW2;
+    dst[3] = ulW3;
+    src += 4;
+    dst += 4;
+  }
+  for (; words != 0; --words) *dst++ = *src++;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Copy to a word-aligned destination from a misaligned source
+ *
+ * Only aligned source words holding at least one requested byte are loaded.
+ *
+ * @param[out] dst        Destination (word aligned)
+ * @param[in] src         Source (not word aligned)
+ * @param[in] words       Number of words
+ * @date  16.10.2026
+ ******************************************************************************/
+MEM_KERNEL static void prvCopyShifted(MemWord_t* dst, const uint8_t* src, size_t words)
+{
+  uint32_t ulShr = ((uintptr_t)src & 3U) << 3;
+  uint32_t ulShl = 32U - ulShr;
+  const MemWord_t* pulSrc = (const MemWord_t*)((uintptr_t)src & ~(uintptr_t)3U);
+  uint32_t ulLo = *pulSrc++;
+
+  for (; words >= 2U; words -= 2U)
+  {
+    uint32_t ulMid = pulSrc[0];
+    uint32_t ulHi = pulSrc[1];
+    dst[0] = (ulLo >> ulShr) | (ulMid << ulShl);
+    dst[1] = (ulMid >> ulShr) | (ulHi << ulShl);
+    ulLo = ulHi;
+    pulSrc += 2;
+    dst += 2;
+  }
+  if (words != 0) *dst = (ulLo >> ulShr) | (*pulSrc << ulShl);
+}
+
+/*!****************************************************************************
+ * @brief
+ * Copy memory (regions must not overlap)
+ *
+ * @param[out] dst        Destination
+ * @param[in] src         Source
+ * @param[in] len         Number of bytes
+ * @return  (void*)  Destination
+ * @date  16.10.2026
+ ******************************************************************************/
+MEM_KERNEL void* Mem_Copy(void* dst, const void* src, size_t len)
+{
+  uint8_t* pucDst = dst;
+  const uint8_t* pucSrc = src;
+
+  if (len >= MEM_SMALL)
+  {
+    size_t xWords;
+
+    /* Align the destination                                                */
+    while ((uintptr_t)pucDst & 3U)
+    {
+      *pucDst++ = *pucSrc++;
+      len--;
+    }
+
+    xWords = len >> 2;
+    if (((uintptr_t)pucSrc & 3U) == 0) prvCopyWords((MemWord_t*)pucDst, (const MemWord_t*)pucSrc, xWords);
+    else prvCopyShifted((MemWord_t*)pucDst, pucSrc, xWords);
+    pucDst += xWords << 2;
+    pucSrc += xWords << 2;
+    len &= 3U;
+  }
+
+  while (len-- != 0) *pucDst++ = *pucSrc++;
+  return dst;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Fill memory with a byte value
+ *
+ * @param[out] dst        Destination
+ * @param[in] value       Fill value (low byte used)
+ * @param[in] len         Number of bytes
+ * @return  (void*)  Destination
+ * @date  16.10.2026
+ ******************************************************************************/
+MEM_KERNEL void* Mem_Set(void* dst, int value, size_t len)
+{
+  uint8_t* pucDst = dst;
+  uint8_t ucValue = (uint8_t)value;
+
+  if (len >= MEM_SMALL)
+  {
+    uint32_t ulValue = ucValue;
+    MemWord_t* pulDst;
+
+    /* Byte splat without multiply (RV32EC has no M extension)              */
+    ulValue |= ulValue << 8;
+    ulValue |= ulValue << 16;
+
+    while ((uintptr_t)pucDst & 3U)
+    {
+      *pucDst++ = ucValue;
+      len--;
+    }
+
+    pulDst = (MemWord_t*)pucDst;
+    for (; len >= 16U; len -= 16U)
+    {
+      pulDst[0] = ulValue;
+      pulDst[1] = ulValue;
+      pulDst[2] = ulValue;
+      pulDst[3] = ulValue;
+      pulDst += 4;
+    }
+    for (; len >= 4U; len -= 4U) *pulDst++ = ulValue;
+    pucDst = (uint8_t*)pulDst;
+  }
+
+  while (len-- != 0) *pucDst++ = ucValue;
+  return dst;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Copy memory, regions may overlap
+ *
+ * @param[out] dst        Destination
+ * @param[in] src         Source
+ * @param[in] len         Number of bytes
+ * @return  (void*)  Destination
+ * @date  16.10.2026
+ ******************************************************************************/
+MEM_KERNEL void* Mem_Move(void* dst, const void* src, size_t len)
+{
+  uint8_t* pucDst = dst;
+  const uint8_t* pucSrc = src;
+
+  /* Forward copy never overwrites unread source bytes below the source     */
+  if (((uintptr_t)pucDst - (uintptr_t)pucSrc) >= len) return Mem_Copy(dst, src, len);
+
+  /* Destination overlaps the source from above: copy backwards             */
+  pucDst += len;
+  pucSrc += len;
+  if ((len >= MEM_SMALL) && ((((uintptr_t)pucDst ^ (uintptr_t)pucSrc) & 3U) == 0))
+  {
+    MemWord_t* pulDst;
+    const MemWord_t* pulSrc;
+
+    while ((uintptr_t)pucDst & 3U)
+    {
+      *--pucDst = *--pucSrc;
+      len--;
+    }
+
+    pulDst = (MemWord_t*)pucDst;
+    pulSrc = (const MemWord_t*)pucSrc;
+    for (; len >= 16U; len -= 16U)
+    {
+      uint32_t ulW3 = pulSrc[-1];
+      uint32_t ulW2 = pulSrc[-2];
+      uint32_t ulW1 = pulSrc[-3];
+      uint32_t ulW0 = pulSrc[-4];
+      pulDst[-1] = ulW3;
+      pulDst[-2] = ulW2;
+      pulDst[-3] = ulW1;
+      pulDst[-4] = ulW0;
+      pulSrc -= 4;
+      pulDst -= 4;
+    }
+    for (; len >= 4U; len -= 4U) *--pulDst = *--pulSrc;
+    pucDst = (uint8_t*)pulDst;
+    pucSrc = (const uint8_t*)pulSrc;
+  }
+
+  while (len-- != 0) *--pucDst = *--pucSrc;
+  return dst;
+}
+
+#ifdef USE_MEM_LIBC
+/* C library entry points                                                     */
+void* memcpy(void* dst, const void* src, size_t len)
+{
+  return Mem_Copy(dst, src, len);
+}
+
+void* memset(void* dst, int value, size_t len)
+{
+  return Mem_Set(dst, value, len);
+}
+
+void* memmove(void* dst, const void* src, size_t len)
+{
+  return Mem_Move(dst, src, len);
+}
+#endif /* USE_MEM_LIBC */
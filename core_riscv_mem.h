@@ -0,0 +1,71 @@
+/*!****************************************************************************
+ * @file
+ * core_riscv_mem.h
+ *
+ * @brief
+ * RISC-V2A Memory Copy, Fill and Move Kernels
+ *
+ * Word-based replacements for the byte loops of the generic C library
+ * routines. Misaligned heads and tails are handled bytewise; the aligned
+ * body moves blocks of four words per iteration, which fits the RV32EC
+ * register file without spilling. Copies between differently aligned
+ * buffers load aligned source words and merge them with shifts, so every
+ * load and store stays word aligned.
+ *
+ * With USE_MEM_LIBC, memcpy(), memset() and memmove() are defined by this
+ * module and take precedence over the C library archive members.
+ *
+ * @date  16.10.2026
+ ******************************************************************************/
+
+#ifndef CORE_RISCV_MEM_H_
+#define CORE_RISCV_MEM_H_
+
+#ifndef CORE_RISCV_H_
+#error "core_riscv.h must be included (via the device header) first"
+#endif /* CORE_RISCV_H_ */
+
+#include <stddef.h>
+
+/* Sizes below this are processed bytewise                                    */
+#ifndef MEM_SMALL
+#define MEM_SMALL                     8U
+#endif /* MEM_SMALL */
+
+/*!****************************************************************************
+ * @brief
+ * Copy memory (regions must not overlap)
+ *
+ * @param[out] dst        Destination
+ * @param[in] src         Source
+ * @param[in] len         Number of bytes
+ * @return  (void*)  Destination
+ * @date  16.10.2026
+ ******************************************************************************/
+void* Mem_Copy(void* dst, const void* src, size_t len);
+
+/*!****************************************************************************
+ * @brief
+ * Fill memory with a byte value
+ *
+ * @param[out] dst        Destination
+ * @param[in] value       Fill value (low byte used)
+ * @param[in] len         Number of bytes
+ * @return  (void*)  Destination
+ * @date  16.10.2026
+ ******************************************************************************/
+void* Mem_Set(void* dst, int value, size_t len);
+
+/*!****************************************************************************
+ * @brief
+ * Copy memory, regions may overlap
+ *
+ * @param[out] dst        Destination
+ * @param[in] src         Source
+ * @param[in] len         Number of bytes
+ * @return  (void*)  Destination
+ * @date  16.10.2026
+ ******************************************************************************/
+void* Mem_Move(void* dst, const void* src, size_t len);
+
+#endif /* CORE_RISCV_MEM_H_ */
@@ -0,0 +1,129 @@
+/*!****************************************************************************
+ * @file
+ * core_riscv_prof.c
+ *
+ * @brief
+ * RISC-V2A Cycle-Accurate Profiling Probes (mcycle/minstret)
+ *
+ * @note
+ * Build with RV_DEVICE_HEADER set to the device header, which includes
+ * core_riscv.h (e.g. -DRV_DEVICE_HEADER=\"ch32v00x.h\").
+ *
+ * @date  16.10.2026
+ ******************************************************************************/
+
+#include RV_DEVICE_HEADER
+#include "core_riscv_prof.h"
+
+/* Probe table, located in .bss                                               */
+Prof_Data_t Prof_Data;
+
+/*!****************************************************************************
+ * @brief
+ * Clear probe table and measure probe overhead
+ *
+ * @date  16.10.2026
+ ******************************************************************************/
+void Prof_Init(void)
+{
+  Prof_Data.ulMagic = PROF_MAGIC;
+  Prof_Data.usVersion = PROF_VERSION;
+  Prof_Data.usProbes = PROF_MAX_PROBES;
+  Prof_Data.ulCoreHz = PROF_CORE_HZ;
+  Prof_Calibrate();
+}
+
+/*!****************************************************************************
+ * @brief
+ * Clear all probe accumulators
+ *
+ * @date  16.10.2026
+ ******************************************************************************/
+void Prof_Reset(void)
+{
+  uint32_t ulState = __disable_irq_save();
+
+  for (uint32_t i = 0; i < PROF_MAX_PROBES; ++i)
+  {
+    Prof_Data.axProbe[i] = (Prof_Probe_t){ .ulMinCycles = 0xFFFFFFFFUL };
+  }
+  __restore_irq(ulState);
+}
+
+/*!****************************************************************************
+ * @brief
+ * Measure cycles and instructions of an empty probe
+ *
+ * Runs an empty probe pair on entry 0 with overhead compensation disabled and
+ * keeps the minimum, then clears the table.
+ *
+ * @date  16.10.2026
+ ******************************************************************************/
+void Prof_Calibrate(void)
+{
+  Prof_Sample_t xSample;
+
+  Prof_Data.ulOverheadCycles = 0;
+  Prof_Data.ulOverheadInstr = 0;
+  Prof_Reset();
+
+  for (uint32_t i = 0; i < 8; ++i)
+  {
+    Prof_Begin(&xSample, 0);
+    Prof_End(&xSample);
+  }
+  Prof_Data.ulOverheadCycles = Prof_Data.axProbe[0].ulMinCycles;
+  Prof_Data.ulOverheadInstr = (uint32_t)(Prof_Data.axProbe[0].ullSumInstr >> 3);
+  Prof_Reset();
+}
+
+/*!****************************************************************************
+ * @brief
+ * Record a sample started with Prof_Begin()
+ *
+ * @param[in] sample      Start snapshot
+ * @date  16.10.2026
+ ******************************************************************************/
+void Prof_End(const Prof_Sample_t* sample)
+{
+  uint32_t ulCycles = __get_MCYCLE() - sample->ulCycles;
+  uint32_t ulInstr = __get_MINSTRET() - sample->ulInstr;
+  uint32_t ulState;
+  Prof_Probe_t* pxProbe;
+
+  if (sample->ulId >= PROF_MAX_PROBES) return;
+  pxProbe = &Prof_Data.axProbe[sample->ulId];
+
+  ulCycles = (ulCycles > Prof_Data.ulOverheadCycles) ? (ulCycles - Prof_Data.ulOverheadCycles) : 0;
+  ulInstr = (ulInstr > Prof_Data.ulOverheadInstr) ? (ulInstr - Prof_Data.ulOverheadInstr) : 0;
+
+  ulState = __disable_irq_save();
+  pxProbe->ulCount++;
+  pxProbe->ullSumCycles += ulCycles;
+  pxProbe->ullSumInstr += ulInstr;
+  if (ulCycles < pxProbe->ulMinCycles) pxProbe->ulMinCycles = ulCycles;
+  if (ulCycles > pxProbe->ulMaxCycles) pxProbe->ulMaxCycles = ulCycles;
+  __restore_irq(ulState);
+}
+
+/*!****************************************************************************
+ * @brief
+ * Get mean instructions per cycle of a probe
+ *
+ * @param[in] id          Probe ID
+ * @return  (uint32_t)  IPC scaled by 1000, 0 without samples
+ * @date  16.10.2026
+ ******************************************************************************/
+uint32_t Prof_GetIPCx1000(uint32_t id)
+{
+  Prof_Probe_t xProbe;
+  uint32_t ulState;
+
+  if (id >= PROF_MAX_PROBES) return 0;
+  ulState = __disable_irq_save();
+  xProbe = Prof_Data.axProbe[id];
+  __restore_irq(ulState);
+
+  if (xProbe.ullSumCycles == 0) return 0;
+  return (uint32_t)((xProbe.ullSumInstr * 1000ULL) / xProbe.ullSumCycles);
+}
@@ -0,0 +1,149 @@
+/*!****************************************************************************
+ * @file
+ * core_riscv_prof.h
+ *
+ * @brief
+ * RISC-V2A Cycle-Accurate Profiling Probes (mcycle/minstret)
+ *
+ * Probes accumulate count, min/max/sum of cycles and sum of retired
+ * instructions per probe ID into a fixed table (Prof_Data) in .bss. The
+ * measurement overhead determined by Prof_Calibrate() is subtracted from
+ * every sample. Dump Prof_Data as raw memory (e.g. via the debug link) and
+ * turn it into a report with tools/prof_report.c.
+ *
+ * Probes compile to nothing unless USE_PROFILING is defined.
+ *
+ * @date  16.10.2026
+ ******************************************************************************/
+
+#ifndef CORE_RISCV_PROF_H_
+#define CORE_RISCV_PROF_H_
+
+#ifndef CORE_RISCV_H_
+#error "core_riscv.h must be included (via the device header) first"
+#endif /* CORE_RISCV_H_ */
+
+/* Number of probe table entries                                              */
+#ifndef PROF_MAX_PROBES
+#define PROF_MAX_PROBES               16U
+#endif /* PROF_MAX_PROBES */
+
+/* Core clock frequency in Hz, recorded in the dump for time conversion       */
+#ifndef PROF_CORE_HZ
+#define PROF_CORE_HZ                  48000000UL
+#endif /* PROF_CORE_HZ */
+
+/* Dump identification ("PROF") and layout version                            */
+#define PROF_MAGIC                    0x464F5250UL
+#define PROF_VERSION                  1U
+
+/* Probe accumulator, 32 bytes, layout identical for ILP32E and ILP32         */
+typedef struct {
+  uint64_t ullSumCycles;      /*!< Sum of cycles                              */
+  uint64_t ullSumInstr;       /*!< Sum of retired instructions                */
+  uint32_t ulCount;           /*!< Number of samples                          */
+  uint32_t ulMinCycles;       /*!< Minimum cycles per sample                  */
+  uint32_t ulMaxCycles;       /*!< Maximum cycles per sample                  */
+  uint32_t ulReserved;
+} Prof_Probe_t;
+
+/* Probe table with dump header (24 bytes), decoded by tools/prof_report.c    */
+typedef struct {
+  uint32_t ulMagic;           /*!< PROF_MAGIC                                 */
+  uint16_t usVersion;         /*!< PROF_VERSION                               */
+  uint16_t usProbes;          /*!< Number of probe entries                    */
+  uint32_t ulCoreHz;          /*!< Core clock frequency                       */
+  uint32_t ulOverheadCycles;  /*!< Subtracted cycles per sample               */
+  uint32_t ulOverheadInstr;   /*!< Subtracted instructions per sample         */
+  uint32_t ulReserved;
+  Prof_Probe_t axProbe[PROF_MAX_PROBES];
+} Prof_Data_t;
+
+/* Probe start snapshot                                                       */
+typedef struct {
+  uint32_t ulId;
+  uint32_t ulCycles;
+  uint32_t ulInstr;
+} Prof_Sample_t;
+
+extern Prof_Data_t Prof_Data;
+
+/*!****************************************************************************
+ * @brief
+ * Clear probe table and measure probe overhead
+ *
+ * @date  16.10.2026
+ ******************************************************************************/
+void Prof_Init(void);
+
+/*!****************************************************************************
+ * @brief
+ * Clear all probe accumulators
+ *
+ * @date  16.10.2026
+ ******************************************************************************/
+void Prof_Reset(void);
+
+/*!****************************************************************************
+ * @brief
+ * Measure cycles and instructions of an empty probe
+ *
+ * @date  16.10.2026
+ ******************************************************************************/
+void Prof_Calibrate(void);
+
+/*!****************************************************************************
+ * @brief
+ * Record a sample started with Prof_Begin()
+ *
+ * @param[in] sample      Start snapshot
+ * @date  16.10.2026
+ ******************************************************************************/
+void Prof_End(const Prof_Sample_t* sample);
+
+/*!****************************************************************************
+ * @brief
+ * Take probe start snapshot
+ *
+ * @param[out] sample     Start snapshot
+ * @param[in] id          Probe ID (0..PROF_MAX_PROBES-1)
+ * @date  16.10.2026
+ ******************************************************************************/
+RV_STATIC_FORCE_INLINE void Prof_Begin(Prof_Sample_t* sample, uint32_t id)
+{
+  sample->ulId = id;
+  sample->ulInstr = __get_MINSTRET();
+  sample->ulCycles = __get_MCYCLE();
+}
+
+/*!****************************************************************************
+ * @brief
+ * Get mean instructions per cycle of a probe
+ *
+ * @param[in] id          Probe ID
+ * @return  (uint32_t)  IPC scaled by 1000, 0 without samples
+ * @date  16.10.2026
+ ******************************************************************************/
+uint32_t Prof_GetIPCx1000(uint32_t id);
+
+#ifdef USE_PROFILING
+/* Explicit probe pair                                                        */
+#define PROF_BEGIN(id)                Prof_Sample_t __prof_##id; Prof_Begin(&__prof_##id, (id))
+#define PROF_END(id)                  Prof_End(&__prof_##id)
+
+/* Unique identifier per source line                                          */
+#define PROF_CONCAT_(a, b)            a##b
+#define PROF_CONCAT(a, b)             PROF_CONCAT_(a, b)
+#define PROF_SCOPE_VAR                PROF_CONCAT(__prof_scope_, __LINE__)
+
+/* Scoped probe: sample ends when the enclosing block is left (one per line)  */
+#define PROF_SCOPE(id)                                                         \
+  Prof_Sample_t PROF_SCOPE_VAR __attribute__((cleanup(Prof_End)));            \
+  Prof_Begin(&PROF_SCOPE_VAR, (id))
+#else
+#define PROF_BEGIN(id)                do {} while (0)
+#define PROF_END(id)                  do {} while (0)
+#define PROF_SCOPE(id)                do {} while (0)
+#endif /* USE_PROFILING */
+
+#endif /* CORE_RISCV_PROF_H_ */
@@ -0,0 +1,350 @@
+/*!****************************************************************************
+ * @file
+ * core_riscv_ring.h
+ *
+ * @brief
+ * RISC-V2A Lock-Free Byte Ring Buffers
+ *
+ * Ring buffers for handing data from interrupt handlers to thread context
+ * (or vice versa) on a single-core RV32EC, which has no atomic memory
+ * operations. Head and tail are free-running 32-bit indices, each written by
+ * one side only; aligned word loads and stores are single-copy atomic, and
+ * the in-order core makes a compiler barrier sufficient for ordering.
+ *
+ *  - SPSC    Ring_Push()/Ring_Write(): one producer, wait-free, no critical
+ *            sections
+ *  - MPSC    Ring_MpscPush()/Ring_MpscWrite(): several producers, e.g. ISRs
+ *            of different priorities. Space is reserved and published in
+ *            two brief interrupt-masked sections; the data is copied with
+ *            interrupts enabled. Data becomes visible once every producer
+ *            that interrupted another has finished.
+ *
+ * The consumer side (Ring_Pop(), Ring_Read(), Ring_ReadSpan()) is common to
+ * both and must be used from one context only. Span functions give direct
+ * access to contiguous buffer regions for zero-copy transfer (e.g. DMA).
+ *
+ * Cost per byte, modelled (tests/target/bench_ring.s, hand-written assembly
+ * equivalents timed by the simulator at 0 wait states, out-of-line call
+ * included): Ring_Push() 14 and Ring_Pop() 14 cycles, against 18 and 19
+ * cycles for a queue with a shared count and masked interrupts, which also
+ * delays an interrupt by up to 15 cycles. "make -C tests/target ring-c"
+ * measures the same workload compiled from C (tests/target/bench_ring.c).
+ *
+ * @date  16.10.2026
+ ******************************************************************************/
+
+#ifndef CORE_RISCV_RING_H_
+#define CORE_RISCV_RING_H_
+
+#ifndef CORE_RISCV_H_
+#error "core_riscv.h must be included (via the device header) first"
+#endif /* CORE_RISCV_H_ */
+
+#include <string.h>
+
+/* Ring buffer control block                                                  */
+typedef struct {
+  uint8_t* pucBuf;            /*!< Storage, size is a power of two            */
+  uint32_t ulMask;            /*!< Size - 1                                   */
+  volatile uint32_t ulHead;   /*!< Published write index (producer)          */
+  volatile uint32_t ulTail;   /*!< Read index (consumer)                      */
+  uint32_t ulReserve;         /*!< Reserved write index (MPSC producers)      */
+  uint32_t ulWriters;         /*!< Producers between reserve and publish      */
+} Ring_t;
+
+/*!****************************************************************************
+ * @brief
+ * Initialise ring buffer
+ *
+ * @param[out] ring       Ring buffer
+ * @param[in] buf         Storage
+ * @param[in] size        Storage size in bytes (power of two)
+ * @return  (ErrorStatus)  ERROR if size is not a power of two
+ * @date  16.10.2026
+ ******************************************************************************/
+RV_STATIC_INLINE ErrorStatus Ring_Init(Ring_t* ring, uint8_t* buf, uint32_t size)
+{
+  if ((size == 0) || ((size & (size - 1UL)) != 0)) return ERROR;
+  ring->pucBuf = buf;
+  ring->ulMask = size - 1UL;
+  ring->ulHead = 0;
+  ring->ulTail = 0;
+  ring->ulReserve = 0;
+  ring->ulWriters = 0;
+  return SUCCESS;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Get number of bytes available to the consumer
+ *
+ * @param[in] ring        Ring buffer
+ * @return  (uint32_t)  Number of bytes
+ * @date  16.10.2026
+ ******************************************************************************/
+RV_STATIC_FORCE_INLINE uint32_t Ring_Count(const Ring_t* ring)
+{
+  return ring->ulHead - ring->ulTail;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Get number of free bytes (SPSC producer)
+ *
+ * @param[in] ring        Ring buffer
+ * @return  (uint32_t)  Number of bytes
+ * @date  16.10.2026
+ ******************************************************************************/
+RV_STATIC_FORCE_INLINE uint32_t Ring_Free(const Ring_t* ring)
+{
+  return ring->ulMask + 1UL - (ring->ulHead - ring->ulTail);
+}
+
+/* ############################ SPSC producer ############################### */
+/*!****************************************************************************
+ * @brief
+ * Push byte (SPSC producer)
+ *
+ * @param[in,out] ring    Ring buffer
+ * @param[in] data        Byte
+ * @return  (ErrorStatus)  ERROR if full
+ * @date  16.10.2026
+ ******************************************************************************/
+RV_STATIC_FORCE_INLINE ErrorStatus Ring_Push(Ring_t* ring, uint8_t data)
+{
+  uint32_t ulHead = ring->ulHead;
+
+  if ((ulHead - ring->ulTail) > ring->ulMask) return ERROR;
+  ring->pucBuf[ulHead & ring->ulMask] = data;
+  RV_COMPILER_BARRIER();
+  ring->ulHead = ulHead + 1UL;
+  return SUCCESS;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Get contiguous free region for zero-copy writing (SPSC producer)
+ *
+ * @param[in] ring        Ring buffer
+ * @param[out] span       Start of region
+ * @return  (uint32_t)  Region length in bytes, 0 if full
+ * @date  16.10.2026
+ ******************************************************************************/
+RV_STATIC_INLINE uint32_t Ring_WriteSpan(const Ring_t* ring, uint8_t** span)
+{
+  uint32_t ulHead = ring->ulHead;
+  uint32_t ulIdx = ulHead & ring->ulMask;
+  uint32_t ulFree = ring->ulMask + 1UL - (ulHead - ring->ulTail);
+  uint32_t ulEdge = ring->ulMask + 1UL - ulIdx;
+
+  *span = &ring->pucBuf[ulIdx];
+  return (ulFree < ulEdge) ? ulFree : ulEdge;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Publish bytes written to a span (SPSC producer)
+ *
+ * @param[in,out] ring    Ring buffer
+ * @param[in] len         Number of bytes, at most the span length
+ * @date  16.10.2026
+ ******************************************************************************/
+RV_STATIC_FORCE_INLINE void Ring_Commit(Ring_t* ring, uint32_t len)
+{
+  RV_COMPILER_BARRIER();
+  ring->ulHead += len;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Write bytes (SPSC producer)
+ *
+ * @param[in,out] ring    Ring buffer
+ * @param[in] data        Source
+ * @param[in] len         Number of bytes
+ * @return  (uint32_t)  Number of bytes written (less than len if full)
+ * @date  16.10.2026
+ ******************************************************************************/
+RV_STATIC_INLINE uint32_t Ring_Write(Ring_t* ring, const void* data, uint32_t len)
+{
+  const uint8_t* pucSrc = (const uint8_t*)data;
+  uint32_t ulDone = 0;
+
+  /* At most two spans: up to the buffer end, then from its start           */
+  for (uint32_t i = 0; (i < 2U) && (ulDone < len); ++i)
+  {
+    uint8_t* pucSpan;
+    uint32_t ulLen = Ring_WriteSpan(ring, &pucSpan);
+
+    if (ulLen == 0) break;
+    if (ulLen > len - ulDone) ulLen = len - ulDone;
+    memcpy(pucSpan, &pucSrc[ulDone], ulLen);
+    ulDone += ulLen;
+    Ring_Commit(ring, ulLen);
+  }
+  return ulDone;
+}
+
+/* ############################ MPSC producer ############################### */
+/*!****************************************************************************
+ * @brief
+ * Write bytes (MPSC producer)
+ *
+ * Reserves space and publishes in brief interrupt-masked sections, the copy
+ * runs with interrupts enabled.
+ *
+ * @param[in,out] ring    Ring buffer
+ * @param[in] data        Source
+ * @param[in] len         Number of bytes
+ * @return  (uint32_t)  Number of bytes written (less than len if full)
+ * @date  16.10.2026
+ ******************************************************************************/
+RV_STATIC_INLINE uint32_t Ring_MpscWrite(Ring_t* ring, const void* data, uint32_t len)
+{
+  const uint8_t* pucSrc = (const uint8_t*)data;
+  uint32_t ulState, ulStart, ulFree, ulIdx;
+
+  /* Reserve                                                                */
+  ulState = __disable_irq_save();
+  ulStart = ring->ulReserve;
+  ulFree = ring->ulMask + 1UL - (ulStart - ring->ulTail);
+  if (len > ulFree) len = ulFree;
+  ring->ulReserve = ulStart + len;
+  ring->ulWriters++;
+  __restore_irq(ulState);
+
+  /* Copy, wrapping at the buffer end                                       */
+  ulIdx = ulStart & ring->ulMask;
+  if (len > ring->ulMask + 1UL - ulIdx)
+  {
+    uint32_t ulFirst = ring->ulMask + 1UL - ulIdx;
+    memcpy(&ring->pucBuf[ulIdx], pucSrc, ulFirst);
+    memcpy(ring->pucBuf, &pucSrc[ulFirst], len - ulFirst);
+  }
+  else
+  {
+    memcpy(&ring->pucBuf[ulIdx], pucSrc, len);
+  }
+
+  /* Publish once no reservation is pending                                 */
+  RV_COMPILER_BARRIER();
+  ulState = __disable_irq_save();
+  if (--ring->ulWriters == 0) ring->ulHead = ring->ulReserve;
+  __restore_irq(ulState);
+  return len;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Push byte (MPSC producer)
+ *
+ * @param[in,out] ring    Ring buffer
+ * @param[in] data        Byte
+ * @return  (ErrorStatus)  ERROR if full
+ * @date  16.10.2026
+ ******************************************************************************/
+RV_STATIC_INLINE ErrorStatus Ring_MpscPush(Ring_t* ring, uint8_t data)
+{
+  uint32_t ulState = __disable_irq_save();
+  uint32_t ulHead = ring->ulReserve;
+  ErrorStatus eResult = ERROR;
+
+  /* Single byte: a reservation-free store is as short as a reservation     */
+  if ((ulHead - ring->ulTail) <= ring->ulMask)
+  {
+    ring->pucBuf[ulHead & ring->ulMask] = data;
+    ring->ulReserve = ulHead + 1UL;
+    if (ring->ulWriters == 0) ring->ulHead = ulHead + 1UL;
+    eResult = SUCCESS;
+  }
+  __restore_irq(ulState);
+  return eResult;
+}
+
+/* ############################### Consumer ################################# */
+/*!****************************************************************************
+ * @brief
+ * Pop byte (consumer)
+ *
+ * @param[in,out] ring    Ring buffer
+ * @param[out] data       Byte
+ * @return  (ErrorStatus)  ERROR if empty
+ * @date  16.10.2026
+ ******************************************************************************/
+RV_STATIC_FORCE_INLINE ErrorStatus Ring_Pop(Ring_t* ring, uint8_t* data)
+{
+  uint32_t ulTail = ring->ulTail;
+
+  if (ring->ulHead == ulTail) return ERROR;
+  RV_COMPILER_BARRIER();
+  *data = ring->pucBuf[ulTail & ring->ulMask];
+  RV_COMPILER_BARRIER();
+  ring->ulTail = ulTail + 1UL;
+  return SUCCESS;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Get contiguous filled region for zero-copy reading (consumer)
+ *
+ * @param[in] ring        Ring buffer
+ * @param[out] span       Start of region
+ * @return  (uint32_t)  Region length in bytes, 0 if empty
+ * @date  16.10.2026
+ ******************************************************************************/
+RV_STATIC_INLINE uint32_t Ring_ReadSpan(const Ring_t* ring, const uint8_t** span)
+{
+  uint32_t ulTail = ring->ulTail;
+  uint32_t ulIdx = ulTail & ring->ulMask;
+  uint32_t ulCount = ring->ulHead - ulTail;
+  uint32_t ulEdge = ring->ulMask + 1UL - ulIdx;
+
+  RV_COMPILER_BARRIER();
+  *span = &ring->pucBuf[ulIdx];
+  return (ulCount < ulEdge) ? ulCount : ulEdge;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Release bytes read from a span (consumer)
+ *
+ * @param[in,out] ring    Ring buffer
+ * @param[in] len         Number of bytes, at most the span length
+ * @date  16.10.2026
+ ******************************************************************************/
+RV_STATIC_FORCE_INLINE void Ring_Release(Ring_t* ring, uint32_t len)
+{
+  RV_COMPILER_BARRIER();
+  ring->ulTail += len;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Read bytes (consumer)
+ *
+ * @param[in,out] ring    Ring buffer
+ * @param[out] data       Destination
+ * @param[in] len         Maximum number of bytes
+ * @return  (uint32_t)  Number of bytes read
+ * @date  16.10.2026
+ ******************************************************************************/
+RV_STATIC_INLINE uint32_t Ring_Read(Ring_t* ring, void* data, uint32_t len)
+{
+  uint8_t* pucDst = (uint8_t*)data;
+  uint32_t ulDone = 0;
+
+  for (uint32_t i = 0; (i < 2U) && (ulDone < len); ++i)
+  {
+    const uint8_t* pucSpan;
+    uint32_t ulLen = Ring_ReadSpan(ring, &pucSpan);
+
+    if (ulLen == 0) break;
+    if (ulLen > len - ulDone) ulLen = len - ulDone;
+    memcpy(&pucDst[ulDone], pucSpan, ulLen);
+    ulDone += ulLen;
+    Ring_Release(ring, ulLen);
+  }
+  return ulDone;
+}
+
+#endif /* CORE_RISCV_RING_H_ */
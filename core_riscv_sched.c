@@ -0,0 +1,405 @@
+/*!****************************************************************************
+ * @file
+ * core_riscv_sched.c
+ *
+ * @brief
+ * RISC-V2A Minimal Fixed-Priority Preemptive Scheduler
+ *
+ * @note
+ * Build with RV_DEVICE_HEADER set to the device header, which includes
+ * core_riscv.h (e.g. -DRV_DEVICE_HEADER=\"ch32v00x.h\").
+ *
+ * @date  16.10.2026
+ ******************************************************************************/
+
+#include RV_DEVICE_HEADER
+#include "core_riscv_sched.h"
+
+#if (SCHED_PRIOS < 1U) || (SCHED_PRIOS > 32U)
+#error "SCHED_PRIOS must be within 1..32"
+#endif
+
+/* Task table, ready and delayed bitmaps (bit n: priority n)                  */
+static Sched_Task_t* apxTask[SCHED_PRIOS];
+static volatile uint32_t ulReady;
+static volatile uint32_t ulDelayed;
+
+/* Running task; the idle task ranks below all priority levels                */
+static Sched_Task_t xIdle;
+static Sched_Task_t* volatile pxCurrent = &xIdle;
+static uint8_t ucStarted;
+
+/* Number of context switches                                                 */
+static uint32_t ulSwitches;
+
+/*!****************************************************************************
+ * @brief
+ * Get index of the lowest set bit (constant time, no multiply)
+ *
+ * @param[in] bitmap      Bitmap, non-zero
+ * @return  (uint32_t)  Bit index
+ * @date  16.10.2026
+ ******************************************************************************/
+static uint32_t prvLowestBit(uint32_t bitmap)
+{
+  uint32_t ulIdx = 0;
+
+#if SCHED_PRIOS > 16U
+  if ((bitmap & 0xFFFFUL) == 0) { ulIdx += 16U; bitmap >>= 16; }
+#endif
+#if SCHED_PRIOS > 8U
+  if ((bitmap & 0xFFUL) == 0) { ulIdx += 8U; bitmap >>= 8; }
+#endif
+  if ((bitmap & 0xFUL) == 0) { ulIdx += 4U; bitmap >>= 4; }
+  if ((bitmap & 0x3UL) == 0) { ulIdx += 2U; bitmap >>= 2; }
+  if ((bitmap & 0x1UL) == 0) { ulIdx += 1U; }
+  return ulIdx;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Trigger the context switch interrupt
+ *
+ * @date  16.10.2026
+ ******************************************************************************/
+static void prvPend(void)
+{
+  uint32_t ulState = __disable_irq_save();
+  RV_REG_WRITE(SysTick->CTLR, RV_REG_READ(SysTick->CTLR) | SYSTICK_CTLR_SWIE);
+  __restore_irq(ulState);
+}
+
+/*!****************************************************************************
+ * @brief
+ * Trigger context switch if a ready task outranks the running one
+ *
+ * @date  16.10.2026
+ ******************************************************************************/
+static void prvPreempt(void)
+{
+  uint32_t ulBits = ulReady;
+
+  if (ucStarted && (ulBits != 0) && (prvLowestBit(ulBits) < pxCurrent->ucPrio)) prvPend();
+}
+
+/*!****************************************************************************
+ * @brief
+ * First code of every task: run entry function, end task on return
+ *
+ * @date  16.10.2026
+ ******************************************************************************/
+static void prvTaskEntry(void)
+{
+  pxCurrent->pfnEntry(pxCurrent->pvArg);
+  Sched_Exit();
+}
+
+/*!****************************************************************************
+ * @brief
+ * Create task, ready to run once the scheduler is started
+ *
+ * @param[out] task       Task control block
+ * @param[in] prio        Priority level (below SCHED_PRIOS), one task each
+ * @param[in] entry       Task function, may return to end the task
+ * @param[in] arg         Task function argument
+ * @param[in] stack       Stack memory
+ * @param[in] words       Stack size in words (at least SCHED_STACK_MIN)
+ * @return  (ErrorStatus)  ERROR if priority taken or stack too small
+ * @date  16.10.2026
+ ******************************************************************************/
+ErrorStatus Sched_Create(Sched_Task_t* task, uint8_t prio, Sched_Entry_t entry, void* arg,
+                         uint32_t* stack, uint32_t words)
+{
+  uint32_t* pulSP = stack + words;
+  uint32_t ulState;
+
+  if ((prio >= SCHED_PRIOS) || (apxTask[prio] != NULL) || (words < SCHED_STACK_MIN)) return ERROR;
+
+  /* Initial frame: registers zero, mepc at the task trampoline             */
+  for (uint32_t i = 0; i < SCHED_FRAME_WORDS; ++i) *--pulSP = 0;
+  pulSP[0] = (uint32_t)(uintptr_t)&prvTaskEntry;
+
+  task->pulSP = pulSP;
+  task->ulDelay = 0;
+  task->pfnEntry = entry;
+  task->pvArg = arg;
+  task->ucPrio = prio;
+
+  ulState = __disable_irq_save();
+  apxTask[prio] = task;
+  ulReady |= 1UL << prio;
+  __restore_irq(ulState);
+
+  prvPreempt();
+  return SUCCESS;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Start scheduling, the caller continues as idle task
+ *
+ * @date  16.10.2026
+ ******************************************************************************/
+void Sched_Start(void)
+{
+  xIdle.ucPrio = SCHED_PRIOS;
+  pxCurrent = &xIdle;
+
+  __set_INTSYSCR(__get_INTSYSCR() & ~PFIC_INTSYSCR_HWSTKEN);
+
+  PFIC_SetPriority(SCHED_IRQn, 0xFFU);
+  PFIC_EnableIRQ(SCHED_IRQn);
+  ucStarted = 1;
+  prvPreempt();
+}
+
+/*!****************************************************************************
+ * @brief
+ * Request context switch at the next interrupt-enabled instruction
+ *
+ * @date  16.10.2026
+ ******************************************************************************/
+void Sched_Yield(void)
+{
+  prvPend();
+}
+
+/*!****************************************************************************
+ * @brief
+ * Block calling task for a number of Sched_Tick() periods
+ *
+ * @param[in] ticks       Delay in ticks, 0 just yields
+ * @date  16.10.2026
+ ******************************************************************************/
+void Sched_Delay(uint32_t ticks)
+{
+  Sched_Task_t* pxTask = pxCurrent;
+  uint32_t ulState;
+
+  if ((ticks != 0) && (pxTask != &xIdle))
+  {
+    ulState = __disable_irq_save();
+    pxTask->ulDelay = ticks;
+    ulReady &= ~(1UL << pxTask->ucPrio);
+    ulDelayed |= 1UL << pxTask->ucPrio;
+    __restore_irq(ulState);
+  }
+  prvPend();
+}
+
+/*!****************************************************************************
+ * @brief
+ * Block task until Sched_Resume()
+ *
+ * @param[in,out] task    Task, NULL for the calling task
+ * @date  16.10.2026
+ ******************************************************************************/
+void Sched_Suspend(Sched_Task_t* task)
+{
+  uint32_t ulState;
+
+  if (task == NULL) task = pxCurrent;
+  if (task == &xIdle) return;
+
+  ulState = __disable_irq_save();
+  ulReady &= ~(1UL << task->ucPrio);
+  ulDelayed &= ~(1UL << task->ucPrio);
+  __restore_irq(ulState);
+
+  if (task == pxCurrent) prvPend();
+}
+
+/*!****************************************************************************
+ * @brief
+ * Make task ready, also from interrupt handlers
+ *
+ * Tasks that have ended (Sched_Exit()) are ignored.
+ *
+ * @param[in,out] task    Task
+ * @date  16.10.2026
+ ******************************************************************************/
+void Sched_Resume(Sched_Task_t* task)
+{
+  uint32_t ulState = __disable_irq_save();
+
+  if (apxTask[task->ucPrio] != task)
+  {
+    __restore_irq(ulState);
+    return;
+  }
+  ulDelayed &= ~(1UL << task->ucPrio);
+  ulReady |= 1UL << task->ucPrio;
+  __restore_irq(ulState);
+
+  prvPreempt();
+}
+
+/*!****************************************************************************
+ * @brief
+ * End calling task
+ *
+ * @date  16.10.2026
+ ******************************************************************************/
+void Sched_Exit(void)
+{
+  uint32_t ulPrio = pxCurrent->ucPrio;
+
+  __disable_irq();
+  ulReady &= ~(1UL << ulPrio);
+  ulDelayed &= ~(1UL << ulPrio);
+  apxTask[ulPrio] = NULL;
+  RV_REG_WRITE(SysTick->CTLR, RV_REG_READ(SysTick->CTLR) | SYSTICK_CTLR_SWIE);
+  __enable_irq();
+  while (1);
+}
+
+/*!****************************************************************************
+ * @brief
+ * Advance delays by one tick, from the tick interrupt
+ *
+ * @date  16.10.2026
+ ******************************************************************************/
+void Sched_Tick(void)
+{
+  uint32_t ulState = __disable_irq_save();
+  uint32_t ulBits = ulDelayed;
+
+  while (ulBits != 0)
+  {
+    uint32_t ulPrio = prvLowestBit(ulBits);
+    ulBits &= ulBits - 1UL;
+
+    if (--apxTask[ulPrio]->ulDelay == 0)
+    {
+      ulDelayed &= ~(1UL << ulPrio);
+      ulReady |= 1UL << ulPrio;
+    }
+  }
+  __restore_irq(ulState);
+
+  prvPreempt();
+}
+
+/*!****************************************************************************
+ * @brief
+ * Get running task
+ *
+ * @return  (Sched_Task_t*)  Running task, NULL for the idle task
+ * @date  16.10.2026
+ ******************************************************************************/
+Sched_Task_t* Sched_GetCurrent(void)
+{
+  Sched_Task_t* pxTask = pxCurrent;
+  return (pxTask == &xIdle) ? NULL : pxTask;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Get number of context switches
+ *
+ * @return  (uint32_t)  Context switches since Sched_Start()
+ * @date  16.10.2026
+ ******************************************************************************/
+uint32_t Sched_GetSwitches(void)
+{
+  return ulSwitches;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Save context and select next task, called by Sched_SysTickHandler()
+ *
+ * @param[in] sp          Stack pointer of the interrupted task
+ * @return  (uint32_t*)  Stack pointer of the task to resume
+ * @date  16.10.2026
+ ******************************************************************************/
+uint32_t* Sched_Switch(uint32_t* sp)
+{
+  uint32_t ulState, ulBits;
+  Sched_Task_t* pxNext;
+
+  if (RV_REG_READ(SysTick->SR) & SYSTICK_SR_CNTIF) Sched_OnSysTick();
+
+  /* Requests raised up to here are served by this switch                   */
+  ulState = __disable_irq_save();
+  RV_REG_WRITE(SysTick->CTLR, RV_REG_READ(SysTick->CTLR) & ~SYSTICK_CTLR_SWIE);
+  pxCurrent->pulSP = sp;
+  ulBits = ulReady;
+  pxNext = (ulBits != 0) ? apxTask[prvLowestBit(ulBits)] : &xIdle;
+  if (pxNext != pxCurrent)
+  {
+    pxCurrent = pxNext;
+    ulSwitches++;
+  }
+  __restore_irq(ulState);
+  return pxNext->pulSP;
+}
+
+/*!****************************************************************************
+ * @brief
+ * SysTick interrupt handler performing the context switch
+ *
+ * @date  16.10.2026
+ ******************************************************************************/
+#ifndef USE_HOST_SIM
+__attribute__((naked)) void Sched_SysTickHandler(void)
+{
+  /* Runs with interrupts masked: a nested trap would overwrite mepc before
+   * it is saved. mret restores MIE from MPIE.                              */
+  __asm volatile (
+    "csrci mstatus, 8       \n"
+    "addi  sp, sp, -52      \n"
+    "sw    ra, 4(sp)        \n"
+    "sw    t0, 8(sp)        \n"
+    "sw    t1, 12(sp)       \n"
+    "sw    t2, 16(sp)       \n"
+    "sw    s0, 20(sp)       \n"
+    "sw    s1, 24(sp)       \n"
+    "sw    a0, 28(sp)       \n"
+    "sw    a1, 32(sp)       \n"
+    "sw    a2, 36(sp)       \n"
+    "sw    a3, 40(sp)       \n"
+    "sw    a4, 44(sp)       \n"
+    "sw    a5, 48(sp)       \n"
+    "csrr  t0, mepc         \n"
+    "sw    t0, 0(sp)        \n"
+    "mv    a0, sp           \n"
+    "call  Sched_Switch     \n"
+    "mv    sp, a0           \n"
+    "lw    t0, 0(sp)        \n"
+    "csrw  mepc, t0         \n"
+    "lw    ra, 4(sp)        \n"
+    "lw    t0, 8(sp)        \n"
+    "lw    t1, 12(sp)       \n"
+    "lw    t2, 16(sp)       \n"
+    "lw    s0, 20(sp)       \n"
+    "lw    s1, 24(sp)       \n"
+    "lw    a0, 28(sp)       \n"
+    "lw    a1, 32(sp)       \n"
+    "lw    a2, 36(sp)       \n"
+    "lw    a3, 40(sp)       \n"
+    "lw    a4, 44(sp)       \n"
+    "lw    a5, 48(sp)       \n"
+    "addi  sp, sp, 52       \n"
+    "mret                   \n"
+  );
+}
+#else
+void Sched_SysTickHandler(void)
+{
+  /* Host build: task selection only, stacks are not switched               */
+  (void)Sched_Switch(pxCurrent->pulSP);
+}
+#endif /* USE_HOST_SIM */
+
+/*!****************************************************************************
+ * @brief
+ * Hook: SysTick counter interrupt (CNTIF) seen by the switch handler
+ *
+ * @date  16.10.2026
+ ******************************************************************************/
+RV_WEAK void Sched_OnSysTick(void)
+{
+  RV_REG_WRITE(SysTick->SR, 0);
+  Sched_Tick();
+}
@@ -0,0 +1,205 @@
+/*!****************************************************************************
+ * @file
+ * core_riscv_sched.h
+ *
+ * @brief
+ * RISC-V2A Minimal Fixed-Priority Preemptive Scheduler
+ *
+ * One task per priority level (0 is highest, up to SCHED_PRIOS - 1), ready
+ * tasks are kept in a bitmap and the highest one is found in constant time.
+ * Stacks are supplied by the application. The caller of Sched_Start()
+ * becomes the idle task, which runs whenever no task is ready.
+ *
+ * Context switches run in the SysTick interrupt, triggered in software by
+ * SYSTICK_CTLR_SWIE; Sched_SysTickHandler() must be installed as SysTick
+ * handler and is given the lowest PFIC priority, so it never preempts
+ * another handler. The handler saves all 12 registers besides sp, gp and tp
+ * plus mepc (13 words) on the task stack. Sched_Start() disables the
+ * hardware prologue/epilogue (HPE): tools/rv32ec_sim.c models its register
+ * stacking as core-internal, where registers cannot be switched with the
+ * task, and no task-stack layout has been verified on hardware. Handlers
+ * must therefore not use USE_WCH_INTERRUPT_FAST_ATTR.
+ *
+ * Cost per switch (tests/target/bench_sched.s, simulator at 0 wait states):
+ * handler code 36 instructions/39 cycles, the verbatim inline assembly.
+ * Sched_Switch() adds an estimated 49/54 and interrupt entry to mret takes
+ * an estimated 93 cycles; both come from a hand translation of -Os code.
+ * With a cross compiler, tests/target builds the bench from this module and
+ * reports the measured figures ("make -C tests/target sched-c").
+ *
+ * @date  16.10.2026
+ ******************************************************************************/
+
+#ifndef CORE_RISCV_SCHED_H_
+#define CORE_RISCV_SCHED_H_
+
+#ifndef CORE_RISCV_H_
+#error "core_riscv.h must be included (via the device header) first"
+#endif /* CORE_RISCV_H_ */
+
+#include <stddef.h>
+
+#ifdef USE_WCH_INTERRUPT_FAST_ATTR
+#error "USE_WCH_INTERRUPT_FAST_ATTR handlers need HPE, which the scheduler disables"
+#endif
+
+#ifdef SCHED_USE_HPE
+#error "SCHED_USE_HPE is not supported: HPE register stacking cannot be switched"
+#endif
+
+/* Number of task priority levels (1..32)                                     */
+#ifndef SCHED_PRIOS
+#define SCHED_PRIOS                   8U
+#endif /* SCHED_PRIOS */
+
+/* Interrupt used for context switches                                        */
+#ifndef SCHED_IRQn
+#define SCHED_IRQn                    SysTicK_IRQn
+#endif /* SCHED_IRQn */
+
+/* Software-saved context frame size in words                                 */
+#define SCHED_FRAME_WORDS             13U
+
+/* Minimum task stack size in words (frame plus some call depth)              */
+#define SCHED_STACK_MIN               (SCHED_FRAME_WORDS + 16U)
+
+/* Task entry function                                                        */
+typedef void (*Sched_Entry_t)(void* arg);
+
+/* Task control block, statically allocated by the application                */
+typedef struct {
+  uint32_t* pulSP;            /*!< Saved stack pointer (must be first)        */
+  uint32_t ulDelay;           /*!< Remaining delay ticks                      */
+  Sched_Entry_t pfnEntry;
+  void* pvArg;
+  uint8_t ucPrio;
+} Sched_Task_t;
+
+/*!****************************************************************************
+ * @brief
+ * Create task, ready to run once the scheduler is started
+ *
+ * @param[out] task       Task control block
+ * @param[in] prio        Priority level (below SCHED_PRIOS), one task each
+ * @param[in] entry       Task function, may return to end the task
+ * @param[in] arg         Task function argument
+ * @param[in] stack       Stack memory
+ * @param[in] words       Stack size in words (at least SCHED_STACK_MIN)
+ * @return  (ErrorStatus)  ERROR if priority taken or stack too small
+ * @date  16.10.2026
+ ******************************************************************************/
+ErrorStatus Sched_Create(Sched_Task_t* task, uint8_t prio, Sched_Entry_t entry, void* arg,
+                         uint32_t* stack, uint32_t words);
+
+/*!****************************************************************************
+ * @brief
+ * Start scheduling, the caller continues as idle task
+ *
+ * Returns (as idle task) once no other task is ready.
+ *
+ * @date  16.10.2026
+ ******************************************************************************/
+void Sched_Start(void);
+
+/*!****************************************************************************
+ * @brief
+ * Request context switch at the next interrupt-enabled instruction
+ *
+ * @date  16.10.2026
+ ******************************************************************************/
+void Sched_Yield(void);
+
+/*!****************************************************************************
+ * @brief
+ * Block calling task for a number of Sched_Tick() periods
+ *
+ * @param[in] ticks       Delay in ticks, 0 just yields
+ * @date  16.10.2026
+ ******************************************************************************/
+void Sched_Delay(uint32_t ticks);
+
+/*!****************************************************************************
+ * @brief
+ * Block task until Sched_Resume()
+ *
+ * @param[in,out] task    Task, NULL for the calling task
+ * @date  16.10.2026
+ ******************************************************************************/
+void Sched_Suspend(Sched_Task_t* task);
+
+/*!****************************************************************************
+ * @brief
+ * Make task ready, also from interrupt handlers
+ *
+ * Tasks that have ended (Sched_Exit()) are ignored.
+ *
+ * @param[in,out] task    Task
+ * @date  16.10.2026
+ ******************************************************************************/
+void Sched_Resume(Sched_Task_t* task);
+
+/*!****************************************************************************
+ * @brief
+ * End calling task
+ *
+ * @date  16.10.2026
+ ******************************************************************************/
+void Sched_Exit(void) __attribute__((noreturn));
+
+/*!****************************************************************************
+ * @brief
+ * Advance delays by one tick, from the tick interrupt
+ *
+ * @date  16.10.2026
+ ******************************************************************************/
+void Sched_Tick(void);
+
+/*!****************************************************************************
+ * @brief
+ * Get running task
+ *
+ * @return  (Sched_Task_t*)  Running task, NULL for the idle task
+ * @date  16.10.2026
+ ******************************************************************************/
+Sched_Task_t* Sched_GetCurrent(void);
+
+/*!****************************************************************************
+ * @brief
+ * Get number of context switches
+ *
+ * @return  (uint32_t)  Context switches since Sched_Start()
+ * @date  16.10.2026
+ ******************************************************************************/
+uint32_t Sched_GetSwitches(void);
+
+/*!****************************************************************************
+ * @brief
+ * Save context and select next task, called by Sched_SysTickHandler()
+ *
+ * @param[in] sp          Stack pointer of the interrupted task
+ * @return  (uint32_t*)  Stack pointer of the task to resume
+ * @date  16.10.2026
+ ******************************************************************************/
+uint32_t* Sched_Switch(uint32_t* sp);
+
+/*!****************************************************************************
+ * @brief
+ * SysTick interrupt handler performing the context switch
+ *
+ * @date  16.10.2026
+ ******************************************************************************/
+void Sched_SysTickHandler(void);
+
+/*!****************************************************************************
+ * @brief
+ * Hook: SysTick counter interrupt (CNTIF) seen by the switch handler
+ *
+ * @note
+ * Weak default clears CNTIF and calls Sched_Tick(). Override to drive other
+ * SysTick users, e.g. Tickless_TickHandler().
+ *
+ * @date  16.10.2026
+ ******************************************************************************/
+void Sched_OnSysTick(void);
+
+#endif /* CORE_RISCV_SCHED_H_ */
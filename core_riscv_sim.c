@@ -0,0 +1,327 @@
+/*!****************************************************************************
+ * @file
+ * core_riscv_sim.c
+ *
+ * @brief
+ * RISC-V2A Host Simulation of the Core Peripheral Register File
+ *
+ * @date  16.10.2026
+ ******************************************************************************/
+
+#include <string.h>
+#include "core_riscv_sim.h"
+
+/* PFIC register byte offsets                                                 */
+#define PFIC_OFS_ISR                  0x000UL
+#define PFIC_OFS_IPR                  0x020UL
+#define PFIC_OFS_CFGR                 0x048UL
+#define PFIC_OFS_IENR                 0x100UL
+#define PFIC_OFS_IRER                 0x180UL
+#define PFIC_OFS_IPSR                 0x200UL
+#define PFIC_OFS_IPRR                 0x280UL
+#define PFIC_OFS_IPRIOR               0x400UL
+#define PFIC_OFS_IPRIOR_END           0x500UL
+#define PFIC_OFS_SCTLR                0xD10UL
+#define PFIC_BANK_SIZE                0x020UL
+
+/* SysTick register byte offsets                                              */
+#define SYSTICK_OFS_CTLR              0x00UL
+#define SYSTICK_OFS_SR                0x04UL
+#define SYSTICK_OFS_CNTR              0x08UL
+#define SYSTICK_OFS_CMPR              0x10UL
+
+/* Register bits used by the simulation                                       */
+#define SIM_CFGR_KEY3_RESETSYS        0xBEEF0080UL
+#define SIM_SCTLR_SETEVENT            0x00000020UL
+#define SIM_SCTLR_SYSRESET            0x80000000UL
+#define SIM_SYSTICK_CTLR_STE          0x00000001UL
+#define SIM_SYSTICK_CTLR_STRE         0x00000008UL
+#define SIM_SYSTICK_SR_CNTIF          0x00000001UL
+
+/* Register word access helpers                                               */
+#define PFIC_REG(ofs)                 RVSim_PFICMem[(ofs) >> 2]
+#define SYSTICK_REG(ofs)              RVSim_SysTickMem[(ofs) >> 2]
+
+/* Simulated CSR file                                                         */
+typedef struct {
+  const char* pcName;
+  uint32_t ulValue;
+} RVSim_CSR_t;
+
+enum {
+  CSR_MSTATUS = 0, CSR_MISA, CSR_MIE, CSR_MTVEC, CSR_MSCRATCH, CSR_MEPC,
+  CSR_MCAUSE, CSR_MTVAL, CSR_MIP, CSR_MCYCLE, CSR_MCYCLEH, CSR_MINSTRET,
+  CSR_MINSTRETH, CSR_MVENDORID, CSR_MARCHID, CSR_MIMPID, CSR_MHARTID,
+  CSR_DEBUGCR, CSR_INTSYSCR, CSR_COUNT
+};
+
+static RVSim_CSR_t axCSR[CSR_COUNT] = {
+  [CSR_MSTATUS]   = { "mstatus",   0 },
+  [CSR_MISA]      = { "misa",      0 },
+  [CSR_MIE]       = { "mie",       0 },
+  [CSR_MTVEC]     = { "mtvec",     0 },
+  [CSR_MSCRATCH]  = { "mscratch",  0 },
+  [CSR_MEPC]      = { "mepc",      0 },
+  [CSR_MCAUSE]    = { "mcause",    0 },
+  [CSR_MTVAL]     = { "mtval",     0 },
+  [CSR_MIP]       = { "mip",       0 },
+  [CSR_MCYCLE]    = { "mcycle",    0 },
+  [CSR_MCYCLEH]   = { "mcycleh",   0 },
+  [CSR_MINSTRET]  = { "minstret",  0 },
+  [CSR_MINSTRETH] = { "minstreth", 0 },
+  [CSR_MVENDORID] = { "mvendorid", 0 },
+  [CSR_MARCHID]   = { "marchid",   0 },
+  [CSR_MIMPID]    = { "mimpid",    0 },
+  [CSR_MHARTID]   = { "mhartid",   0 },
+  [CSR_DEBUGCR]   = { "0x7c0",     0 },
+  [CSR_INTSYSCR]  = { "0x804",     0 },
+};
+
+/* Reset value of misa: MXL=32, E and C extensions                            */
+#define SIM_MISA_RV32EC               0x40000014UL
+
+uint32_t RVSim_PFICMem[RVSIM_PFIC_WORDS];
+uint32_t RVSim_SysTickMem[RVSIM_SYSTICK_WORDS];
+RVSim_State_t RVSim_State;
+
+/*!****************************************************************************
+ * @brief
+ * Look up simulated CSR by name
+ *
+ * @param[in] csr         CSR name or number
+ * @return  (RVSim_CSR_t*)  CSR entry, NULL if not simulated
+ * @date  16.10.2026
+ ******************************************************************************/
+static RVSim_CSR_t* prvFindCSR(const char* csr)
+{
+  for (uint32_t i = 0; i < CSR_COUNT; ++i)
+  {
+    if (strcmp(axCSR[i].pcName, csr) == 0) return &axCSR[i];
+  }
+  return NULL;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Advance a 64-bit counter split across two CSRs
+ *
+ * @param[in] lo          Low word CSR index
+ * @param[in] hi          High word CSR index
+ * @param[in] step        Increment
+ * @date  16.10.2026
+ ******************************************************************************/
+static void prvAdvanceCounter(uint32_t lo, uint32_t hi, uint32_t step)
+{
+  uint32_t ulOld = axCSR[lo].ulValue;
+  axCSR[lo].ulValue = ulOld + step;
+  if (axCSR[lo].ulValue < ulOld) axCSR[hi].ulValue++;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Reset simulated register files, CSRs and statistics to power-on values
+ *
+ * @date  16.10.2026
+ ******************************************************************************/
+void RVSim_Reset(void)
+{
+  memset(RVSim_PFICMem, 0, sizeof(RVSim_PFICMem));
+  memset(RVSim_SysTickMem, 0, sizeof(RVSim_SysTickMem));
+  for (uint32_t i = 0; i < CSR_COUNT; ++i) axCSR[i].ulValue = 0;
+  axCSR[CSR_MISA].ulValue = SIM_MISA_RV32EC;
+
+  memset(&RVSim_State, 0, sizeof(RVSim_State));
+  RVSim_State.ulCntStep = 1;
+  RVSim_State.ulCycleStep = 1;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Reset register access statistics
+ *
+ * @date  16.10.2026
+ ******************************************************************************/
+void RVSim_ResetCounters(void)
+{
+  RVSim_State.ulReads = 0;
+  RVSim_State.ulWrites = 0;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Advance the SysTick counter
+ *
+ * Sets CNTIF when CNTR passes CMPR. With STRE set, the counter restarts from
+ * zero after reaching CMPR.
+ *
+ * @param[in] counts      Number of SysTick counts to advance (if enabled)
+ * @date  16.10.2026
+ ******************************************************************************/
+void RVSim_AdvanceSysTick(uint32_t counts)
+{
+  uint32_t ulCtlr = SYSTICK_REG(SYSTICK_OFS_CTLR);
+  uint32_t ulCnt = SYSTICK_REG(SYSTICK_OFS_CNTR);
+  uint32_t ulCmp = SYSTICK_REG(SYSTICK_OFS_CMPR);
+
+  if (!(ulCtlr & SIM_SYSTICK_CTLR_STE) || (counts == 0)) return;
+
+  if ((ulCtlr & SIM_SYSTICK_CTLR_STRE) && (ulCnt <= ulCmp))
+  {
+    uint64_t ullPos = (uint64_t)ulCnt + counts;
+    if ((ullPos >= ulCmp) && ((ulCnt < ulCmp) || (counts > ulCmp)))
+    {
+      SYSTICK_REG(SYSTICK_OFS_SR) |= SIM_SYSTICK_SR_CNTIF;
+    }
+    ulCnt = (uint32_t)(ullPos % ((uint64_t)ulCmp + 1ULL));
+  }
+  else
+  {
+    if ((uint32_t)(ulCmp - ulCnt - 1UL) < counts)
+    {
+      SYSTICK_REG(SYSTICK_OFS_SR) |= SIM_SYSTICK_SR_CNTIF;
+    }
+    ulCnt += counts;
+  }
+  SYSTICK_REG(SYSTICK_OFS_CNTR) = ulCnt;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Read from a simulated register
+ *
+ * @param[in] reg         Register address inside a simulated register file
+ * @return  (uint32_t)  Register value
+ * @date  16.10.2026
+ ******************************************************************************/
+uint32_t RVSim_Read(const volatile uint32_t* reg)
+{
+  const uint32_t* pulReg = (const uint32_t*)reg;
+  RVSim_State.ulReads++;
+
+  if (pulReg == &SYSTICK_REG(SYSTICK_OFS_CNTR))
+  {
+    /* Free-running counter: every observation advances time               */
+    uint32_t ulValue = *pulReg;
+    RVSim_AdvanceSysTick(RVSim_State.ulCntStep);
+    return ulValue;
+  }
+  return *pulReg;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Write to a simulated register, applying hardware side effects
+ *
+ * @param[in] reg         Register address inside a simulated register file
+ * @param[in] value       Value to be written
+ * @date  16.10.2026
+ ******************************************************************************/
+void RVSim_Write(volatile uint32_t* reg, uint32_t value)
+{
+  uint32_t* pulReg = (uint32_t*)reg;
+  RVSim_State.ulWrites++;
+
+  if ((pulReg >= RVSim_PFICMem) && (pulReg < &RVSim_PFICMem[RVSIM_PFIC_WORDS]))
+  {
+    uint32_t ulOfs = (uint32_t)(pulReg - RVSim_PFICMem) << 2;
+    uint32_t ulBank = (ulOfs & (PFIC_BANK_SIZE - 1UL));
+
+    if ((ulOfs >= PFIC_OFS_IENR) && (ulOfs < PFIC_OFS_IENR + PFIC_BANK_SIZE))
+    {
+      PFIC_REG(PFIC_OFS_ISR + ulBank) |= value;
+    }
+    else if ((ulOfs >= PFIC_OFS_IRER) && (ulOfs < PFIC_OFS_IRER + PFIC_BANK_SIZE))
+    {
+      PFIC_REG(PFIC_OFS_ISR + ulBank) &= ~value;
+    }
+    else if ((ulOfs >= PFIC_OFS_IPSR) && (ulOfs < PFIC_OFS_IPSR + PFIC_BANK_SIZE))
+    {
+      PFIC_REG(PFIC_OFS_IPR + ulBank) |= value;
+    }
+    else if ((ulOfs >= PFIC_OFS_IPRR) && (ulOfs < PFIC_OFS_IPRR + PFIC_BANK_SIZE))
+    {
+      PFIC_REG(PFIC_OFS_IPR + ulBank) &= ~value;
+    }
+    else if ((ulOfs >= PFIC_OFS_IPRIOR) && (ulOfs < PFIC_OFS_IPRIOR_END))
+    {
+      *pulReg = value & RVSIM_IPRIOR_MASK;
+    }
+    else if (ulOfs == PFIC_OFS_CFGR)
+    {
+      if (value == SIM_CFGR_KEY3_RESETSYS) RVSim_State.ulResetRequests++;
+    }
+    else if (ulOfs == PFIC_OFS_SCTLR)
+    {
+      if (value & SIM_SCTLR_SETEVENT) RVSim_State.ulEvents++;
+      if (value & SIM_SCTLR_SYSRESET) RVSim_State.ulResetRequests++;
+      *pulReg = value & ~(SIM_SCTLR_SETEVENT | SIM_SCTLR_SYSRESET);
+    }
+    else
+    {
+      *pulReg = value;
+    }
+  }
+  else
+  {
+    *pulReg = value;
+  }
+}
+
+/*!****************************************************************************
+ * @brief
+ * Read simulated CSR
+ *
+ * @param[in] csr         CSR name or number, as used in the CSR templates
+ * @return  (uint32_t)  CSR value
+ * @date  16.10.2026
+ ******************************************************************************/
+uint32_t RVSim_ReadCSR(const char* csr)
+{
+  RVSim_CSR_t* pxCSR = prvFindCSR(csr);
+  uint32_t ulValue;
+
+  if (pxCSR == NULL) return 0;
+  ulValue = pxCSR->ulValue;
+
+  if (pxCSR == &axCSR[CSR_MCYCLE])
+  {
+    prvAdvanceCounter(CSR_MCYCLE, CSR_MCYCLEH, RVSim_State.ulCycleStep);
+  }
+  else if (pxCSR == &axCSR[CSR_MINSTRET])
+  {
+    prvAdvanceCounter(CSR_MINSTRET, CSR_MINSTRETH, 1UL);
+  }
+  return ulValue;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Write simulated CSR
+ *
+ * @param[in] csr         CSR name or number, as used in the CSR templates
+ * @param[in] value       CSR value
+ * @date  16.10.2026
+ ******************************************************************************/
+void RVSim_WriteCSR(const char* csr, uint32_t value)
+{
+  RVSim_CSR_t* pxCSR = prvFindCSR(csr);
+  if (pxCSR != NULL) pxCSR->ulValue = value;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Simulated WFI/WFE: records the wait and advances SysTick up to the next
+ * compare match, so that polling loops on CNTIF terminate
+ *
+ * @date  16.10.2026
+ ******************************************************************************/
+void RVSim_WaitForInterrupt(void)
+{
+  uint32_t ulDist = SYSTICK_REG(SYSTICK_OFS_CMPR) - SYSTICK_REG(SYSTICK_OFS_CNTR);
+
+  RVSim_State.ulWaits++;
+  if (!(SYSTICK_REG(SYSTICK_OFS_SR) & SIM_SYSTICK_SR_CNTIF))
+  {
+    RVSim_AdvanceSysTick((ulDist != 0) ? ulDist : 1UL);
+  }
+}
@@ -0,0 +1,128 @@
+/*!****************************************************************************
+ * @file
+ * core_riscv_sim.h
+ *
+ * @brief
+ * RISC-V2A Host Simulation of the Core Peripheral Register File
+ *
+ * Enabled by defining USE_HOST_SIM before including core_riscv.h. The PFIC
+ * and SysTick access macros are then redirected to simulated register files,
+ * all register accesses of the core API are routed through RVSim_Read() and
+ * RVSim_Write(), and CSR accesses are served from a simulated CSR file. The
+ * simulation models:
+ *  - write-1-to-set/clear banks IENR/IRER (-> ISR) and IPSR/IPRR (-> IPR)
+ *  - IPRIOR packing with unimplemented priority bits reading as zero
+ *  - VTFIDR/VTFADDRR channel configuration
+ *  - free-running CNTR with CMPR match, CNTIF and auto-reload (STRE)
+ *
+ * @date  16.10.2026
+ ******************************************************************************/
+
+#ifndef CORE_RISCV_SIM_H_
+#define CORE_RISCV_SIM_H_
+
+#include <stdint.h>
+
+/* Simulated register file sizes in words                                     */
+#define RVSIM_PFIC_WORDS              (0x1000UL / 4UL)
+#define RVSIM_SYSTICK_WORDS           (0x18UL / 4UL)
+
+/* Implemented priority bits of each IPRIOR byte lane (V2A: 2 bits)           */
+#define RVSIM_IPRIOR_MASK             0xC0C0C0C0UL
+
+/* Register access primitives                                                 */
+#define RV_REG_READ(reg)              RVSim_Read(&(reg))
+#define RV_REG_WRITE(reg, val)        RVSim_Write(&(reg), (uint32_t)(val))
+
+/* Simulated register files (backing store for PFIC and SysTick)              */
+extern uint32_t RVSim_PFICMem[RVSIM_PFIC_WORDS];
+extern uint32_t RVSim_SysTickMem[RVSIM_SYSTICK_WORDS];
+
+/* Simulator state and access statistics                                      */
+typedef struct {
+  uint32_t ulReads;           /*!< Register reads since last reset            */
+  uint32_t ulWrites;          /*!< Register writes since last reset           */
+  uint32_t ulCntStep;         /*!< SysTick counts advanced per CNTR read      */
+  uint32_t ulCycleStep;       /*!< Cycles advanced per mcycle read            */
+  uint32_t ulResetRequests;   /*!< System reset requests (CFGR / SCTLR)       */
+  uint32_t ulEvents;          /*!< SEV requests (SCTLR SETEVENT)              */
+  uint32_t ulWaits;           /*!< WFI/WFE executions                         */
+} RVSim_State_t;
+
+extern RVSim_State_t RVSim_State;
+
+/*!****************************************************************************
+ * @brief
+ * Reset simulated register files, CSRs and statistics to power-on values
+ *
+ * @date  16.10.2026
+ ******************************************************************************/
+void RVSim_Reset(void);
+
+/*!****************************************************************************
+ * @brief
+ * Reset register access statistics
+ *
+ * @date  16.10.2026
+ ******************************************************************************/
+void RVSim_ResetCounters(void);
+
+/*!****************************************************************************
+ * @brief
+ * Read from a simulated register
+ *
+ * @param[in] reg         Register address inside a simulated register file
+ * @return  (uint32_t)  Register value
+ * @date  16.10.2026
+ ******************************************************************************/
+uint32_t RVSim_Read(const volatile uint32_t* reg);
+
+/*!****************************************************************************
+ * @brief
+ * Write to a simulated register, applying hardware side effects
+ *
+ * @param[in] reg         Register address inside a simulated register file
+ * @param[in] value       Value to be written
+ * @date  16.10.2026
+ ******************************************************************************/
+void RVSim_Write(volatile uint32_t* reg, uint32_t value);
+
+/*!****************************************************************************
+ * @brief
+ * Advance the SysTick counter
+ *
+ * @param[in] counts      Number of SysTick counts to advance (if enabled)
+ * @date  16.10.2026
+ ******************************************************************************/
+void RVSim_AdvanceSysTick(uint32_t counts);
+
+/*!****************************************************************************
+ * @brief
+ * Read simulated CSR
+ *
+ * @param[in] csr         CSR name or number, as used in the CSR templates
+ * @return  (uint32_t)  CSR value
+ * @date  16.10.2026
+ ******************************************************************************/
+uint32_t RVSim_ReadCSR(const char* csr);
+
+/*!****************************************************************************
+ * @brief
+ * Write simulated CSR
+ *
+ * @param[in] csr         CSR name or number, as used in the CSR templates
+ * @param[in] value       CSR value
+ * @date  16.10.2026
+ ******************************************************************************/
+void RVSim_WriteCSR(const char* csr, uint32_t value);
+
+/*!****************************************************************************
+ * @brief
+ * Simulated WFI/WFE: records the wait and advances SysTick up to the next
+ * compare match, so that polling loops on CNTIF terminate
+ *
+ * @date  16.10.2026
+ ******************************************************************************/
+void RVSim_WaitForInterrupt(void);
+
+#endif /* CORE_RISCV_SIM_H_ */
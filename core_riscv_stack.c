@@ -0,0 +1,91 @@
+/*!****************************************************************************
+ * @file
+ * core_riscv_stack.c
+ *
+ * @brief
+ * RISC-V2A Stack Painting and High-Water-Mark Monitoring
+ *
+ * @note
+ * Build with RV_DEVICE_HEADER set to the device header, which includes
+ * core_riscv.h (e.g. -DRV_DEVICE_HEADER=\"ch32v00x.h\").
+ *
+ * @date  16.10.2026
+ ******************************************************************************/
+
+#include RV_DEVICE_HEADER
+#include "core_riscv_stack.h"
+
+/* Lowest SP seen per nesting level                                           */
+volatile uint32_t Stack_MinSP[STACK_LEVELS] = { UINT32_MAX, UINT32_MAX, UINT32_MAX };
+
+/* Lowest overwritten word found so far (scan limit)                          */
+static const uint32_t* pulMark = _estack;
+
+/*!****************************************************************************
+ * @brief
+ * Paint the unused stack below the caller's stack frame
+ *
+ * @date  16.10.2026
+ ******************************************************************************/
+void Stack_Paint(void)
+{
+  uint32_t* pulTop = (uint32_t*)(uintptr_t)(__get_SP() & ~3UL);
+  uint32_t* pulWord = _sstack;
+
+  /* No calls below this point, so nothing lives under the current SP       */
+  while (pulWord < pulTop) *pulWord++ = STACK_PAINT_PATTERN;
+  pulMark = pulTop;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Scan for the stack high-water mark
+ *
+ * @return  (uint32_t)  Deepest stack use since painting in bytes
+ * @date  16.10.2026
+ ******************************************************************************/
+uint32_t Stack_GetHighWater(void)
+{
+  const uint32_t* pulWord = _sstack;
+  const uint32_t* pulEnd = pulMark;
+
+  while (((pulEnd - pulWord) >= 4) &&
+         (((pulWord[0] ^ STACK_PAINT_PATTERN) | (pulWord[1] ^ STACK_PAINT_PATTERN) |
+           (pulWord[2] ^ STACK_PAINT_PATTERN) | (pulWord[3] ^ STACK_PAINT_PATTERN)) == 0))
+  {
+    pulWord += 4;
+  }
+  while ((pulWord < pulEnd) && (*pulWord == STACK_PAINT_PATTERN)) pulWord++;
+
+  pulMark = pulWord;
+  return (uint32_t)((uintptr_t)_estack - (uintptr_t)pulWord);
+}
+
+/*!****************************************************************************
+ * @brief
+ * Get stack usage statistics (scans for the high-water mark)
+ *
+ * @param[out] stats      Statistics
+ * @date  16.10.2026
+ ******************************************************************************/
+void Stack_GetStats(Stack_Stats_t* stats)
+{
+  stats->ulSize = (uint32_t)((uintptr_t)_estack - (uintptr_t)_sstack);
+  stats->ulHighWater = Stack_GetHighWater();
+  for (uint32_t i = 0; i < STACK_LEVELS; ++i)
+  {
+    uint32_t ulSP = Stack_MinSP[i];
+    stats->ulLevelMax[i] = (ulSP != UINT32_MAX) ? ((uint32_t)(uintptr_t)_estack - ulSP) : 0;
+  }
+}
+
+/*!****************************************************************************
+ * @brief
+ * Reset the per-level SP records
+ *
+ * @date  16.10.2026
+ ******************************************************************************/
+void Stack_ResetStats(void)
+{
+  for (uint32_t i = 0; i < STACK_LEVELS; ++i) Stack_MinSP[i] = UINT32_MAX;
+}
@@ -0,0 +1,107 @@
+/*!****************************************************************************
+ * @file
+ * core_riscv_stack.h
+ *
+ * @brief
+ * RISC-V2A Stack Painting and High-Water-Mark Monitoring
+ *
+ * The stack region _sstack.._estack (both word aligned, defined by the
+ * linker script) is filled with STACK_PAINT_PATTERN, either by the startup
+ * code (assembler option USE_STACK_PAINT) or by Stack_Paint(). The deepest
+ * stack use is then found by scanning upwards for the first overwritten
+ * word. The scan stops at the mark found by the previous scan, so it only
+ * reads the still unused part of the stack, four words per iteration.
+ *
+ * STACK_CHECK() at interrupt handler entry additionally records the lowest
+ * SP seen per nesting level (0: thread, 1 and 2: nested interrupts, from
+ * GISR), at the cost of a few instructions and no locking. It compiles to
+ * nothing unless USE_STACK_CHECK is defined.
+ *
+ * @date  16.10.2026
+ ******************************************************************************/
+
+#ifndef CORE_RISCV_STACK_H_
+#define CORE_RISCV_STACK_H_
+
+#ifndef CORE_RISCV_H_
+#error "core_riscv.h must be included (via the device header) first"
+#endif /* CORE_RISCV_H_ */
+
+/* Paint pattern, must match STACK_PAINT_PATTERN of the startup code          */
+#ifndef STACK_PAINT_PATTERN
+#define STACK_PAINT_PATTERN           0xA5A5A5A5UL
+#endif /* STACK_PAINT_PATTERN */
+
+/* Number of tracked levels: thread mode plus two interrupt nesting levels    */
+#define STACK_LEVELS                  3U
+
+/* Stack region, from the linker script                                       */
+extern uint32_t _sstack[];
+extern uint32_t _estack[];
+
+/* Lowest SP seen per nesting level                                           */
+extern volatile uint32_t Stack_MinSP[STACK_LEVELS];
+
+/* Stack usage statistics in bytes                                            */
+typedef struct {
+  uint32_t ulSize;            /*!< Stack region size                          */
+  uint32_t ulHighWater;       /*!< Deepest use found by painting              */
+  uint32_t ulLevelMax[STACK_LEVELS];  /*!< Deepest SP per level, 0 if unseen  */
+} Stack_Stats_t;
+
+/*!****************************************************************************
+ * @brief
+ * Paint the unused stack below the caller's stack frame
+ *
+ * @date  16.10.2026
+ ******************************************************************************/
+void Stack_Paint(void);
+
+/*!****************************************************************************
+ * @brief
+ * Scan for the stack high-water mark
+ *
+ * @return  (uint32_t)  Deepest stack use since painting in bytes
+ * @date  16.10.2026
+ ******************************************************************************/
+uint32_t Stack_GetHighWater(void);
+
+/*!****************************************************************************
+ * @brief
+ * Get stack usage statistics (scans for the high-water mark)
+ *
+ * @param[out] stats      Statistics
+ * @date  16.10.2026
+ ******************************************************************************/
+void Stack_GetStats(Stack_Stats_t* stats);
+
+/*!****************************************************************************
+ * @brief
+ * Reset the per-level SP records
+ *
+ * @date  16.10.2026
+ ******************************************************************************/
+void Stack_ResetStats(void);
+
+/*!****************************************************************************
+ * @brief
+ * Record current SP for the active nesting level
+ *
+ * @date  16.10.2026
+ ******************************************************************************/
+RV_STATIC_FORCE_INLINE void Stack_Check(void)
+{
+  uint32_t ulSP = __get_SP();
+  uint32_t ulNest = RV_REG_READ(PFIC->GISR) & 0x3UL;
+  uint32_t ulLevel = ulNest - (ulNest >> 1);  /* 0b00/0b01/0b11: level 0/1/2  */
+
+  if (ulSP < Stack_MinSP[ulLevel]) Stack_MinSP[ulLevel] = ulSP;
+}
+
+#ifdef USE_STACK_CHECK
+#define STACK_CHECK()                 Stack_Check()
+#else
+#define STACK_CHECK()                 do {} while (0)
+#endif /* USE_STACK_CHECK */
+
+#endif /* CORE_RISCV_STACK_H_ */
@@ -0,0 +1,342 @@
+/*!****************************************************************************
+ * @file
+ * core_riscv_tickless.c
+ *
+ * @brief
+ * RISC-V2A Tickless Idle Power Management
+ *
+ * @note
+ * Build with RV_DEVICE_HEADER set to the device header, which includes
+ * core_riscv.h (e.g. -DRV_DEVICE_HEADER=\"ch32v00x.h\").
+ *
+ * @date  16.10.2026
+ ******************************************************************************/
+
+#include RV_DEVICE_HEADER
+#include "core_riscv_tickless.h"
+
+/* Tick count, last tick boundary and tick period (SysTick counts)            */
+static volatile uint32_t ulTicks;
+static uint32_t ulLastCnt;
+static uint32_t ulPeriod;
+
+/* Longest sleep in ticks, keeps the CMPR distance below half the CNTR range  */
+static uint32_t ulMaxTicks;
+
+/* Sleep statistics                                                           */
+static Tickless_Stats_t xStats;
+
+/*!****************************************************************************
+ * @brief
+ * Account for ticks elapsed since the last tick boundary
+ *
+ * @return  (uint32_t)  Number of ticks added
+ * @date  16.10.2026
+ ******************************************************************************/
+static uint32_t prvAnnounce(void)
+{
+  uint32_t ulElapsed = SysTick_GetValue() - ulLastCnt;
+  uint32_t ulNum;
+
+  if (ulElapsed < ulPeriod) return 0;
+
+  if (ulElapsed - ulPeriod < ulPeriod)
+  {
+    /* Regular tick: avoid the division                                     */
+    ulNum = 1;
+    ulLastCnt += ulPeriod;
+  }
+  else
+  {
+    ulNum = ulElapsed / ulPeriod;
+    ulLastCnt += ulNum * ulPeriod;
+  }
+  ulTicks += ulNum;
+  return ulNum;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Program the compare register for a tick boundary
+ *
+ * @param[in] ticks       Ticks from the last tick boundary
+ * @return  (ErrorStatus)  ERROR if the compare value already passed
+ * @date  16.10.2026
+ ******************************************************************************/
+static ErrorStatus prvArm(uint32_t ticks)
+{
+  uint32_t ulCmp = ulLastCnt + ((ticks == 1) ? ulPeriod : ticks * ulPeriod);
+
+  SysTick_SetCompare(ulCmp);
+  return ((int32_t)(ulCmp - SysTick_GetValue()) > 0) ? SUCCESS : ERROR;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Program the compare register for the next deadline
+ *
+ * Arms the compare for the deadline reported by Tickless_NextDeadline(), at
+ * least one and at most ulMaxTicks ticks ahead. Ticks that pass while arming
+ * are accounted for and the compare is retried one tick ahead.
+ *
+ * @param[in] idle        Ticks until the deadline (Tickless_NextDeadline())
+ * @date  16.10.2026
+ ******************************************************************************/
+static void prvArmDeadline(uint32_t idle)
+{
+  uint32_t ulIdle = idle;
+
+  if (ulIdle == 0) ulIdle = 1;
+  if (ulIdle > ulMaxTicks) ulIdle = ulMaxTicks;
+  if (prvArm(ulIdle) == SUCCESS) return;
+
+  do
+  {
+    prvAnnounce();
+  } while (prvArm(1) != SUCCESS);
+}
+
+/*!****************************************************************************
+ * @brief
+ * Initialise SysTick as free-running tickless timebase
+ *
+ * @param[in] period      Tick period in SysTick counts
+ * @param[in] clk         SysTick clock source (SYSTICK_CTLR_STCLK_DIVx)
+ * @date  16.10.2026
+ ******************************************************************************/
+void Tickless_Init(uint32_t period, uint32_t clk)
+{
+  RV_REG_WRITE(SysTick->CTLR, 0);
+  RV_REG_WRITE(SysTick->SR, 0);
+  SysTick_SetValue(0);
+  SysTick_SetCompare(period);
+
+  ulTicks = 0;
+  ulLastCnt = 0;
+  ulPeriod = period;
+  ulMaxTicks = 0x7FFFFFFFUL / period;
+  Tickless_ResetStats();
+
+  /* Pending interrupts wake WFE even while masked                          */
+  RV_REG_WRITE(PFIC->SCTLR, RV_REG_READ(PFIC->SCTLR) | PFIC_SCTLR_SEVONPEND);
+  RV_REG_WRITE(SysTick->CTLR, SYSTICK_CTLR_STE | SYSTICK_CTLR_STIE | (clk & SYSTICK_CTLR_STCLK));
+}
+
+/*!****************************************************************************
+ * @brief
+ * SysTick compare interrupt handler
+ *
+ * Accounts for elapsed ticks, calls Tickless_OnTick() and arms the compare
+ * for the next deadline only.
+ *
+ * @return  (uint32_t)  Number of ticks elapsed since previous call
+ * @date  16.10.2026
+ ******************************************************************************/
+uint32_t Tickless_TickHandler(void)
+{
+  uint32_t ulNum;
+
+  RV_REG_WRITE(SysTick->SR, 0);
+  ulNum = prvAnnounce();
+  Tickless_OnTick(ulTicks);
+  prvArmDeadline(Tickless_NextDeadline(ulTicks));
+  return ulNum;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Re-program the compare register after the next deadline changed
+ *
+ * @date  16.10.2026
+ ******************************************************************************/
+void Tickless_Rearm(void)
+{
+  uint32_t ulState = __disable_irq_save();
+  prvAnnounce();
+  prvArmDeadline(Tickless_NextDeadline(ulTicks));
+  __restore_irq(ulState);
+}
+
+/*!****************************************************************************
+ * @brief
+ * Enter the cheapest sleep state until the next deadline
+ *
+ * @return  (Tickless_State_t)  Sleep state that was used, TICKLESS_STATE_NONE
+ *                              if the deadline was already due
+ * @date  16.10.2026
+ ******************************************************************************/
+Tickless_State_t Tickless_Idle(void)
+{
+  Tickless_State_t eState = TICKLESS_STATE_WFE;
+  Tickless_Wake_t eWake;
+  uint32_t ulState = __disable_irq_save();
+  uint32_t ulIdle, ulStart, ulArmed, ulNum;
+
+  prvAnnounce();
+  ulIdle = Tickless_NextDeadline(ulTicks);
+  if (ulIdle == 0)
+  {
+    /* Deadline due, nothing to wait for                                    */
+    __restore_irq(ulState);
+    return TICKLESS_STATE_NONE;
+  }
+
+  prvArmDeadline(ulIdle);
+  if (ulIdle > ulMaxTicks) ulIdle = ulMaxTicks;
+  ulStart = SysTick_GetValue();
+
+  if (ulIdle < TICKLESS_WFI_MIN_TICKS)
+  {
+    __WFE();
+    eWake = (RV_REG_READ(SysTick->SR) & SYSTICK_SR_CNTIF) ? TICKLESS_WAKE_TIMER : TICKLESS_WAKE_IRQ;
+    xStats.ullSleepCounts[eState] += SysTick_GetValue() - ulStart;
+  }
+  else if ((ulIdle >= TICKLESS_DEEP_MIN_TICKS) && ((ulArmed = Tickless_DeepSleepEnter(ulIdle)) != 0))
+  {
+    /* SysTick is halted in deep sleep, timebase is corrected from the hook */
+    eState = TICKLESS_STATE_DEEP;
+    RV_REG_WRITE(PFIC->SCTLR, RV_REG_READ(PFIC->SCTLR) | PFIC_SCTLR_SLEEPDEEP);
+    __WFI();
+    RV_REG_WRITE(PFIC->SCTLR, RV_REG_READ(PFIC->SCTLR) & ~PFIC_SCTLR_SLEEPDEEP);
+
+    ulNum = Tickless_DeepSleepExit();
+    ulTicks += ulNum;
+    eWake = (ulNum >= ulArmed) ? TICKLESS_WAKE_TIMER : TICKLESS_WAKE_IRQ;
+    xStats.ullSleepCounts[eState] += (uint64_t)ulNum * ulPeriod;
+    xStats.ulSkippedTicks += ulNum;
+
+    /* Deadlines reached during deep sleep are due now                      */
+    Tickless_OnTick(ulTicks);
+    prvArmDeadline(Tickless_NextDeadline(ulTicks));
+  }
+  else
+  {
+    eState = TICKLESS_STATE_WFI;
+    __WFI();
+    eWake = (RV_REG_READ(SysTick->SR) & SYSTICK_SR_CNTIF) ? TICKLESS_WAKE_TIMER : TICKLESS_WAKE_IRQ;
+    xStats.ullSleepCounts[eState] += SysTick_GetValue() - ulStart;
+
+    /* All but the final tick passed without an interrupt                   */
+    ulNum = prvAnnounce();
+    xStats.ulSkippedTicks += (ulNum > 1) ? (ulNum - 1) : 0;
+  }
+
+  xStats.ulSleepEntries[eState]++;
+  xStats.ulWakeReasons[eWake]++;
+  __restore_irq(ulState);
+  return eState;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Get tick count
+ *
+ * @return  (uint32_t)  Ticks since Tickless_Init()
+ * @date  16.10.2026
+ ******************************************************************************/
+uint32_t Tickless_GetTicks(void)
+{
+  uint32_t ulState = __disable_irq_save();
+  uint32_t ulNow;
+
+  prvAnnounce();
+  ulNow = ulTicks;
+  __restore_irq(ulState);
+  return ulNow;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Enable or disable sleep-on-exit
+ *
+ * @param[in] state       Enable or disable sleep-on-exit
+ * @date  16.10.2026
+ ******************************************************************************/
+void Tickless_SetSleepOnExit(FunctionalState state)
+{
+  uint32_t ulSctlr = RV_REG_READ(PFIC->SCTLR);
+
+  if (state != DISABLE) ulSctlr |= PFIC_SCTLR_SLEEPONEXIT;
+  else ulSctlr &= ~PFIC_SCTLR_SLEEPONEXIT;
+  RV_REG_WRITE(PFIC->SCTLR, ulSctlr);
+}
+
+/*!****************************************************************************
+ * @brief
+ * Get sleep statistics
+ *
+ * @param[out] stats      Copy of the statistics counters
+ * @date  16.10.2026
+ ******************************************************************************/
+void Tickless_GetStats(Tickless_Stats_t* stats)
+{
+  uint32_t ulState = __disable_irq_save();
+  *stats = xStats;
+  __restore_irq(ulState);
+}
+
+/*!****************************************************************************
+ * @brief
+ * Reset sleep statistics
+ *
+ * @date  16.10.2026
+ ******************************************************************************/
+void Tickless_ResetStats(void)
+{
+  uint32_t ulState = __disable_irq_save();
+  xStats = (Tickless_Stats_t){ 0 };
+  __restore_irq(ulState);
+}
+
+/* ############################ Application Hooks ########################### */
+/*!****************************************************************************
+ * @brief
+ * Get number of ticks until the next scheduled event (default: none)
+ *
+ * @param[in] now         Current tick count
+ * @return  (uint32_t)  Ticks until next event, TICKLESS_INFINITE if none
+ * @date  16.10.2026
+ ******************************************************************************/
+RV_WEAK uint32_t Tickless_NextDeadline(uint32_t now)
+{
+  (void)now;
+  return TICKLESS_INFINITE;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Process ticks from the SysTick interrupt (default: nothing to do)
+ *
+ * @param[in] now         Current tick count
+ * @date  16.10.2026
+ ******************************************************************************/
+RV_WEAK void Tickless_OnTick(uint32_t now)
+{
+  (void)now;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Arm platform wake-up timer for deep sleep (default: unavailable)
+ *
+ * @param[in] ticks       Requested sleep length in ticks
+ * @return  (uint32_t)  Armed sleep length in ticks, 0 if unavailable
+ * @date  16.10.2026
+ ******************************************************************************/
+RV_WEAK uint32_t Tickless_DeepSleepEnter(uint32_t ticks)
+{
+  (void)ticks;
+  return 0;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Disarm platform wake-up timer after deep sleep (default: no time passed)
+ *
+ * @return  (uint32_t)  Ticks actually spent in deep sleep
+ * @date  16.10.2026
+ ******************************************************************************/
+RV_WEAK uint32_t Tickless_DeepSleepExit(void)
+{
+  return 0;
+}
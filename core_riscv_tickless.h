@@ -0,0 +1,198 @@
+/*!****************************************************************************
+ * @file
+ * core_riscv_tickless.h
+ *
+ * @brief
+ * RISC-V2A Tickless Idle Power Management
+ *
+ * SysTick runs free (STRE cleared) and CMPR is only armed for the next
+ * deadline reported by Tickless_NextDeadline(), so no interrupts occur for
+ * ticks without work. The tick count is derived from CNTR. When idle, the
+ * sleep state is selected from the expected sleep length:
+ *  - WFE    below TICKLESS_WFI_MIN_TICKS (SEVONPEND wake)
+ *  - WFI    up to TICKLESS_DEEP_MIN_TICKS
+ *  - DEEP   SLEEPDEEP + WFI, if the platform provides a wake-up timer hook
+ *
+ * @date  16.10.2026
+ ******************************************************************************/
+
+#ifndef CORE_RISCV_TICKLESS_H_
+#define CORE_RISCV_TICKLESS_H_
+
+#ifndef CORE_RISCV_H_
+#error "core_riscv.h must be included (via the device header) first"
+#endif /* CORE_RISCV_H_ */
+
+/* Minimum expected idle ticks to sleep using WFI instead of WFE            */
+#ifndef TICKLESS_WFI_MIN_TICKS
+#define TICKLESS_WFI_MIN_TICKS        2UL
+#endif /* TICKLESS_WFI_MIN_TICKS */
+
+/* Minimum expected idle ticks to enter deep sleep (covers entry/exit cost)   */
+#ifndef TICKLESS_DEEP_MIN_TICKS
+#define TICKLESS_DEEP_MIN_TICKS       50UL
+#endif /* TICKLESS_DEEP_MIN_TICKS */
+
+/* Deadline value for "no event scheduled"                                    */
+#define TICKLESS_INFINITE             0xFFFFFFFFUL
+
+/* Sleep states                                                               */
+typedef enum {
+  TICKLESS_STATE_NONE = -1,   /*!< Deadline due, returned without sleeping    */
+  TICKLESS_STATE_WFE = 0,
+  TICKLESS_STATE_WFI,
+  TICKLESS_STATE_DEEP,
+  TICKLESS_STATE_COUNT
+} Tickless_State_t;
+
+/* Wake-up reasons                                                            */
+typedef enum {
+  TICKLESS_WAKE_TIMER = 0,    /*!< Deadline (SysTick compare) reached         */
+  TICKLESS_WAKE_IRQ,          /*!< Other interrupt before deadline            */
+  TICKLESS_WAKE_COUNT
+} Tickless_Wake_t;
+
+/* Sleep statistics                                                           */
+typedef struct {
+  uint64_t ullSleepCounts[TICKLESS_STATE_COUNT];  /*!< SysTick counts asleep  */
+  uint32_t ulSleepEntries[TICKLESS_STATE_COUNT];  /*!< Number of sleeps       */
+  uint32_t ulWakeReasons[TICKLESS_WAKE_COUNT];    /*!< Wake-ups by reason     */
+  uint32_t ulSkippedTicks;                        /*!< Ticks w/o interrupt    */
+} Tickless_Stats_t;
+
+/*!****************************************************************************
+ * @brief
+ * Initialise SysTick as free-running tickless timebase
+ *
+ * @note
+ * The SysTick interrupt must be enabled in the PFIC by the application, and
+ * Tickless_TickHandler() be called from its handler.
+ *
+ * @param[in] period      Tick period in SysTick counts
+ * @param[in] clk         SysTick clock source (SYSTICK_CTLR_STCLK_DIVx)
+ * @date  16.10.2026
+ ******************************************************************************/
+void Tickless_Init(uint32_t period, uint32_t clk);
+
+/*!****************************************************************************
+ * @brief
+ * SysTick compare interrupt handler
+ *
+ * Accounts for elapsed ticks, calls Tickless_OnTick() and arms the compare
+ * for the next deadline only.
+ *
+ * @return  (uint32_t)  Number of ticks elapsed since previous call
+ * @date  16.10.2026
+ ******************************************************************************/
+uint32_t Tickless_TickHandler(void);
+
+/*!****************************************************************************
+ * @brief
+ * Re-program the compare register after the next deadline changed
+ *
+ * Must be called when an event is scheduled earlier than the deadline that
+ * was previously reported by Tickless_NextDeadline().
+ *
+ * @date  16.10.2026
+ ******************************************************************************/
+void Tickless_Rearm(void);
+
+/*!****************************************************************************
+ * @brief
+ * Enter the cheapest sleep state until the next deadline
+ *
+ * To be called from the idle loop with interrupts enabled. The deadline check
+ * and sleep entry happen with interrupts masked, so no wake-up can be lost.
+ * Returns immediately if Tickless_NextDeadline() reports 0 (event due).
+ *
+ * @return  (Tickless_State_t)  Sleep state that was used, TICKLESS_STATE_NONE
+ *                              if the deadline was already due
+ * @date  16.10.2026
+ ******************************************************************************/
+Tickless_State_t Tickless_Idle(void);
+
+/*!****************************************************************************
+ * @brief
+ * Get tick count
+ *
+ * @return  (uint32_t)  Ticks since Tickless_Init()
+ * @date  16.10.2026
+ ******************************************************************************/
+uint32_t Tickless_GetTicks(void);
+
+/*!****************************************************************************
+ * @brief
+ * Enable or disable sleep-on-exit
+ *
+ * With sleep-on-exit enabled, the core returns to sleep after leaving the last
+ * active interrupt handler, skipping the idle loop entirely.
+ *
+ * @param[in] state       Enable or disable sleep-on-exit
+ * @date  16.10.2026
+ ******************************************************************************/
+void Tickless_SetSleepOnExit(FunctionalState state);
+
+/*!****************************************************************************
+ * @brief
+ * Get sleep statistics
+ *
+ * @param[out] stats      Copy of the statistics counters
+ * @date  16.10.2026
+ ******************************************************************************/
+void Tickless_GetStats(Tickless_Stats_t* stats);
+
+/*!****************************************************************************
+ * @brief
+ * Reset sleep statistics
+ *
+ * @date  16.10.2026
+ ******************************************************************************/
+void Tickless_ResetStats(void);
+
+/* ############################ Application Hooks ########################### */
+/*!****************************************************************************
+ * @brief
+ * Get number of ticks until the next scheduled event (weak, overridable)
+ *
+ * Called with interrupts disabled.
+ *
+ * @param[in] now         Current tick count
+ * @return  (uint32_t)  Ticks until next event, TICKLESS_INFINITE if none
+ * @date  16.10.2026
+ ******************************************************************************/
+uint32_t Tickless_NextDeadline(uint32_t now);
+
+/*!****************************************************************************
+ * @brief
+ * Process ticks from the SysTick interrupt (weak, overridable)
+ *
+ * Called from Tickless_TickHandler() before the next deadline is queried.
+ *
+ * @param[in] now         Current tick count
+ * @date  16.10.2026
+ ******************************************************************************/
+void Tickless_OnTick(uint32_t now);
+
+/*!****************************************************************************
+ * @brief
+ * Arm platform wake-up timer for deep sleep (weak, overridable)
+ *
+ * SysTick is stopped in deep sleep, so a platform timer (e.g. AWU) must take
+ * over. The default implementation reports deep sleep as unavailable.
+ *
+ * @param[in] ticks       Requested sleep length in ticks
+ * @return  (uint32_t)  Armed sleep length in ticks, 0 if unavailable
+ * @date  16.10.2026
+ ******************************************************************************/
+uint32_t Tickless_DeepSleepEnter(uint32_t ticks);
+
+/*!****************************************************************************
+ * @brief
+ * Disarm platform wake-up timer after deep sleep (weak, overridable)
+ *
+ * @return  (uint32_t)  Ticks actually spent in deep sleep
+ * @date  16.10.2026
+ ******************************************************************************/
+uint32_t Tickless_DeepSleepExit(void);
+
+#endif /* CORE_RISCV_TICKLESS_H_ */
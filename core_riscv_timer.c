@@ -0,0 +1,407 @@
+/*!****************************************************************************
+ * @file
+ * core_riscv_timer.c
+ *
+ * @brief
+ * RISC-V2A Hierarchical Software Timer Wheel
+ *
+ * @note
+ * Build with RV_DEVICE_HEADER set to the device header, which includes
+ * core_riscv.h (e.g. -DRV_DEVICE_HEADER=\"ch32v00x.h\").
+ *
+ * @date  16.10.2026
+ ******************************************************************************/
+
+#include RV_DEVICE_HEADER
+#include "core_riscv_timer.h"
+#ifdef TIMER_USE_TICKLESS
+#include "core_riscv_tickless.h"
+#endif /* TIMER_USE_TICKLESS */
+
+/* Bit shift of the expiry time for a wheel level                             */
+#define LEVEL_SHIFT(level)            ((level) * TIMER_WHEEL_BITS)
+
+/* Wheel slots (list heads) and slot occupancy bitmaps                        */
+static Timer_t* apxWheel[TIMER_WHEEL_LEVELS][TIMER_WHEEL_SLOTS];
+static uint32_t aulBitmap[TIMER_WHEEL_LEVELS];
+
+/* Wheel time: last processed tick                                            */
+static uint32_t ulNow;
+
+/*!****************************************************************************
+ * @brief
+ * Get current time for new expiries
+ *
+ * @return  (uint32_t)  Current tick count
+ * @date  16.10.2026
+ ******************************************************************************/
+static uint32_t prvGetTime(void)
+{
+#ifdef TIMER_USE_TICKLESS
+  /* Wheel time lags behind while no compare interrupt is due               */
+  return Tickless_GetTicks();
+#else
+  return ulNow;
+#endif /* TIMER_USE_TICKLESS */
+}
+
+/*!****************************************************************************
+ * @brief
+ * Insert timer into a wheel slot
+ *
+ * @param[in,out] timer   Timer
+ * @param[in] level       Wheel level
+ * @param[in] slot        Slot index
+ * @date  16.10.2026
+ ******************************************************************************/
+static void prvLink(Timer_t* timer, uint32_t level, uint32_t slot)
+{
+  Timer_t** ppxHead = &apxWheel[level][slot];
+
+  timer->pxNext = *ppxHead;
+  if (timer->pxNext != NULL) timer->pxNext->ppxPrev = &timer->pxNext;
+  timer->ppxPrev = ppxHead;
+  *ppxHead = timer;
+  aulBitmap[level] |= 1UL << slot;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Remove timer from its list, clearing the slot bit if it became empty
+ *
+ * @param[in,out] timer   Active timer
+ * @date  16.10.2026
+ ******************************************************************************/
+static void prvUnlink(Timer_t* timer)
+{
+  Timer_t** ppxPrev = timer->ppxPrev;
+
+  *ppxPrev = timer->pxNext;
+  if (timer->pxNext != NULL) timer->pxNext->ppxPrev = ppxPrev;
+  timer->ppxPrev = NULL;
+
+  /* Slot heads are identified by their address inside the wheel            */
+  if ((*ppxPrev == NULL) &&
+      (ppxPrev >= &apxWheel[0][0]) &&
+      (ppxPrev < &apxWheel[0][0] + (TIMER_WHEEL_LEVELS * TIMER_WHEEL_SLOTS)))
+  {
+    uint32_t ulIdx = (uint32_t)(ppxPrev - &apxWheel[0][0]);
+    aulBitmap[ulIdx >> TIMER_WHEEL_BITS] &= ~(1UL << (ulIdx & TIMER_WHEEL_MASK));
+  }
+}
+
+/*!****************************************************************************
+ * @brief
+ * Insert timer into the lowest level covering its expiry
+ *
+ * @param[in,out] timer   Idle timer with expiry set
+ * @date  16.10.2026
+ ******************************************************************************/
+static void prvInsert(Timer_t* timer)
+{
+  uint32_t ulShift;
+
+  for (uint32_t ulLevel = 0; ulLevel < TIMER_WHEEL_LEVELS; ++ulLevel)
+  {
+    ulShift = LEVEL_SHIFT(ulLevel);
+    if (((timer->ulExpiry >> ulShift) - (ulNow >> ulShift)) < TIMER_WHEEL_SLOTS)
+    {
+      prvLink(timer, ulLevel, (timer->ulExpiry >> ulShift) & TIMER_WHEEL_MASK);
+      return;
+    }
+  }
+
+  /* Beyond wheel range: park in the last top-level slot, re-evaluated on
+   * every cascade                                                           */
+  ulShift = LEVEL_SHIFT(TIMER_WHEEL_LEVELS - 1U);
+  prvLink(timer, TIMER_WHEEL_LEVELS - 1U, ((ulNow >> ulShift) - 1UL) & TIMER_WHEEL_MASK);
+}
+
+/*!****************************************************************************
+ * @brief
+ * Detach all timers of a wheel slot
+ *
+ * @param[in] level       Wheel level
+ * @param[in] slot        Slot index
+ * @return  (Timer_t*)  First timer of the detached list
+ * @date  16.10.2026
+ ******************************************************************************/
+static Timer_t* prvDetach(uint32_t level, uint32_t slot)
+{
+  Timer_t* pxList = apxWheel[level][slot];
+
+  apxWheel[level][slot] = NULL;
+  aulBitmap[level] &= ~(1UL << slot);
+  return pxList;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Move timers of the upper level slots that start at ulNow down the wheel
+ *
+ * @date  16.10.2026
+ ******************************************************************************/
+static void prvCascade(void)
+{
+  for (uint32_t ulLevel = 1; ulLevel < TIMER_WHEEL_LEVELS; ++ulLevel)
+  {
+    uint32_t ulSlot = (ulNow >> LEVEL_SHIFT(ulLevel)) & TIMER_WHEEL_MASK;
+
+    if (aulBitmap[ulLevel] & (1UL << ulSlot))
+    {
+      Timer_t* pxTimer = prvDetach(ulLevel, ulSlot);
+      while (pxTimer != NULL)
+      {
+        Timer_t* pxNext = pxTimer->pxNext;
+        prvInsert(pxTimer);
+        pxTimer = pxNext;
+      }
+    }
+    if (ulSlot != 0) break;
+  }
+}
+
+/*!****************************************************************************
+ * @brief
+ * Find distance to the next occupied slot after the current one
+ *
+ * @param[in] bitmap      Slot occupancy bitmap
+ * @param[in] slot        Current slot index
+ * @return  (uint32_t)  Distance in slots (1..TIMER_WHEEL_SLOTS), 0 if empty
+ * @date  16.10.2026
+ ******************************************************************************/
+static uint32_t prvSlotDistance(uint32_t bitmap, uint32_t slot)
+{
+  uint64_t ullRing = ((uint64_t)bitmap << TIMER_WHEEL_SLOTS) | bitmap;
+
+  if (bitmap == 0) return 0;
+  return (uint32_t)__builtin_ctz((uint32_t)(ullRing >> (slot + 1U))) + 1UL;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Initialise timer wheel
+ *
+ * @param[in] now         Current tick count
+ * @date  16.10.2026
+ ******************************************************************************/
+void Timer_Init(uint32_t now)
+{
+  uint32_t ulState = __disable_irq_save();
+
+  for (uint32_t ulLevel = 0; ulLevel < TIMER_WHEEL_LEVELS; ++ulLevel)
+  {
+    for (uint32_t ulSlot = 0; ulSlot < TIMER_WHEEL_SLOTS; ++ulSlot)
+    {
+      apxWheel[ulLevel][ulSlot] = NULL;
+    }
+    aulBitmap[ulLevel] = 0;
+  }
+  ulNow = now;
+  __restore_irq(ulState);
+}
+
+/*!****************************************************************************
+ * @brief
+ * Set up timer callback
+ *
+ * @param[out] timer      Timer
+ * @param[in] callback    Expiry callback
+ * @param[in] arg         Callback argument
+ * @date  16.10.2026
+ ******************************************************************************/
+void Timer_Setup(Timer_t* timer, Timer_Callback_t callback, void* arg)
+{
+  timer->pxNext = NULL;
+  timer->ppxPrev = NULL;
+  timer->ulExpiry = 0;
+  timer->ulPeriod = 0;
+  timer->pfnCallback = callback;
+  timer->pvArg = arg;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Start or restart timer
+ *
+ * @param[in,out] timer   Timer
+ * @param[in] ticks       Ticks until first expiry (at least 1)
+ * @param[in] period      Reload period in ticks, 0 for one-shot
+ * @date  16.10.2026
+ ******************************************************************************/
+void Timer_Start(Timer_t* timer, uint32_t ticks, uint32_t period)
+{
+  uint32_t ulState = __disable_irq_save();
+
+  if (timer->ppxPrev != NULL) prvUnlink(timer);
+  timer->ulExpiry = prvGetTime() + ((ticks != 0) ? ticks : 1UL);
+  timer->ulPeriod = period;
+  prvInsert(timer);
+
+#ifdef TIMER_USE_TICKLESS
+  Tickless_Rearm();
+#endif /* TIMER_USE_TICKLESS */
+  __restore_irq(ulState);
+}
+
+/*!****************************************************************************
+ * @brief
+ * Stop timer
+ *
+ * @param[in,out] timer   Timer
+ * @date  16.10.2026
+ ******************************************************************************/
+void Timer_Stop(Timer_t* timer)
+{
+  uint32_t ulState = __disable_irq_save();
+
+  if (timer->ppxPrev != NULL) prvUnlink(timer);
+  timer->ulPeriod = 0;
+  __restore_irq(ulState);
+}
+
+/*!****************************************************************************
+ * @brief
+ * Get timer state
+ *
+ * @param[in] timer       Timer
+ * @return  (FunctionalState)  ENABLE if timer is running
+ * @date  16.10.2026
+ ******************************************************************************/
+FunctionalState Timer_IsActive(const Timer_t* timer)
+{
+  return (timer->ppxPrev != NULL) ? ENABLE : DISABLE;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Advance timer wheel and run callbacks of expired timers
+ *
+ * Empty time ranges are skipped using the lowest level occupancy bitmap, so
+ * the cost is proportional to the number of expiring timers and lowest level
+ * wheel turns, not to the number of elapsed ticks.
+ *
+ * Callbacks run with interrupts restored to the caller's state and may start
+ * or stop any timer, including their own.
+ *
+ * @param[in] now         Current tick count
+ * @date  16.10.2026
+ ******************************************************************************/
+void Timer_Process(uint32_t now)
+{
+  uint32_t ulState = __disable_irq_save();
+
+  while ((int32_t)(now - ulNow) > 0)
+  {
+    uint32_t ulOccupied = 0;
+    for (uint32_t ulLevel = 0; ulLevel < TIMER_WHEEL_LEVELS; ++ulLevel)
+    {
+      ulOccupied |= aulBitmap[ulLevel];
+    }
+    if (ulOccupied == 0)
+    {
+      ulNow = now;
+      break;
+    }
+
+    uint32_t ulSlot = ulNow & TIMER_WHEEL_MASK;
+    uint32_t ulAhead = (aulBitmap[0] >> ulSlot) >> 1;
+    uint32_t ulStep = (ulAhead != 0) ? ((uint32_t)__builtin_ctz(ulAhead) + 1UL)
+                                     : (TIMER_WHEEL_SLOTS - ulSlot);
+    Timer_t* pxExpired = NULL;
+
+    if (ulStep > now - ulNow) ulStep = now - ulNow;
+    ulNow += ulStep;
+    ulSlot = ulNow & TIMER_WHEEL_MASK;
+
+    if (ulSlot == 0) prvCascade();
+    if (aulBitmap[0] & (1UL << ulSlot))
+    {
+      /* Detached list: callbacks may unlink any timer while it is walked   */
+      pxExpired = prvDetach(0, ulSlot);
+      pxExpired->ppxPrev = &pxExpired;
+    }
+
+    while (pxExpired != NULL)
+    {
+      Timer_t* pxTimer = pxExpired;
+      prvUnlink(pxTimer);
+
+      if (pxTimer->ulExpiry != ulNow)
+      {
+        prvInsert(pxTimer);
+        continue;
+      }
+      if (pxTimer->ulPeriod != 0)
+      {
+        pxTimer->ulExpiry += pxTimer->ulPeriod;
+        prvInsert(pxTimer);
+      }
+
+      __restore_irq(ulState);
+      pxTimer->pfnCallback(pxTimer, pxTimer->pvArg);
+      ulState = __disable_irq_save();
+    }
+  }
+  __restore_irq(ulState);
+}
+
+/*!****************************************************************************
+ * @brief
+ * Get number of ticks until the nearest expiry
+ *
+ * @param[in] now         Current tick count
+ * @return  (uint32_t)  Ticks until next event, TIMER_INFINITE if none
+ * @date  16.10.2026
+ ******************************************************************************/
+uint32_t Timer_NextDeadline(uint32_t now)
+{
+  uint32_t ulState = __disable_irq_save();
+  uint32_t ulBest = TIMER_INFINITE;
+  uint32_t ulPassed = now - ulNow;
+
+  for (uint32_t ulLevel = 0; ulLevel < TIMER_WHEEL_LEVELS; ++ulLevel)
+  {
+    uint32_t ulShift = LEVEL_SHIFT(ulLevel);
+    uint32_t ulDist = prvSlotDistance(aulBitmap[ulLevel], (ulNow >> ulShift) & TIMER_WHEEL_MASK);
+
+    if (ulDist != 0)
+    {
+      /* Level 0: expiry tick; upper levels: start of slot (cascade tick)   */
+      uint32_t ulDelta = (((ulNow >> ulShift) + ulDist) << ulShift) - ulNow;
+      if (ulDelta < ulBest) ulBest = ulDelta;
+    }
+  }
+  __restore_irq(ulState);
+
+  if (ulBest == TIMER_INFINITE) return TIMER_INFINITE;
+  return (ulBest > ulPassed) ? (ulBest - ulPassed) : 0;
+}
+
+#ifdef TIMER_USE_TICKLESS
+/* ############################ Tickless Hooks ############################## */
+/*!****************************************************************************
+ * @brief
+ * Report nearest timer expiry to the tickless timebase
+ *
+ * @param[in] now         Current tick count
+ * @return  (uint32_t)  Ticks until next expiry, TICKLESS_INFINITE if none
+ * @date  16.10.2026
+ ******************************************************************************/
+uint32_t Tickless_NextDeadline(uint32_t now)
+{
+  return Timer_NextDeadline(now);
+}
+
+/*!****************************************************************************
+ * @brief
+ * Process expired timers from the SysTick compare interrupt
+ *
+ * @param[in] now         Current tick count
+ * @date  16.10.2026
+ ******************************************************************************/
+void Tickless_OnTick(uint32_t now)
+{
+  Timer_Process(now);
+}
+#endif /* TIMER_USE_TICKLESS */
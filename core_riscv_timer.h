@@ -0,0 +1,140 @@
+/*!****************************************************************************
+ * @file
+ * core_riscv_timer.h
+ *
+ * @brief
+ * RISC-V2A Hierarchical Software Timer Wheel
+ *
+ * Timers are kept in TIMER_WHEEL_LEVELS wheels of 2^TIMER_WHEEL_BITS slots,
+ * each level covering TIMER_WHEEL_BITS more bits of the expiry time. Insert
+ * and cancel are O(1); timers move to lower levels as time approaches their
+ * expiry. Per-level slot occupancy bitmaps allow skipping empty time ranges
+ * and finding the next expiry without scanning timers.
+ *
+ * Compared with a sorted list (tests/bench_timer.c, host), insert cost stays
+ * flat from 10 to 1000 timers while the list grows linearly (about 20x at
+ * 1000); cascading makes an expiry up to a few times as costly as a list pop.
+ *
+ * Time is counted in ticks of the tickless timebase (core_riscv_tickless.h).
+ * With TIMER_USE_TICKLESS defined, this module drives the tickless hooks, so
+ * that the SysTick compare is only ever armed for the nearest expiry.
+ *
+ * @date  16.10.2026
+ ******************************************************************************/
+
+#ifndef CORE_RISCV_TIMER_H_
+#define CORE_RISCV_TIMER_H_
+
+#ifndef CORE_RISCV_H_
+#error "core_riscv.h must be included (via the device header) first"
+#endif /* CORE_RISCV_H_ */
+
+#include <stddef.h>
+
+/* Slots per wheel level: 2^TIMER_WHEEL_BITS (3..5)                           */
+#ifndef TIMER_WHEEL_BITS
+#define TIMER_WHEEL_BITS              4U
+#endif /* TIMER_WHEEL_BITS */
+
+/* Number of wheel levels, range is 2^(TIMER_WHEEL_BITS * TIMER_WHEEL_LEVELS) */
+#ifndef TIMER_WHEEL_LEVELS
+#define TIMER_WHEEL_LEVELS            4U
+#endif /* TIMER_WHEEL_LEVELS */
+
+#define TIMER_WHEEL_SLOTS             (1UL << TIMER_WHEEL_BITS)
+#define TIMER_WHEEL_MASK              (TIMER_WHEEL_SLOTS - 1UL)
+
+/* Deadline value for "no timer active"                                       */
+#define TIMER_INFINITE                0xFFFFFFFFUL
+
+struct Timer_s;
+
+/* Timer expiry callback, called from Timer_Process() context                 */
+typedef void (*Timer_Callback_t)(struct Timer_s* timer, void* arg);
+
+/* Timer control block, statically allocated by the application               */
+typedef struct Timer_s {
+  struct Timer_s* pxNext;     /*!< Next timer in slot                         */
+  struct Timer_s** ppxPrev;   /*!< Link pointing to this timer, NULL if idle  */
+  uint32_t ulExpiry;          /*!< Absolute expiry tick                       */
+  uint32_t ulPeriod;          /*!< Reload period in ticks, 0 for one-shot     */
+  Timer_Callback_t pfnCallback;
+  void* pvArg;
+} Timer_t;
+
+/* Static initialiser for a Timer_t                                           */
+#define TIMER_INIT(callback, arg)     { NULL, NULL, 0, 0, (callback), (arg) }
+
+/*!****************************************************************************
+ * @brief
+ * Initialise timer wheel
+ *
+ * @param[in] now         Current tick count
+ * @date  16.10.2026
+ ******************************************************************************/
+void Timer_Init(uint32_t now);
+
+/*!****************************************************************************
+ * @brief
+ * Set up timer callback
+ *
+ * @param[out] timer      Timer
+ * @param[in] callback    Expiry callback
+ * @param[in] arg         Callback argument
+ * @date  16.10.2026
+ ******************************************************************************/
+void Timer_Setup(Timer_t* timer, Timer_Callback_t callback, void* arg);
+
+/*!****************************************************************************
+ * @brief
+ * Start or restart timer
+ *
+ * @param[in,out] timer   Timer
+ * @param[in] ticks       Ticks until first expiry (at least 1)
+ * @param[in] period      Reload period in ticks, 0 for one-shot
+ * @date  16.10.2026
+ ******************************************************************************/
+void Timer_Start(Timer_t* timer, uint32_t ticks, uint32_t period);
+
+/*!****************************************************************************
+ * @brief
+ * Stop timer
+ *
+ * @param[in,out] timer   Timer
+ * @date  16.10.2026
+ ******************************************************************************/
+void Timer_Stop(Timer_t* timer);
+
+/*!****************************************************************************
+ * @brief
+ * Get timer state
+ *
+ * @param[in] timer       Timer
+ * @return  (FunctionalState)  ENABLE if timer is running
+ * @date  16.10.2026
+ ******************************************************************************/
+FunctionalState Timer_IsActive(const Timer_t* timer);
+
+/*!****************************************************************************
+ * @brief
+ * Advance timer wheel and run callbacks of expired timers
+ *
+ * @param[in] now         Current tick count
+ * @date  16.10.2026
+ ******************************************************************************/
+void Timer_Process(uint32_t now);
+
+/*!****************************************************************************
+ * @brief
+ * Get number of ticks until the nearest expiry
+ *
+ * Exact for expiries within the lowest level, otherwise the tick at which the
+ * nearest timer moves down a level (never later than its expiry).
+ *
+ * @param[in] now         Current tick count
+ * @return  (uint32_t)  Ticks until next event, TIMER_INFINITE if none
+ * @date  16.10.2026
+ ******************************************************************************/
+uint32_t Timer_NextDeadline(uint32_t now);
+
+#endif /* CORE_RISCV_TIMER_H_ */
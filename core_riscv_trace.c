@@ -0,0 +1,128 @@
+/*!****************************************************************************
+ * @file
+ * core_riscv_trace.c
+ *
+ * @brief
+ * RISC-V2A Interrupt Latency and Jitter Trace Recorder
+ *
+ * @note
+ * Build with RV_DEVICE_HEADER set to the device header, which includes
+ * core_riscv.h (e.g. -DRV_DEVICE_HEADER=\"ch32v00x.h\").
+ *
+ * @date  16.10.2026
+ ******************************************************************************/
+
+#include RV_DEVICE_HEADER
+#include "core_riscv_trace.h"
+
+/* Marker for "no interrupt pended through IrqTrace_Pend()"                   */
+#define IRQTRACE_NO_PEND              0xFFFFFFFFUL
+
+/* Trace ring buffer                                                          */
+IrqTrace_Data_t IrqTrace_Data;
+
+/* Interrupt pended through IrqTrace_Pend() and its timestamp                 */
+static volatile uint32_t ulPendIRQn = IRQTRACE_NO_PEND;
+static volatile uint32_t ulPendStamp;
+
+/*!****************************************************************************
+ * @brief
+ * Initialise (clear) the trace ring
+ *
+ * @date  16.10.2026
+ ******************************************************************************/
+void IrqTrace_Init(void)
+{
+  uint32_t ulState = __disable_irq_save();
+
+  for (uint32_t i = 0; i < IRQTRACE_RECORDS; ++i)
+  {
+    IrqTrace_Data.axRecord[i].ucFlags = 0;
+  }
+  IrqTrace_Data.ulMagic = IRQTRACE_MAGIC;
+  IrqTrace_Data.usVersion = IRQTRACE_VERSION;
+  IrqTrace_Data.usRecords = IRQTRACE_RECORDS;
+  IrqTrace_Data.ulCoreHz = IRQTRACE_CORE_HZ;
+  IrqTrace_Data.ulHead = 0;
+  ulPendIRQn = IRQTRACE_NO_PEND;
+  __restore_irq(ulState);
+}
+
+/*!****************************************************************************
+ * @brief
+ * Pend interrupt by software and stamp the pend time for latency measurement
+ *
+ * @param[in] IRQn        Interrupt Number
+ * @date  16.10.2026
+ ******************************************************************************/
+void IrqTrace_Pend(IRQn_Type IRQn)
+{
+  ulPendIRQn = (uint32_t)IRQn;
+  ulPendStamp = __get_MCYCLE();
+  PFIC_SetPendingIRQ(IRQn);
+}
+
+/*!****************************************************************************
+ * @brief
+ * Record handler entry
+ *
+ * @param[in,out] ctx     Trace context on the handler stack
+ * @param[in] IRQn        Interrupt Number of the handler
+ * @date  16.10.2026
+ ******************************************************************************/
+void IrqTrace_Enter(IrqTrace_Ctx_t* ctx, IRQn_Type IRQn)
+{
+  uint32_t ulDepth = 0;
+
+  ctx->ucIRQn = (uint8_t)IRQn;
+  ctx->ucFlags = IRQTRACE_FLAG_VALID;
+  if (ulPendIRQn == (uint32_t)IRQn)
+  {
+    ctx->ulPend = ulPendStamp;
+    ctx->ucFlags |= IRQTRACE_FLAG_PEND;
+    ulPendIRQn = IRQTRACE_NO_PEND;
+  }
+
+  /* Nesting depth: number of active interrupts                             */
+  for (uint32_t i = 0; i < PFIC_IRQSET_BANKS; ++i)
+  {
+    uint32_t ulActive = PFIC_GetActiveBank(i);
+    while (ulActive != 0)
+    {
+      ulActive &= ulActive - 1UL;
+      ulDepth++;
+    }
+  }
+  ctx->ucDepth = (uint8_t)ulDepth;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Record handler exit and commit the trace record
+ *
+ * @param[in] ctx         Trace context passed to IrqTrace_Enter()
+ * @param[in] mode        RV_INTERRUPT_MODE_x of the handler
+ * @date  16.10.2026
+ ******************************************************************************/
+void IrqTrace_Exit(const IrqTrace_Ctx_t* ctx, uint8_t mode)
+{
+  uint32_t ulExit = __get_MCYCLE();
+  uint32_t ulState = __disable_irq_save();
+  uint32_t ulSlot = IrqTrace_Data.ulHead++;
+  IrqTrace_Record_t* pxRecord;
+
+  __restore_irq(ulState);
+  pxRecord = &IrqTrace_Data.axRecord[ulSlot & (IRQTRACE_RECORDS - 1U)];
+
+  /* Invalidate first, validate last: a dump never sees a torn record       */
+  pxRecord->ucFlags = 0;
+  RV_COMPILER_BARRIER();
+  pxRecord->ucIRQn = ctx->ucIRQn;
+  pxRecord->ucMode = mode;
+  pxRecord->ucDepth = ctx->ucDepth;
+  pxRecord->ulPend = (ctx->ucFlags & IRQTRACE_FLAG_PEND) ? ctx->ulPend : 0;
+  pxRecord->ulEntry = ctx->ulEntry;
+  pxRecord->ulExit = ulExit;
+  RV_COMPILER_BARRIER();
+  pxRecord->ucFlags = ctx->ucFlags;
+}
@@ -0,0 +1,136 @@
+/*!****************************************************************************
+ * @file
+ * core_riscv_trace.h
+ *
+ * @brief
+ * RISC-V2A Interrupt Latency and Jitter Trace Recorder
+ *
+ * Handlers wrapped in IRQTRACE_ENTER()/IRQTRACE_EXIT() log one record per
+ * invocation into a RAM ring buffer (IrqTrace_Data): IRQn, interrupt entry
+ * mode (RV_INTERRUPT_MODE of the handler's translation unit), nesting depth
+ * from IACTR, and mcycle timestamps of entry and exit. Interrupts triggered
+ * through IrqTrace_Pend() additionally carry the pend timestamp, so the
+ * entry latency can be measured. The ring keeps the most recent records and
+ * is decoded by tools/irq_trace_decode.c from a raw memory dump.
+ *
+ * Records are written without locks; only the slot reservation (one index
+ * increment) runs with interrupts masked, for two instructions.
+ *
+ * Tracing compiles to nothing unless USE_IRQ_TRACE is defined.
+ *
+ * @date  16.10.2026
+ ******************************************************************************/
+
+#ifndef CORE_RISCV_TRACE_H_
+#define CORE_RISCV_TRACE_H_
+
+#ifndef CORE_RISCV_H_
+#error "core_riscv.h must be included (via the device header) first"
+#endif /* CORE_RISCV_H_ */
+
+/* Number of ring buffer records (power of two)                               */
+#ifndef IRQTRACE_RECORDS
+#define IRQTRACE_RECORDS              64U
+#endif /* IRQTRACE_RECORDS */
+
+#if (IRQTRACE_RECORDS & (IRQTRACE_RECORDS - 1U)) != 0
+#error "IRQTRACE_RECORDS must be a power of two"
+#endif
+
+/* Core clock frequency in Hz, recorded in the dump for time conversion       */
+#ifndef IRQTRACE_CORE_HZ
+#define IRQTRACE_CORE_HZ              48000000UL
+#endif /* IRQTRACE_CORE_HZ */
+
+/* Dump identification ("IRQT") and layout version                            */
+#define IRQTRACE_MAGIC                0x54515249UL
+#define IRQTRACE_VERSION              1U
+
+/* Record flags                                                               */
+#define IRQTRACE_FLAG_VALID           0x01U
+#define IRQTRACE_FLAG_PEND            0x02U
+
+/* Trace record, 16 bytes                                                     */
+typedef struct {
+  uint8_t ucIRQn;             /*!< Interrupt Number                           */
+  uint8_t ucMode;             /*!< RV_INTERRUPT_MODE_x of the handler         */
+  uint8_t ucDepth;            /*!< Active interrupts at entry (incl. self)    */
+  uint8_t ucFlags;            /*!< IRQTRACE_FLAG_x                            */
+  uint32_t ulPend;            /*!< mcycle at IrqTrace_Pend(), if flagged      */
+  uint32_t ulEntry;           /*!< mcycle at handler entry                    */
+  uint32_t ulExit;            /*!< mcycle at handler exit                     */
+} IrqTrace_Record_t;
+
+/* Ring buffer with dump header (16 bytes)                                    */
+typedef struct {
+  uint32_t ulMagic;           /*!< IRQTRACE_MAGIC                             */
+  uint16_t usVersion;         /*!< IRQTRACE_VERSION                           */
+  uint16_t usRecords;         /*!< Ring capacity                              */
+  uint32_t ulCoreHz;          /*!< Core clock frequency                       */
+  volatile uint32_t ulHead;   /*!< Total number of reserved records           */
+  IrqTrace_Record_t axRecord[IRQTRACE_RECORDS];
+} IrqTrace_Data_t;
+
+/* Per-invocation trace context                                               */
+typedef struct {
+  uint32_t ulEntry;
+  uint32_t ulPend;
+  uint8_t ucIRQn;
+  uint8_t ucDepth;
+  uint8_t ucFlags;
+} IrqTrace_Ctx_t;
+
+extern IrqTrace_Data_t IrqTrace_Data;
+
+/*!****************************************************************************
+ * @brief
+ * Initialise (clear) the trace ring
+ *
+ * @date  16.10.2026
+ ******************************************************************************/
+void IrqTrace_Init(void);
+
+/*!****************************************************************************
+ * @brief
+ * Pend interrupt by software and stamp the pend time for latency measurement
+ *
+ * @param[in] IRQn        Interrupt Number
+ * @date  16.10.2026
+ ******************************************************************************/
+void IrqTrace_Pend(IRQn_Type IRQn);
+
+/*!****************************************************************************
+ * @brief
+ * Record handler entry
+ *
+ * The entry timestamp (ctx->ulEntry) is taken inline by IRQTRACE_ENTER()
+ * before the call, keeping the measurement offset small and constant.
+ *
+ * @param[in,out] ctx     Trace context on the handler stack
+ * @param[in] IRQn        Interrupt Number of the handler
+ * @date  16.10.2026
+ ******************************************************************************/
+void IrqTrace_Enter(IrqTrace_Ctx_t* ctx, IRQn_Type IRQn);
+
+/*!****************************************************************************
+ * @brief
+ * Record handler exit and commit the trace record
+ *
+ * @param[in] ctx         Trace context passed to IrqTrace_Enter()
+ * @param[in] mode        RV_INTERRUPT_MODE_x of the handler
+ * @date  16.10.2026
+ ******************************************************************************/
+void IrqTrace_Exit(const IrqTrace_Ctx_t* ctx, uint8_t mode);
+
+#ifdef USE_IRQ_TRACE
+#define IRQTRACE_ENTER(IRQn)                                                   \
+  IrqTrace_Ctx_t __irqtrace;                                                   \
+  __irqtrace.ulEntry = __get_MCYCLE();                                         \
+  IrqTrace_Enter(&__irqtrace, (IRQn))
+#define IRQTRACE_EXIT()               IrqTrace_Exit(&__irqtrace, RV_INTERRUPT_MODE)
+#else
+#define IRQTRACE_ENTER(IRQn)          do {} while (0)
+#define IRQTRACE_EXIT()               do {} while (0)
+#endif /* USE_IRQ_TRACE */
+
+#endif /* CORE_RISCV_TRACE_H_ */
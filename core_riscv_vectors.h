@@ -0,0 +1,174 @@
+/*!****************************************************************************
+ * @file
+ * core_riscv_vectors.h
+ *
+ * @brief
+ * RISC-V2A Compile-Time Vector Table Builder
+ *
+ * Generates the mtvec LUT-mode vector table from an application list of
+ * IRQn/handler bindings. The list is a function-like macro taking two entry
+ * macros:
+ *  - BIND(IRQn, handler)   Handler is required; a missing definition is a
+ *                          link error, so enabled interrupts cannot silently
+ *                          fall through to the default handler
+ *  - WEAK(IRQn, handler)   Handler is optional, a weak alias of
+ *                          Vector_DefaultHandler() is emitted
+ *
+ * Example, expanded in exactly one translation unit:
+ *   #define APP_VECTORS(BIND, WEAK)                                     \
+ *     WEAK(HardFault_IRQn, HardFault_Handler)                           \
+ *     BIND(SysTicK_IRQn, SysTick_Handler)                               \
+ *     BIND(USART1_IRQn, USART1_IRQHandler)
+ *   RV_VECTOR_TABLE(APP_VECTORS)
+ *
+ * Slot 0 holds the reset jump to _start and defines _vector_base, slots up
+ * to the highest listed IRQn follow; unlisted slots in between point to
+ * Vector_DefaultHandler(), trailing unused slots are not emitted. The linker
+ * script must place the sections at the start of flash, in order:
+ *   KEEP(*(.vector_table.0)) KEEP(*(.vector_table.1))
+ *
+ * Each IRQn may be listed once (checked at compile time; IRQn must be an
+ * enumerator name) and must lie within 1..255.
+ *
+ * RV_VECTOR_TABLE_RAM() additionally emits a RAM copy of the table:
+ * Vector_Relocate() points mtvec at it and Vector_SetHandler() replaces
+ * handlers at runtime. The hardware reads handler addresses directly from
+ * the RAM table, so no dispatch indirection is added.
+ *
+ * @date  16.10.2026
+ ******************************************************************************/
+
+#ifndef CORE_RISCV_VECTORS_H_
+#define CORE_RISCV_VECTORS_H_
+
+#ifndef CORE_RISCV_H_
+#error "core_riscv.h must be included (via the device header) first"
+#endif /* CORE_RISCV_H_ */
+
+/* Alignment of the RAM vector table (mtvec base alignment of the device)     */
+#ifndef RV_VECTOR_RAM_ALIGN
+#define RV_VECTOR_RAM_ALIGN           4U
+#endif /* RV_VECTOR_RAM_ALIGN */
+
+/* mtvec mode bits                                                            */
+#define RV_MTVEC_MODE_MASK            0x3UL
+
+/*!****************************************************************************
+ * @brief
+ * Default handler for unbound and weakly bound interrupts
+ *
+ * @note
+ * Weak definition emitted by RV_VECTOR_TABLE(), loops forever.
+ *
+ * @date  16.10.2026
+ ******************************************************************************/
+void Vector_DefaultHandler(void);
+
+/*!****************************************************************************
+ * @brief
+ * Copy vector table to RAM and point mtvec at the copy
+ *
+ * @note
+ * Emitted by RV_VECTOR_TABLE_RAM(). The mtvec mode bits are kept.
+ *
+ * @date  16.10.2026
+ ******************************************************************************/
+void Vector_Relocate(void);
+
+/*!****************************************************************************
+ * @brief
+ * Replace handler in the RAM vector table
+ *
+ * @note
+ * Emitted by RV_VECTOR_TABLE_RAM(). A single word store, so the swap is
+ * atomic with respect to the interrupt being taken.
+ *
+ * @param[in] IRQn        Interrupt Number
+ * @param[in] handler     New handler, NULL for Vector_DefaultHandler()
+ * @return  (ErrorStatus)  ERROR if IRQn beyond the emitted table
+ * @date  16.10.2026
+ ******************************************************************************/
+ErrorStatus Vector_SetHandler(IRQn_Type IRQn, void (*handler)(void));
+
+/* List entry expansions                                                      */
+#define RV_VECTOR_DECL_BIND_(IRQn, handler)                                    \
+  void handler(void);
+#define RV_VECTOR_DECL_WEAK_(IRQn, handler)                                    \
+  void handler(void) __attribute__((weak, alias("Vector_DefaultHandler")));
+#define RV_VECTOR_CHECK_(IRQn, handler)                                        \
+  RV_VECTOR_SLOT_##IRQn = (IRQn) + 0 * sizeof(char[((IRQn) > 0 && (IRQn) < 256) ? 1 : -1]),
+#define RV_VECTOR_SIZE_(IRQn, handler)  [(IRQn)] = 1,
+#define RV_VECTOR_ENTRY_(IRQn, handler) [(IRQn) - 1] = (uintptr_t)&handler,
+
+/* Slot 0: reset jump, 32-bit encoding to keep the following slots aligned    */
+#ifndef USE_HOST_SIM
+#define RV_VECTOR_RESET_SLOT_                                                  \
+  __asm__(".section .vector_table.0, \"ax\"      \n"                           \
+          ".balign 4                             \n"                           \
+          ".globl _vector_base                   \n"                           \
+          "_vector_base:                         \n"                           \
+          ".option push                          \n"                           \
+          ".option norvc                         \n"                           \
+          "  j _start                            \n"                           \
+          ".option pop                           \n"                           \
+          ".previous                             \n");
+#else
+#define RV_VECTOR_RESET_SLOT_
+#endif /* USE_HOST_SIM */
+
+/*!****************************************************************************
+ * @brief
+ * Vector Table Template: flash table, default and weak handlers
+ *
+ * @param[in] list        (Template symbol) Binding list macro
+ * @date  16.10.2026
+ ******************************************************************************/
+#define RV_VECTOR_TABLE(list)                                                  \
+  RV_WEAK void Vector_DefaultHandler(void) { while (1); }                      \
+  list(RV_VECTOR_DECL_BIND_, RV_VECTOR_DECL_WEAK_)                             \
+  enum { list(RV_VECTOR_CHECK_, RV_VECTOR_CHECK_) RV_VECTOR_SLOT_END_ };       \
+  static const uint8_t Vector_Slots_[] __attribute__((unused)) =               \
+    { list(RV_VECTOR_SIZE_, RV_VECTOR_SIZE_) };                                \
+  RV_VECTOR_RESET_SLOT_                                                        \
+  _Pragma("GCC diagnostic push")                                               \
+  _Pragma("GCC diagnostic ignored \"-Woverride-init\"")                        \
+  const uintptr_t Vector_Table[sizeof(Vector_Slots_) - 1U]                     \
+    __attribute__((section(".vector_table.1"), used)) = {                      \
+    [0 ... (sizeof(Vector_Slots_) - 2U)] = (uintptr_t)&Vector_DefaultHandler,  \
+    list(RV_VECTOR_ENTRY_, RV_VECTOR_ENTRY_)                                   \
+  };                                                                           \
+  _Pragma("GCC diagnostic pop")
+
+/*!****************************************************************************
+ * @brief
+ * Vector Table Template: flash table plus relocatable RAM copy
+ *
+ * @param[in] list        (Template symbol) Binding list macro
+ * @date  16.10.2026
+ ******************************************************************************/
+#define RV_VECTOR_TABLE_RAM(list)                                              \
+  RV_VECTOR_TABLE(list)                                                        \
+  static uintptr_t Vector_RamTable[sizeof(Vector_Slots_)]                      \
+    __attribute__((aligned(RV_VECTOR_RAM_ALIGN)));                             \
+  void Vector_Relocate(void)                                                   \
+  {                                                                            \
+    uint32_t ulState = __disable_irq_save();                                   \
+    Vector_RamTable[0] = 0;                                                    \
+    for (uint32_t i = 1; i < sizeof(Vector_Slots_); ++i)                       \
+    {                                                                          \
+      Vector_RamTable[i] = Vector_Table[i - 1U];                               \
+    }                                                                          \
+    __set_MTVEC((uint32_t)(uintptr_t)Vector_RamTable |                         \
+                (__get_MTVEC() & RV_MTVEC_MODE_MASK));                         \
+    __restore_irq(ulState);                                                    \
+  }                                                                            \
+  ErrorStatus Vector_SetHandler(IRQn_Type IRQn, void (*handler)(void))         \
+  {                                                                            \
+    if (((uint32_t)IRQn == 0) || ((uint32_t)IRQn >= sizeof(Vector_Slots_)))    \
+      return ERROR;                                                            \
+    if (handler == 0) handler = &Vector_DefaultHandler;                        \
+    *(volatile uintptr_t*)&Vector_RamTable[IRQn] = (uintptr_t)handler;         \
+    return SUCCESS;                                                            \
+  }
+
+#endif /* CORE_RISCV_VECTORS_H_ */
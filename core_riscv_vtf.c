@@ -0,0 +1,331 @@
+/*!****************************************************************************
+ * @file
+ * core_riscv_vtf.c
+ *
+ * @brief
+ * RISC-V2A Vector-Table-Free (VTF) Fast Interrupt Channel Manager
+ *
+ * @note
+ * Build with RV_DEVICE_HEADER set to the device header, which includes
+ * core_riscv.h (e.g. -DRV_DEVICE_HEADER=\"ch32v00x.h\").
+ *
+ * @date  16.10.2026
+ ******************************************************************************/
+
+#include RV_DEVICE_HEADER
+#include "core_riscv_vtf.h"
+
+/* Registry entry                                                             */
+typedef struct {
+  uint32_t ulHandler;         /*!< Handler address                            */
+  uint32_t ulScore;           /*!< Decaying interrupt frequency score         */
+  uint8_t ucIRQn;             /*!< Interrupt Number                           */
+  uint8_t ucClass;            /*!< Vtf_Class_t                                */
+  uint8_t ucChannel;          /*!< Assigned channel or VTF_NO_CHANNEL         */
+  uint8_t ucUsed;             /*!< Entry in use                               */
+} Vtf_Entry_t;
+
+#ifdef USE_VTF_ADAPTIVE
+/* Interrupt frequency counters                                               */
+volatile uint16_t Vtf_Hits[VTF_IRQ_NUM];
+#endif /* USE_VTF_ADAPTIVE */
+
+/* Registry and channel owners (entry index or VTF_NO_CHANNEL)                */
+static Vtf_Entry_t axEntry[VTF_MAX_ENTRIES];
+static uint8_t aucOwner[VTF_CHANNELS];
+
+/* Statistics                                                                 */
+static Vtf_Stats_t xStats;
+
+/*!****************************************************************************
+ * @brief
+ * Find registry entry of an interrupt
+ *
+ * @param[in] IRQn        Interrupt Number
+ * @return  (uint32_t)  Entry index, VTF_MAX_ENTRIES if not registered
+ * @date  16.10.2026
+ ******************************************************************************/
+static uint32_t prvFind(IRQn_Type IRQn)
+{
+  uint32_t i;
+
+  for (i = 0; i < VTF_MAX_ENTRIES; ++i)
+  {
+    if (axEntry[i].ucUsed && (axEntry[i].ucIRQn == (uint8_t)IRQn)) break;
+  }
+  return i;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Assign channel to registry entry
+ *
+ * The channel is disabled while ID and address are changed, so interrupts
+ * taken meanwhile are dispatched through the vector table.
+ *
+ * @param[in] channel     VTF channel
+ * @param[in] entry       Entry index
+ * @date  16.10.2026
+ ******************************************************************************/
+static void prvAssign(uint8_t channel, uint32_t entry)
+{
+  PFIC_DisableFastIRQ(channel);
+  PFIC_ConfigFastIRQ(channel, axEntry[entry].ulHandler, (IRQn_Type)axEntry[entry].ucIRQn);
+  PFIC_EnableFastIRQ(channel);
+
+  aucOwner[channel] = (uint8_t)entry;
+  axEntry[entry].ucChannel = channel;
+  xStats.ulRemaps++;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Release channel, its interrupt falls back to vector table dispatch
+ *
+ * @param[in] channel     VTF channel
+ * @date  16.10.2026
+ ******************************************************************************/
+static void prvRelease(uint8_t channel)
+{
+  PFIC_DisableFastIRQ(channel);
+  if (aucOwner[channel] != VTF_NO_CHANNEL)
+  {
+    axEntry[aucOwner[channel]].ucChannel = VTF_NO_CHANNEL;
+    aucOwner[channel] = VTF_NO_CHANNEL;
+  }
+}
+
+/*!****************************************************************************
+ * @brief
+ * Select channel for a new assignment
+ *
+ * @return  (uint8_t)  Free channel, else the channel of the lowest scoring
+ *                     adaptive interrupt, VTF_NO_CHANNEL if all are pinned
+ * @date  16.10.2026
+ ******************************************************************************/
+static uint8_t prvVictim(void)
+{
+  uint8_t ucVictim = VTF_NO_CHANNEL;
+
+  for (uint8_t i = 0; i < VTF_CHANNELS; ++i)
+  {
+    const Vtf_Entry_t* pxOwner;
+
+    if (aucOwner[i] == VTF_NO_CHANNEL) return i;
+    pxOwner = &axEntry[aucOwner[i]];
+    if ((pxOwner->ucClass == VTF_CLASS_ADAPTIVE) &&
+        ((ucVictim == VTF_NO_CHANNEL) || (pxOwner->ulScore < axEntry[aucOwner[ucVictim]].ulScore)))
+    {
+      ucVictim = i;
+    }
+  }
+  return ucVictim;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Select the highest scoring adaptive interrupt without channel
+ *
+ * @return  (uint32_t)  Entry index, VTF_MAX_ENTRIES if none
+ * @date  16.10.2026
+ ******************************************************************************/
+static uint32_t prvCandidate(void)
+{
+  uint32_t ulBest = VTF_MAX_ENTRIES;
+
+  for (uint32_t i = 0; i < VTF_MAX_ENTRIES; ++i)
+  {
+    const Vtf_Entry_t* pxEntry = &axEntry[i];
+
+    if (pxEntry->ucUsed && (pxEntry->ucClass == VTF_CLASS_ADAPTIVE) && (pxEntry->ucChannel == VTF_NO_CHANNEL) &&
+        ((ulBest == VTF_MAX_ENTRIES) || (pxEntry->ulScore > axEntry[ulBest].ulScore)))
+    {
+      ulBest = i;
+    }
+  }
+  return ulBest;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Initialise manager and disable all VTF channels
+ *
+ * @date  16.10.2026
+ ******************************************************************************/
+void Vtf_Init(void)
+{
+  for (uint8_t i = 0; i < VTF_CHANNELS; ++i)
+  {
+    PFIC_DisableFastIRQ(i);
+    aucOwner[i] = VTF_NO_CHANNEL;
+  }
+  for (uint32_t i = 0; i < VTF_MAX_ENTRIES; ++i)
+  {
+    axEntry[i].ucUsed = 0;
+  }
+#ifdef USE_VTF_ADAPTIVE
+  for (uint32_t i = 0; i < VTF_IRQ_NUM; ++i)
+  {
+    Vtf_Hits[i] = 0;
+  }
+#endif /* USE_VTF_ADAPTIVE */
+  xStats.ulRemaps = 0;
+  xStats.ulConflicts = 0;
+  xStats.ulRebalances = 0;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Register interrupt for VTF dispatch
+ *
+ * @param[in] IRQn        Interrupt Number (below VTF_IRQ_NUM)
+ * @param[in] handler     Interrupt handler, as installed in the vector table
+ * @param[in] eclass      Assignment class
+ * @return  (ErrorStatus)  ERROR if registry full or all channels pinned
+ * @date  16.10.2026
+ ******************************************************************************/
+ErrorStatus Vtf_Register(IRQn_Type IRQn, void (*handler)(void), Vtf_Class_t eclass)
+{
+  uint32_t ulEntry = prvFind(IRQn);
+  Vtf_Entry_t* pxEntry;
+  uint8_t ucChannel;
+
+  if ((uint32_t)IRQn >= VTF_IRQ_NUM) return ERROR;
+
+  if (ulEntry == VTF_MAX_ENTRIES)
+  {
+    for (ulEntry = 0; (ulEntry < VTF_MAX_ENTRIES) && axEntry[ulEntry].ucUsed; ++ulEntry);
+    if (ulEntry == VTF_MAX_ENTRIES) return ERROR;
+
+    pxEntry = &axEntry[ulEntry];
+    pxEntry->ucIRQn = (uint8_t)IRQn;
+    pxEntry->ucChannel = VTF_NO_CHANNEL;
+    pxEntry->ulScore = 0;
+  }
+  else
+  {
+    pxEntry = &axEntry[ulEntry];
+  }
+
+  /* Check for conflict before modifying the entry                          */
+  ucChannel = pxEntry->ucChannel;
+  if (ucChannel == VTF_NO_CHANNEL)
+  {
+    ucChannel = prvVictim();
+    if ((ucChannel == VTF_NO_CHANNEL) && (eclass == VTF_CLASS_PINNED))
+    {
+      xStats.ulConflicts++;
+      return ERROR;
+    }
+    if ((ucChannel != VTF_NO_CHANNEL) && (aucOwner[ucChannel] != VTF_NO_CHANNEL) && (eclass == VTF_CLASS_ADAPTIVE))
+    {
+      ucChannel = VTF_NO_CHANNEL;
+    }
+  }
+
+  pxEntry->ulHandler = (uint32_t)(uintptr_t)handler;
+  pxEntry->ucClass = (uint8_t)eclass;
+  pxEntry->ucUsed = 1;
+
+  if (ucChannel != VTF_NO_CHANNEL)
+  {
+    if (aucOwner[ucChannel] != (uint8_t)ulEntry) prvRelease(ucChannel);
+    prvAssign(ucChannel, ulEntry);
+  }
+  return SUCCESS;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Unregister interrupt and release its channel
+ *
+ * @param[in] IRQn        Interrupt Number
+ * @return  (ErrorStatus)  ERROR if not registered
+ * @date  16.10.2026
+ ******************************************************************************/
+ErrorStatus Vtf_Unregister(IRQn_Type IRQn)
+{
+  uint32_t ulEntry = prvFind(IRQn);
+  uint8_t ucChannel;
+
+  if (ulEntry == VTF_MAX_ENTRIES) return ERROR;
+
+  ucChannel = axEntry[ulEntry].ucChannel;
+  axEntry[ulEntry].ucUsed = 0;
+  if (ucChannel != VTF_NO_CHANNEL)
+  {
+    prvRelease(ucChannel);
+    ulEntry = prvCandidate();
+    if (ulEntry != VTF_MAX_ENTRIES) prvAssign(ucChannel, ulEntry);
+  }
+  return SUCCESS;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Get VTF channel of an interrupt
+ *
+ * @param[in] IRQn        Interrupt Number
+ * @return  (uint8_t)  Channel (0..3), VTF_NO_CHANNEL if table dispatched
+ * @date  16.10.2026
+ ******************************************************************************/
+uint8_t Vtf_GetChannel(IRQn_Type IRQn)
+{
+  uint32_t ulEntry = prvFind(IRQn);
+  return (ulEntry == VTF_MAX_ENTRIES) ? VTF_NO_CHANNEL : axEntry[ulEntry].ucChannel;
+}
+
+#ifdef USE_VTF_ADAPTIVE
+/*!****************************************************************************
+ * @brief
+ * Reassign adaptive channels by interrupt frequency
+ *
+ * @date  16.10.2026
+ ******************************************************************************/
+void Vtf_Rebalance(void)
+{
+  /* Fold hits into scores; the counter read-and-clear must not lose a hit  */
+  for (uint32_t i = 0; i < VTF_MAX_ENTRIES; ++i)
+  {
+    Vtf_Entry_t* pxEntry = &axEntry[i];
+    uint32_t ulState, ulHits;
+
+    if (!pxEntry->ucUsed || (pxEntry->ucClass != VTF_CLASS_ADAPTIVE)) continue;
+    ulState = __disable_irq_save();
+    ulHits = Vtf_Hits[pxEntry->ucIRQn];
+    Vtf_Hits[pxEntry->ucIRQn] = 0;
+    __restore_irq(ulState);
+    pxEntry->ulScore = (pxEntry->ulScore >> 1) + ulHits;
+  }
+
+  /* Promote candidates while they beat the weakest occupant                */
+  for (uint32_t i = 0; i < VTF_CHANNELS; ++i)
+  {
+    uint32_t ulCandidate = prvCandidate();
+    uint8_t ucChannel;
+
+    if (ulCandidate == VTF_MAX_ENTRIES) break;
+    ucChannel = prvVictim();
+    if (ucChannel == VTF_NO_CHANNEL) break;
+    if (aucOwner[ucChannel] != VTF_NO_CHANNEL)
+    {
+      if (axEntry[ulCandidate].ulScore <= axEntry[aucOwner[ucChannel]].ulScore + VTF_HYSTERESIS) break;
+      prvRelease(ucChannel);
+    }
+    prvAssign(ucChannel, ulCandidate);
+  }
+  xStats.ulRebalances++;
+}
+#endif /* USE_VTF_ADAPTIVE */
+
+/*!****************************************************************************
+ * @brief
+ * Get manager statistics
+ *
+ * @param[out] stats      Statistics
+ * @date  16.10.2026
+ ******************************************************************************/
+void Vtf_GetStats(Vtf_Stats_t* stats)
+{
+  *stats = xStats;
+}
@@ -0,0 +1,153 @@
+/*!****************************************************************************
+ * @file
+ * core_riscv_vtf.h
+ *
+ * @brief
+ * RISC-V2A Vector-Table-Free (VTF) Fast Interrupt Channel Manager
+ *
+ * Keeps a registry of interrupts eligible for VTF dispatch and assigns them
+ * to the four PFIC VTF channels:
+ *  - PINNED    always occupies a channel; registration fails only if all
+ *              channels are already pinned
+ *  - ADAPTIVE  occupies a channel while one is free or, with
+ *              USE_VTF_ADAPTIVE, while it is among the most frequent
+ *              interrupts measured by VTF_COUNT() (see Vtf_Rebalance())
+ *
+ * A registered handler must also be installed in the vector table, as the
+ * interrupt is dispatched through the table whenever it holds no channel.
+ * Channels are remapped by disabling the channel, reprogramming ID and
+ * address and re-enabling it, so an interrupt taken at any point during a
+ * remap is dispatched either through the table or the new channel, never
+ * to a mismatched handler.
+ *
+ * @note
+ * The manager API is not reentrant and must be called from one context
+ * only. VTF_COUNT() may be used from any handler.
+ *
+ * @date  16.10.2026
+ ******************************************************************************/
+
+#ifndef CORE_RISCV_VTF_H_
+#define CORE_RISCV_VTF_H_
+
+#ifndef CORE_RISCV_H_
+#error "core_riscv.h must be included (via the device header) first"
+#endif /* CORE_RISCV_H_ */
+
+/* Number of PFIC VTF channels                                                */
+#define VTF_CHANNELS                  4U
+
+/* Channel value for "dispatched through the vector table"                    */
+#define VTF_NO_CHANNEL                0xFFU
+
+/* Maximum number of registered interrupts                                    */
+#ifndef VTF_MAX_ENTRIES
+#define VTF_MAX_ENTRIES               8U
+#endif /* VTF_MAX_ENTRIES */
+
+/* Number of interrupt numbers covered by the frequency counters              */
+#ifndef VTF_IRQ_NUM
+#define VTF_IRQ_NUM                   64U
+#endif /* VTF_IRQ_NUM */
+
+/* Score margin a candidate needs to displace a channel occupant              */
+#ifndef VTF_HYSTERESIS
+#define VTF_HYSTERESIS                16UL
+#endif /* VTF_HYSTERESIS */
+
+/* Assignment classes                                                         */
+typedef enum {
+  VTF_CLASS_PINNED = 0,
+  VTF_CLASS_ADAPTIVE
+} Vtf_Class_t;
+
+/* Manager statistics                                                         */
+typedef struct {
+  uint32_t ulRemaps;          /*!< Channel (re)assignments                    */
+  uint32_t ulConflicts;       /*!< Rejected pinned registrations              */
+  uint32_t ulRebalances;      /*!< Vtf_Rebalance() runs                       */
+} Vtf_Stats_t;
+
+#ifdef USE_VTF_ADAPTIVE
+/* Interrupt frequency counters, indexed by IRQn                              */
+extern volatile uint16_t Vtf_Hits[VTF_IRQ_NUM];
+
+/* Count handler invocation, place at the start of registered handlers        */
+#define VTF_COUNT(IRQn)               (Vtf_Hits[(IRQn)]++)
+#else
+#define VTF_COUNT(IRQn)               do {} while (0)
+#endif /* USE_VTF_ADAPTIVE */
+
+/*!****************************************************************************
+ * @brief
+ * Initialise manager and disable all VTF channels
+ *
+ * @date  16.10.2026
+ ******************************************************************************/
+void Vtf_Init(void);
+
+/*!****************************************************************************
+ * @brief
+ * Register interrupt for VTF dispatch
+ *
+ * Registering an interrupt again updates its handler and class. A pinned
+ * interrupt takes a free channel or displaces the least frequent adaptive
+ * one; an adaptive interrupt only takes a free channel.
+ *
+ * @param[in] IRQn        Interrupt Number (below VTF_IRQ_NUM)
+ * @param[in] handler     Interrupt handler, as installed in the vector table
+ * @param[in] eclass      Assignment class
+ * @return  (ErrorStatus)  ERROR if registry full or all channels pinned
+ * @date  16.10.2026
+ ******************************************************************************/
+ErrorStatus Vtf_Register(IRQn_Type IRQn, void (*handler)(void), Vtf_Class_t eclass);
+
+/*!****************************************************************************
+ * @brief
+ * Unregister interrupt and release its channel
+ *
+ * A released channel is handed to the most frequent unassigned adaptive
+ * interrupt, if any.
+ *
+ * @param[in] IRQn        Interrupt Number
+ * @return  (ErrorStatus)  ERROR if not registered
+ * @date  16.10.2026
+ ******************************************************************************/
+ErrorStatus Vtf_Unregister(IRQn_Type IRQn);
+
+/*!****************************************************************************
+ * @brief
+ * Get VTF channel of an interrupt
+ *
+ * @param[in] IRQn        Interrupt Number
+ * @return  (uint8_t)  Channel (0..3), VTF_NO_CHANNEL if table dispatched
+ * @date  16.10.2026
+ ******************************************************************************/
+uint8_t Vtf_GetChannel(IRQn_Type IRQn);
+
+#ifdef USE_VTF_ADAPTIVE
+/*!****************************************************************************
+ * @brief
+ * Reassign adaptive channels by interrupt frequency
+ *
+ * Folds the VTF_COUNT() hits since the last call into a decaying score per
+ * adaptive interrupt (score = score / 2 + hits) and moves the highest
+ * scoring ones onto the channels not held by pinned interrupts. An occupant
+ * is only displaced by a candidate exceeding its score by VTF_HYSTERESIS.
+ * Call periodically, e.g. from a software timer.
+ *
+ * @date  16.10.2026
+ ******************************************************************************/
+void Vtf_Rebalance(void);
+#endif /* USE_VTF_ADAPTIVE */
+
+/*!****************************************************************************
+ * @brief
+ * Get manager statistics
+ *
+ * @param[out] stats      Statistics
+ * @date  16.10.2026
+ ******************************************************************************/
+void Vtf_GetStats(Vtf_Stats_t* stats);
+
+#endif /* CORE_RISCV_VTF_H_ */
@@ -0,0 +1,248 @@
+/*!****************************************************************************
+ * @file
+ * core_riscv_work.c
+ *
+ * @brief
+ * RISC-V2A Deferred Interrupt Work Queue
+ *
+ * @note
+ * Build with RV_DEVICE_HEADER set to the device header, which includes
+ * core_riscv.h (e.g. -DRV_DEVICE_HEADER=\"ch32v00x.h\").
+ *
+ * @date  16.10.2026
+ ******************************************************************************/
+
+#include RV_DEVICE_HEADER
+#include "core_riscv_work.h"
+
+/* Per-priority FIFO queues                                                   */
+static Work_t* apxHead[WORK_PRIOS];
+static Work_t** appxTail[WORK_PRIOS];
+static uint32_t aulDepth[WORK_PRIOS];
+
+/* Remaining items of the batch being drained                                 */
+static Work_t* pxBatch;
+
+/* Statistics                                                                 */
+static Work_Stats_t xStats;
+
+/*!****************************************************************************
+ * @brief
+ * Initialise work queues and enable the work interrupt
+ *
+ * @param[in] priority    PFIC priority of WORK_IRQn
+ * @date  16.10.2026
+ ******************************************************************************/
+void Work_Init(uint8_t priority)
+{
+  for (uint32_t i = 0; i < WORK_PRIOS; ++i)
+  {
+    apxHead[i] = NULL;
+    appxTail[i] = &apxHead[i];
+    aulDepth[i] = 0;
+  }
+  Work_ResetStats();
+
+  PFIC_SetPriority(WORK_IRQn, priority);
+  PFIC_ClearPendingIRQ(WORK_IRQn);
+  PFIC_EnableIRQ(WORK_IRQn);
+}
+
+/*!****************************************************************************
+ * @brief
+ * Set up work item
+ *
+ * @param[out] work       Work item
+ * @param[in] func        Work function
+ * @param[in] arg         Work function argument
+ * @param[in] prio        Priority level (below WORK_PRIOS)
+ * @date  16.10.2026
+ ******************************************************************************/
+void Work_Setup(Work_t* work, Work_Fn_t func, void* arg, uint8_t prio)
+{
+  work->pxNext = NULL;
+  work->pfnFunc = func;
+  work->pvArg = arg;
+  work->ucPrio = (prio < WORK_PRIOS) ? prio : (uint8_t)(WORK_PRIOS - 1U);
+  work->ucQueued = 0;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Queue work item and pend the work interrupt
+ *
+ * @param[in,out] work    Work item
+ * @return  (ErrorStatus)  ERROR if already queued (request coalesced)
+ * @date  16.10.2026
+ ******************************************************************************/
+ErrorStatus Work_Post(Work_t* work)
+{
+  uint32_t ulState = __disable_irq_save();
+  uint32_t ulPrio = work->ucPrio;
+
+  if (work->ucQueued)
+  {
+    xStats.ulCoalesced++;
+    __restore_irq(ulState);
+    return ERROR;
+  }
+
+  work->pxNext = NULL;
+  work->ulPosted = __get_MCYCLE();
+  work->ucQueued = 1;
+  *appxTail[ulPrio] = work;
+  appxTail[ulPrio] = &work->pxNext;
+  if (++aulDepth[ulPrio] > xStats.ulMaxDepth[ulPrio]) xStats.ulMaxDepth[ulPrio] = aulDepth[ulPrio];
+  xStats.ulPosted++;
+  __restore_irq(ulState);
+
+  PFIC_SetPendingIRQ(WORK_IRQn);
+  return SUCCESS;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Unlink item from a singly linked list, interrupts must be masked
+ *
+ * @param[in,out] head    List head
+ * @param[in] work        Work item
+ * @return  (Work_t**)  Link that pointed to the item, NULL if not found
+ * @date  16.10.2026
+ ******************************************************************************/
+static Work_t** prvUnlink(Work_t** head, const Work_t* work)
+{
+  for (Work_t** ppxLink = head; *ppxLink != NULL; ppxLink = &(*ppxLink)->pxNext)
+  {
+    if (*ppxLink != work) continue;
+
+    *ppxLink = work->pxNext;
+    return ppxLink;
+  }
+  return NULL;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Remove queued work item
+ *
+ * Items of the batch being drained are removed as well, unless their
+ * function has already been called.
+ *
+ * @param[in,out] work    Work item
+ * @return  (ErrorStatus)  ERROR if not queued (idle, running or done)
+ * @date  16.10.2026
+ ******************************************************************************/
+ErrorStatus Work_Cancel(Work_t* work)
+{
+  uint32_t ulState = __disable_irq_save();
+  uint32_t ulPrio = work->ucPrio;
+  ErrorStatus eResult = ERROR;
+  Work_t** ppxLink;
+
+  if (!work->ucQueued)
+  {
+    /* Not queued                                                           */
+  }
+  else if ((ppxLink = prvUnlink(&apxHead[ulPrio], work)) != NULL)
+  {
+    if (appxTail[ulPrio] == &work->pxNext) appxTail[ulPrio] = ppxLink;
+    aulDepth[ulPrio]--;
+    work->ucQueued = 0;
+    eResult = SUCCESS;
+  }
+  else if (prvUnlink(&pxBatch, work) != NULL)
+  {
+    work->ucQueued = 0;
+    eResult = SUCCESS;
+  }
+  __restore_irq(ulState);
+  return eResult;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Run queued work, to be called from the WORK_IRQn handler
+ *
+ * @date  16.10.2026
+ ******************************************************************************/
+void Work_Handler(void)
+{
+  uint32_t ulPrio = 0;
+
+  while (ulPrio < WORK_PRIOS)
+  {
+    uint32_t ulState = __disable_irq_save();
+
+    /* Detach whole queue, posts from now on start a new batch              */
+    pxBatch = apxHead[ulPrio];
+    apxHead[ulPrio] = NULL;
+    appxTail[ulPrio] = &apxHead[ulPrio];
+    aulDepth[ulPrio] = 0;
+    __restore_irq(ulState);
+
+    if (pxBatch == NULL)
+    {
+      ulPrio++;
+      continue;
+    }
+
+    xStats.ulBatches++;
+    for (;;)
+    {
+      Work_t* pxWork;
+      uint32_t ulLatency;
+
+      /* Take the next item, Work_Cancel() may have removed it              */
+      ulState = __disable_irq_save();
+      pxWork = pxBatch;
+      if (pxWork != NULL)
+      {
+        pxBatch = pxWork->pxNext;
+        pxWork->ucQueued = 0;
+      }
+      __restore_irq(ulState);
+      if (pxWork == NULL) break;
+
+      ulLatency = __get_MCYCLE() - pxWork->ulPosted;
+      if (ulLatency > xStats.ulMaxLatency) xStats.ulMaxLatency = ulLatency;
+      pxWork->pfnFunc(pxWork, pxWork->pvArg);
+      xStats.ulExecuted++;
+    }
+    ulPrio = 0;
+  }
+}
+
+/*!****************************************************************************
+ * @brief
+ * Get work queue statistics
+ *
+ * @param[out] stats      Statistics
+ * @date  16.10.2026
+ ******************************************************************************/
+void Work_GetStats(Work_Stats_t* stats)
+{
+  uint32_t ulState = __disable_irq_save();
+  *stats = xStats;
+  __restore_irq(ulState);
+}
+
+/*!****************************************************************************
+ * @brief
+ * Reset work queue statistics
+ *
+ * @date  16.10.2026
+ ******************************************************************************/
+void Work_ResetStats(void)
+{
+  uint32_t ulState = __disable_irq_save();
+  xStats.ulPosted = 0;
+  xStats.ulCoalesced = 0;
+  xStats.ulExecuted = 0;
+  xStats.ulBatches = 0;
+  for (uint32_t i = 0; i < WORK_PRIOS; ++i)
+  {
+    xStats.ulMaxDepth[i] = 0;
+  }
+  xStats.ulMaxLatency = 0;
+  __restore_irq(ulState);
+}
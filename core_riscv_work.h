@@ -0,0 +1,147 @@
+/*!****************************************************************************
+ * @file
+ * core_riscv_work.h
+ *
+ * @brief
+ * RISC-V2A Deferred Interrupt Work Queue
+ *
+ * Interrupt handlers (top halves) post work items with Work_Post(); the
+ * items run later from a software-pended, low-priority interrupt (bottom
+ * half), so the top halves stay short and other interrupts see less
+ * latency. Items are queued FIFO per priority level, 0 being the highest,
+ * and drained in batches: each queue is detached in a short interrupt-masked
+ * section and its items run with interrupts enabled.
+ *
+ * Posting an item that is still queued is coalesced into the pending
+ * request. An item is dequeued before its function runs, so it may re-post
+ * itself. An item counts as queued until its function is called, so it can
+ * be cancelled while waiting in a detached batch.
+ *
+ * The work interrupt (WORK_IRQn) handler must call Work_Handler(). Its PFIC
+ * priority should be below all interrupts posting work.
+ *
+ * @date  16.10.2026
+ ******************************************************************************/
+
+#ifndef CORE_RISCV_WORK_H_
+#define CORE_RISCV_WORK_H_
+
+#ifndef CORE_RISCV_H_
+#error "core_riscv.h must be included (via the device header) first"
+#endif /* CORE_RISCV_H_ */
+
+#include <stddef.h>
+
+/* Software interrupt used to run the bottom half                             */
+#ifndef WORK_IRQn
+#define WORK_IRQn                     Software_IRQn
+#endif /* WORK_IRQn */
+
+/* Number of work priority levels                                             */
+#ifndef WORK_PRIOS
+#define WORK_PRIOS                    2U
+#endif /* WORK_PRIOS */
+
+struct Work_s;
+
+/* Work function, called from the work interrupt                              */
+typedef void (*Work_Fn_t)(struct Work_s* work, void* arg);
+
+/* Work item, statically allocated by the application                         */
+typedef struct Work_s {
+  struct Work_s* pxNext;      /*!< Next item in queue                         */
+  Work_Fn_t pfnFunc;
+  void* pvArg;
+  uint32_t ulPosted;          /*!< mcycle of the first pending post           */
+  uint8_t ucPrio;             /*!< Priority level, 0 is highest               */
+  volatile uint8_t ucQueued;  /*!< Item is queued                             */
+} Work_t;
+
+/* Static initialiser for a Work_t, prio must be a constant below WORK_PRIOS */
+#define WORK_INIT(func, arg, prio)                                             \
+  { NULL, (func), (arg), 0,                                                    \
+    (uint8_t)((prio) + 0 * sizeof(char[((prio) < WORK_PRIOS) ? 1 : -1])), 0 }
+
+/* Work queue statistics                                                      */
+typedef struct {
+  uint32_t ulPosted;          /*!< Items queued                               */
+  uint32_t ulCoalesced;       /*!< Posts merged into a pending request        */
+  uint32_t ulExecuted;        /*!< Work functions run                         */
+  uint32_t ulBatches;         /*!< Queues drained                             */
+  uint32_t ulMaxDepth[WORK_PRIOS];  /*!< Maximum queue length                 */
+  uint32_t ulMaxLatency;      /*!< Maximum post-to-run time in cycles         */
+} Work_Stats_t;
+
+/*!****************************************************************************
+ * @brief
+ * Initialise work queues and enable the work interrupt
+ *
+ * @param[in] priority    PFIC priority of WORK_IRQn
+ * @date  16.10.2026
+ ******************************************************************************/
+void Work_Init(uint8_t priority);
+
+/*!****************************************************************************
+ * @brief
+ * Set up work item
+ *
+ * @param[out] work       Work item
+ * @param[in] func        Work function
+ * @param[in] arg         Work function argument
+ * @param[in] prio        Priority level (below WORK_PRIOS)
+ * @date  16.10.2026
+ ******************************************************************************/
+void Work_Setup(Work_t* work, Work_Fn_t func, void* arg, uint8_t prio);
+
+/*!****************************************************************************
+ * @brief
+ * Queue work item and pend the work interrupt
+ *
+ * @param[in,out] work    Work item
+ * @return  (ErrorStatus)  ERROR if already queued (request coalesced)
+ * @date  16.10.2026
+ ******************************************************************************/
+ErrorStatus Work_Post(Work_t* work);
+
+/*!****************************************************************************
+ * @brief
+ * Remove queued work item
+ *
+ * Items of the batch being drained are removed as well, unless their
+ * function has already been called.
+ *
+ * @param[in,out] work    Work item
+ * @return  (ErrorStatus)  ERROR if not queued (idle, running or done)
+ * @date  16.10.2026
+ ******************************************************************************/
+ErrorStatus Work_Cancel(Work_t* work);
+
+/*!****************************************************************************
+ * @brief
+ * Run queued work, to be called from the WORK_IRQn handler
+ *
+ * Returns when all queues are empty. After each batch, draining restarts at
+ * the highest priority level.
+ *
+ * @date  16.10.2026
+ ******************************************************************************/
+void Work_Handler(void);
+
+/*!****************************************************************************
+ * @brief
+ * Get work queue statistics
+ *
+ * @param[out] stats      Statistics
+ * @date  16.10.2026
+ ******************************************************************************/
+void Work_GetStats(Work_Stats_t* stats);
+
+/*!****************************************************************************
+ * @brief
+ * Reset work queue statistics
+ *
+ * @date  16.10.2026
+ ******************************************************************************/
+void Work_ResetStats(void);
+
+#endif /* CORE_RISCV_WORK_H_ */
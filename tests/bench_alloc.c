@@ -0,0 +1,184 @@
+/*!****************************************************************************
+ * @file
+ * bench_alloc.c
+ *
+ * @brief
+ * Host Benchmark: Pool and Arena Allocators vs. malloc()/free()
+ *
+ * Runs the same workloads on core_riscv_alloc.c and on the C library heap:
+ *  - pool    BENCH_BLOCKS fixed-size blocks allocated, then freed in
+ *            pseudo-random order (Pool_Alloc()/Pool_Free() vs. malloc()/free())
+ *  - arena   BENCH_BLOCKS allocations of 4..128 bytes, then all released
+ *            (Arena_Alloc()/Arena_Reset() vs. malloc()/free() of each)
+ *
+ * Times are host nanoseconds per operation, averaged over BENCH_ROUNDS
+ * batches of BENCH_BLOCKS operations. core_riscv_alloc.c is compiled into
+ * this file with __disable_irq_save()/__restore_irq() replaced by no-ops,
+ * so the pool and arena figures do not include the simulated interrupt
+ * masking of USE_HOST_SIM (on the target, masking costs a csrrci/csrw pair
+ * per operation). The host C library is glibc, not newlib as on the target,
+ * so the figures show the trend, not target cycles.
+ *
+ * @date  16.10.2026
+ ******************************************************************************/
+
+#include "host_device.h"
+#include "host_test.h"
+#include <stdlib.h>
+
+/* Interrupt masking compiled out of the allocator under test                 */
+#define __disable_irq_save()          0U
+#define __restore_irq(state)          ((void)(state))
+#include "core_riscv_alloc.c"
+
+/* Allocations per round                                                      */
+#define BENCH_BLOCKS                  64UL
+
+/* Block size of the pool workload                                            */
+#define BENCH_BLOCK_SIZE              32UL
+
+/* Repetitions per measurement                                                */
+#define BENCH_ROUNDS                  2000UL
+
+/* Heap region for Alloc_Init(), stands in for _sheap.._eheap               */
+#define BENCH_REGION                  16384UL
+
+#define BENCH_STR_(x)                 #x
+#define BENCH_STR(x)                  BENCH_STR_(x)
+
+uint32_t _sheap[BENCH_REGION / 4U];
+__asm__(".globl _eheap\n.set _eheap, _sheap + " BENCH_STR(BENCH_REGION));
+
+static void* apvPtr[BENCH_BLOCKS];
+static uint32_t aulOrder[BENCH_BLOCKS];
+static uint32_t aulSize[BENCH_BLOCKS];
+
+/*!****************************************************************************
+ * @brief
+ * Print allocation and release time of one allocator
+ *
+ * @param[in] name        Workload and allocator
+ * @param[in] ns          Accumulated host ns for allocation and release
+ * @date  16.10.2026
+ ******************************************************************************/
+static void prvPrint(const char* name, const double ns[2])
+{
+  printf("%-14s %10.1f %10.1f\n", name, ns[0] / (BENCH_BLOCKS * BENCH_ROUNDS),
+         ns[1] / (BENCH_BLOCKS * BENCH_ROUNDS));
+}
+
+/*!****************************************************************************
+ * @brief
+ * Shuffle release order
+ *
+ * @param[in,out] seed    Random state
+ * @date  16.10.2026
+ ******************************************************************************/
+static void prvShuffle(uint32_t* seed)
+{
+  for (uint32_t i = BENCH_BLOCKS - 1U; i > 0; --i)
+  {
+    uint32_t j, ulTmp;
+
+    *seed = *seed * 1664525UL + 1013904223UL;
+    j = (*seed >> 8) % (i + 1U);
+    ulTmp = aulOrder[i];
+    aulOrder[i] = aulOrder[j];
+    aulOrder[j] = ulTmp;
+  }
+}
+
+/*!****************************************************************************
+ * @brief
+ * Fixed-size workload: pool vs. heap
+ *
+ * @date  16.10.2026
+ ******************************************************************************/
+static void prvBenchPool(void)
+{
+  double adPool[2] = { 0 }, adHeap[2] = { 0 };
+  uint32_t ulSeed = 12345;
+  Pool_t xPool;
+  double dStart;
+
+  CHECK(Pool_Init(&xPool, BENCH_BLOCK_SIZE, BENCH_BLOCKS) == SUCCESS);
+  for (uint32_t r = 0; r < BENCH_ROUNDS; ++r)
+  {
+    prvShuffle(&ulSeed);
+
+    dStart = Test_Now();
+    for (uint32_t i = 0; i < BENCH_BLOCKS; ++i) apvPtr[i] = Pool_Alloc(&xPool);
+    adPool[0] += Test_Now() - dStart;
+    CHECK(Pool_Alloc(&xPool) == NULL);
+    dStart = Test_Now();
+    for (uint32_t i = 0; i < BENCH_BLOCKS; ++i) Pool_Free(&xPool, apvPtr[aulOrder[i]]);
+    adPool[1] += Test_Now() - dStart;
+
+    dStart = Test_Now();
+    for (uint32_t i = 0; i < BENCH_BLOCKS; ++i) apvPtr[i] = malloc(BENCH_BLOCK_SIZE);
+    adHeap[0] += Test_Now() - dStart;
+    for (uint32_t i = 0; i < BENCH_BLOCKS; ++i) CHECK(apvPtr[i] != NULL);
+    dStart = Test_Now();
+    for (uint32_t i = 0; i < BENCH_BLOCKS; ++i) free(apvPtr[aulOrder[i]]);
+    adHeap[1] += Test_Now() - dStart;
+  }
+  prvPrint("pool", adPool);
+  prvPrint("pool  malloc", adHeap);
+}
+
+/*!****************************************************************************
+ * @brief
+ * Mixed-size scratch workload: arena vs. heap
+ *
+ * @date  16.10.2026
+ ******************************************************************************/
+static void prvBenchArena(void)
+{
+  double adArena[2] = { 0 }, adHeap[2] = { 0 };
+  uint32_t ulSeed = 54321;
+  Arena_t xArena;
+  double dStart;
+
+  CHECK(Arena_Init(&xArena, BENCH_BLOCKS * 128U) == SUCCESS);
+  for (uint32_t r = 0; r < BENCH_ROUNDS; ++r)
+  {
+    prvShuffle(&ulSeed);
+    for (uint32_t i = 0; i < BENCH_BLOCKS; ++i)
+    {
+      ulSeed = ulSeed * 1664525UL + 1013904223UL;
+      aulSize[i] = ((ulSeed >> 8) % 125U) + 4U;
+    }
+
+    dStart = Test_Now();
+    for (uint32_t i = 0; i < BENCH_BLOCKS; ++i) apvPtr[i] = Arena_Alloc(&xArena, aulSize[i]);
+    adArena[0] += Test_Now() - dStart;
+    for (uint32_t i = 0; i < BENCH_BLOCKS; ++i) CHECK(apvPtr[i] != NULL);
+    dStart = Test_Now();
+    Arena_Reset(&xArena, 0);
+    adArena[1] += Test_Now() - dStart;
+    CHECK(Arena_Mark(&xArena) == 0);
+
+    dStart = Test_Now();
+    for (uint32_t i = 0; i < BENCH_BLOCKS; ++i) apvPtr[i] = malloc(aulSize[i]);
+    adHeap[0] += Test_Now() - dStart;
+    for (uint32_t i = 0; i < BENCH_BLOCKS; ++i) CHECK(apvPtr[i] != NULL);
+    dStart = Test_Now();
+    for (uint32_t i = 0; i < BENCH_BLOCKS; ++i) free(apvPtr[aulOrder[i]]);
+    adHeap[1] += Test_Now() - dStart;
+  }
+  prvPrint("arena", adArena);
+  prvPrint("arena malloc", adHeap);
+}
+
+int main(void)
+{
+  RVSim_Reset();
+  for (uint32_t i = 0; i < BENCH_BLOCKS; ++i) aulOrder[i] = i;
+  CHECK(Alloc_Init() == BENCH_REGION);
+
+  printf("%-14s %10s %10s   (host ns per operation; arena release: all %lu in one)\n", "workload",
+         "alloc", "release", BENCH_BLOCKS);
+  prvBenchPool();
+  prvBenchArena();
+  return TEST_RESULT();
+}
@@ -0,0 +1,238 @@
+/*!****************************************************************************
+ * @file
+ * bench_timer.c
+ *
+ * @brief
+ * Host Benchmark: Timer Wheel vs. Sorted List
+ *
+ * Compares core_riscv_timer.c with a naive sorted doubly-linked timer list
+ * (O(n) insert, O(1) cancel and expiry) for 10, 100 and 1000 timers with
+ * pseudo-random expiries of 1..BENCH_RANGE ticks:
+ *  - insert  Timer_Start() of all timers
+ *  - cancel  Timer_Stop() of all timers in insertion order
+ *  - expire  Timer_Process() at each Timer_NextDeadline() (tickless use)
+ *            until all timers fired
+ *
+ * Both run their operations with interrupts masked as on the target. Times
+ * are host nanoseconds per timer, averaged over BENCH_ROUNDS; they show the
+ * scaling, not target cycles. Every expiry is checked for the correct tick.
+ *
+ * @date  16.10.2026
+ ******************************************************************************/
+
+#include "host_device.h"
+#include "host_test.h"
+#include "core_riscv_timer.h"
+
+/* Expiry range in ticks                                                      */
+#define BENCH_RANGE                   4096UL
+
+/* Repetitions per measurement                                                */
+#define BENCH_ROUNDS                  20UL
+
+/* Largest timer count                                                        */
+#define BENCH_TIMERS_MAX              1000UL
+
+/* Naive timer list node                                                      */
+typedef struct List_s {
+  struct List_s* pxNext;
+  struct List_s** ppxPrev;
+  uint32_t ulExpiry;
+} List_t;
+
+static List_t* pxListHead;
+static List_t axList[BENCH_TIMERS_MAX];
+static Timer_t axTimer[BENCH_TIMERS_MAX];
+static uint32_t aulTicks[BENCH_TIMERS_MAX];
+static uint32_t ulFired, ulLate, ulTick;
+
+/*!****************************************************************************
+ * @brief
+ * Insert into sorted list after all timers with the same or earlier expiry
+ *
+ * @param[in,out] node    Idle node with expiry set
+ * @date  16.10.2026
+ ******************************************************************************/
+static void prvListInsert(List_t* node)
+{
+  uint32_t ulState = __disable_irq_save();
+  List_t** ppxLink = &pxListHead;
+
+  while ((*ppxLink != NULL) && ((int32_t)((*ppxLink)->ulExpiry - node->ulExpiry) <= 0))
+  {
+    ppxLink = &(*ppxLink)->pxNext;
+  }
+  node->pxNext = *ppxLink;
+  if (node->pxNext != NULL) node->pxNext->ppxPrev = &node->pxNext;
+  node->ppxPrev = ppxLink;
+  *ppxLink = node;
+  __restore_irq(ulState);
+}
+
+/*!****************************************************************************
+ * @brief
+ * Remove node from the list
+ *
+ * @param[in,out] node    Node
+ * @date  16.10.2026
+ ******************************************************************************/
+static void prvListRemove(List_t* node)
+{
+  uint32_t ulState = __disable_irq_save();
+
+  if (node->ppxPrev != NULL)
+  {
+    *node->ppxPrev = node->pxNext;
+    if (node->pxNext != NULL) node->pxNext->ppxPrev = node->ppxPrev;
+    node->ppxPrev = NULL;
+  }
+  __restore_irq(ulState);
+}
+
+/*!****************************************************************************
+ * @brief
+ * Pop and run all nodes expired at now
+ *
+ * @param[in] now         Current tick count
+ * @date  16.10.2026
+ ******************************************************************************/
+static void prvListProcess(uint32_t now)
+{
+  uint32_t ulState = __disable_irq_save();
+
+  while ((pxListHead != NULL) && ((int32_t)(pxListHead->ulExpiry - now) <= 0))
+  {
+    List_t* pxNode = pxListHead;
+
+    prvListRemove(pxNode);
+    __restore_irq(ulState);
+    if (pxNode->ulExpiry != now) ulLate++;
+    ulFired++;
+    ulState = __disable_irq_save();
+  }
+  __restore_irq(ulState);
+}
+
+/*!****************************************************************************
+ * @brief
+ * Wheel expiry callback
+ *
+ * @param[in] timer       Expired timer
+ * @param[in] arg         Unused
+ * @date  16.10.2026
+ ******************************************************************************/
+static void prvTimerCallback(Timer_t* timer, void* arg)
+{
+  (void)arg;
+  if (timer->ulExpiry != ulTick) ulLate++;
+  ulFired++;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Run one round of insert, cancel and expire on the wheel
+ *
+ * @param[in] count       Number of timers
+ * @param[out] ns         Accumulated host ns for insert, cancel, expire
+ * @date  16.10.2026
+ ******************************************************************************/
+static void prvRoundWheel(uint32_t count, double ns[3])
+{
+  double dStart;
+  uint32_t ulNext;
+
+  Timer_Init(0);
+  dStart = Test_Now();
+  for (uint32_t i = 0; i < count; ++i) Timer_Start(&axTimer[i], aulTicks[i], 0);
+  ns[0] += Test_Now() - dStart;
+
+  dStart = Test_Now();
+  for (uint32_t i = 0; i < count; ++i) Timer_Stop(&axTimer[i]);
+  ns[1] += Test_Now() - dStart;
+
+  for (uint32_t i = 0; i < count; ++i) Timer_Start(&axTimer[i], aulTicks[i], 0);
+  ulFired = 0;
+  ulTick = 0;
+  dStart = Test_Now();
+  while ((ulNext = Timer_NextDeadline(ulTick)) != TIMER_INFINITE)
+  {
+    ulTick += ulNext;
+    Timer_Process(ulTick);
+  }
+  ns[2] += Test_Now() - dStart;
+  CHECK(ulFired == count);
+}
+
+/*!****************************************************************************
+ * @brief
+ * Run one round of insert, cancel and expire on the sorted list
+ *
+ * @param[in] count       Number of timers
+ * @param[out] ns         Accumulated host ns for insert, cancel, expire
+ * @date  16.10.2026
+ ******************************************************************************/
+static void prvRoundList(uint32_t count, double ns[3])
+{
+  double dStart;
+
+  pxListHead = NULL;
+  dStart = Test_Now();
+  for (uint32_t i = 0; i < count; ++i)
+  {
+    axList[i].ulExpiry = aulTicks[i];
+    prvListInsert(&axList[i]);
+  }
+  ns[0] += Test_Now() - dStart;
+
+  dStart = Test_Now();
+  for (uint32_t i = 0; i < count; ++i) prvListRemove(&axList[i]);
+  ns[1] += Test_Now() - dStart;
+
+  for (uint32_t i = 0; i < count; ++i) prvListInsert(&axList[i]);
+  ulFired = 0;
+  dStart = Test_Now();
+  while (pxListHead != NULL)
+  {
+    ulTick = pxListHead->ulExpiry;
+    prvListProcess(ulTick);
+  }
+  ns[2] += Test_Now() - dStart;
+  CHECK(ulFired == count);
+}
+
+int main(void)
+{
+  static const uint32_t aulCounts[] = { 10, 100, 1000 };
+  uint32_t ulSeed = 12345;
+
+  RVSim_Reset();
+  for (uint32_t i = 0; i < BENCH_TIMERS_MAX; ++i)
+  {
+    ulSeed = ulSeed * 1664525UL + 1013904223UL;
+    aulTicks[i] = ((ulSeed >> 8) % BENCH_RANGE) + 1UL;
+    Timer_Setup(&axTimer[i], prvTimerCallback, NULL);
+  }
+
+  printf("%-6s %-6s %10s %10s %10s   (host ns per timer)\n", "timers", "impl", "insert", "cancel", "expire");
+  for (uint32_t c = 0; c < sizeof(aulCounts) / sizeof(aulCounts[0]); ++c)
+  {
+    uint32_t ulCount = aulCounts[c];
+    double adWheel[3] = { 0 }, adList[3] = { 0 };
+
+    ulLate = 0;
+    for (uint32_t r = 0; r < BENCH_ROUNDS; ++r)
+    {
+      prvRoundWheel(ulCount, adWheel);
+      prvRoundList(ulCount, adList);
+    }
+    CHECK(ulLate == 0);
+
+    printf("%-6u %-6s %10.1f %10.1f %10.1f\n", ulCount, "wheel",
+           adWheel[0] / (ulCount * BENCH_ROUNDS), adWheel[1] / (ulCount * BENCH_ROUNDS),
+           adWheel[2] / (ulCount * BENCH_ROUNDS));
+    printf("%-6u %-6s %10.1f %10.1f %10.1f\n", ulCount, "list",
+           adList[0] / (ulCount * BENCH_ROUNDS), adList[1] / (ulCount * BENCH_ROUNDS),
+           adList[2] / (ulCount * BENCH_ROUNDS));
+  }
+  return TEST_RESULT();
+}
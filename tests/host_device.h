@@ -0,0 +1,35 @@
+/*!****************************************************************************
+ * @file
+ * host_device.h
+ *
+ * @brief
+ * Minimal Device Header for Host Tests and Target Benches
+ *
+ * Stands in for the vendor device header: defines the interrupt numbers used
+ * by the tests and includes core_riscv.h. Passed to the core modules with
+ * -DRV_DEVICE_HEADER=\"host_device.h\", with USE_HOST_SIM for the host
+ * tests and without it for the C benches of tests/target.
+ *
+ * @date  16.10.2026
+ ******************************************************************************/
+
+#ifndef HOST_DEVICE_H_
+#define HOST_DEVICE_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+/* Interrupt Number Definition (subset of CH32V003)                           */
+typedef enum {
+  NonMaskableInt_IRQn = 2,
+  HardFault_IRQn      = 3,
+  SysTicK_IRQn        = 12,
+  Software_IRQn       = 14,
+  EXTI7_0_IRQn        = 20,
+  USART1_IRQn         = 32,
+  TIM2_IRQn           = 38,
+} IRQn_Type;
+
+#include "core_riscv.h"
+
+#endif /* HOST_DEVICE_H_ */
@@ -0,0 +1,59 @@
+/*!****************************************************************************
+ * @file
+ * host_test.h
+ *
+ * @brief
+ * Minimal Assertion and Timing Helpers for Host Tests
+ *
+ * CHECK() records a failure and continues, so one run reports all broken
+ * expectations; TEST_RESULT() turns the failure count into the exit status.
+ *
+ * @date  16.10.2026
+ ******************************************************************************/
+
+#ifndef HOST_TEST_H_
+#define HOST_TEST_H_
+
+#include <stdio.h>
+#include <stdint.h>
+#include <time.h>
+
+static unsigned int uiTestFailures;
+
+/* Record failure of an expectation                                           */
+#define CHECK(cond)                                                            \
+  do {                                                                         \
+    if (!(cond))                                                               \
+    {                                                                          \
+      printf("%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #cond);          \
+      ++uiTestFailures;                                                        \
+    }                                                                          \
+  } while (0)
+
+/* Record failure if the simulator access counters differ                     */
+#define CHECK_ACCESS(reads, writes)                                            \
+  do {                                                                         \
+    CHECK(RVSim_State.ulReads == (reads));                                     \
+    CHECK(RVSim_State.ulWrites == (writes));                                   \
+  } while (0)
+
+/* Exit status of the test program                                            */
+#define TEST_RESULT()                                                          \
+  ((uiTestFailures == 0) ? (printf("%s: passed\n", __FILE__), 0)               \
+                         : (printf("%s: %u failed\n", __FILE__, uiTestFailures), 1))
+
+/*!****************************************************************************
+ * @brief
+ * Read monotonic host clock
+ *
+ * @return  (double)  Time in nanoseconds
+ * @date  16.10.2026
+ ******************************************************************************/
+static inline double Test_Now(void)
+{
+  struct timespec xTs;
+  clock_gettime(CLOCK_MONOTONIC, &xTs);
+  return (double)xTs.tv_sec * 1e9 + (double)xTs.tv_nsec;
+}
+
+#endif /* HOST_TEST_H_ */
@@ -0,0 +1,105 @@
+/******************************************************************************
+ * Interrupt handler benchmark: flash vs. SRAM (RV_RAMFUNC) resident code
+ *
+ * SysTick fires TICKS times while main() sleeps in WFI. The handler clears
+ * CNTIF and sums a table in a loop, a typical small ISR with taken branches.
+ * Run with -w <n> to compare flash wait states; the simulator's IRQ table
+ * gives the handler cycles and the entry latency.
+ *
+ * Default build: handler in flash (.text).
+ * --defsym USE_RAM_ISR=1: handler in .ramfunc, copied to SRAM by the startup
+ * code (USE_RAMFUNC).
+ ******************************************************************************/
+
+.equ  TICKS,          32              /* SysTick interrupts to sample         */
+.equ  TABLE_WORDS,    8               /* Words summed per interrupt           */
+
+/******************************************************************************
+ * Vector table: reset jump, SysTick (12)
+ ******************************************************************************/
+.section  .vector_table.0, "ax"
+.option push
+.option norvc
+.globl  _vector_base
+_vector_base:
+  j     _start                        /* Reset entry (address 0)              */
+.option pop
+.section  .vector_table.1, "a"
+  .word 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+  .word SysTick_Handler               /* 12: SysTick                          */
+
+.text
+.globl  SystemInit
+SystemInit:
+  ret
+
+/******************************************************************************
+ * main
+ ******************************************************************************/
+.globl  main
+main:
+  li    t0,   0xE000F000              /* SysTick: period 500 cycles           */
+  li    t1,   499
+  sw    t1,   0x10(t0)
+  li    t1,   0xF                     /* STE|STIE|STCLK|STRE                  */
+  sw    t1,   0(t0)
+  li    t0,   0xE000E100              /* Enable IRQ 12                        */
+  li    t1,   1 << 12
+  sw    t1,   0(t0)
+  la    s0,   ticks
+main_wait:
+  wfi
+  lw    t1,   0(s0)
+  li    t2,   TICKS
+  bltu  t1,   t2,   main_wait
+
+  li    t0,   0xE000F000              /* Stop SysTick                         */
+  sw    zero, 0(t0)
+  la    t0,   sum                     /* 1 + 2 + ... + 8 per interrupt        */
+  lw    t1,   0(t0)
+  li    t2,   TICKS * 36
+  bne   t1,   t2,   fail
+  li    a0,   0
+  ret
+fail:
+  unimp
+
+/******************************************************************************
+ * SysTick_Handler (registers saved by the hardware prologue)
+ ******************************************************************************/
+.ifdef USE_RAM_ISR
+.section  .ramfunc, "ax"
+.else
+.text
+.endif
+.balign 4
+.globl  SysTick_Handler
+SysTick_Handler:
+  li    t0,   0xE000F000
+  sw    zero, 4(t0)                   /* Clear CNTIF                          */
+  la    t0,   table
+  li    t1,   TABLE_WORDS
+  la    a1,   sum
+  lw    a0,   0(a1)
+SysTick_Handler_loop:
+  lw    t2,   0(t0)
+  add   a0,   a0,   t2
+  addi  t0,   t0,   4
+  addi  t1,   t1,   -1
+  bnez  t1,   SysTick_Handler_loop
+  sw    a0,   0(a1)
+  la    t0,   ticks
+  lw    a0,   0(t0)
+  addi  a0,   a0,   1
+  sw    a0,   0(t0)
+  mret
+
+.data
+table:
+  .word 1, 2, 3, 4, 5, 6, 7, 8
+
+.bss
+ticks:
+  .skip 4
+sum:
+  .skip 4
@@ -0,0 +1,181 @@
+/*!****************************************************************************
+ * @file
+ * bench_ring.c
+ *
+ * @brief
+ * Target Benchmark: Compiled Ring_Push()/Ring_Pop() vs. Masked Queue
+ *
+ * The workload of bench_ring.s built from C: main() moves BENCH_BYTES bytes
+ * through a 64-byte queue in blocks of BENCH_BLOCK bytes while SysTick
+ * fires. queue_push and queue_pop are out-of-line wrappers, so their rows
+ * in the per-symbol table give the compiled cycles per call, comparable to
+ * the hand-written model of bench_ring.s (Makefile target ring-c, gated).
+ *
+ * Default build: Ring_Push()/Ring_Pop() of core_riscv_ring.h.
+ * -DUSE_MASKED: conventional queue with a shared fill count, each operation
+ * wrapped in __disable_irq_save()/__restore_irq().
+ *
+ * @date  16.10.2026
+ ******************************************************************************/
+
+#include "host_device.h"
+#include "core_riscv_ring.h"
+#include "core_riscv_vectors.h"
+
+/* Bytes transferred                                                          */
+#define BENCH_BYTES                   4096U
+
+/* Bytes per push/pop block                                                   */
+#define BENCH_BLOCK                   32U
+
+/* Queue size (power of two)                                                  */
+#define BENCH_SIZE                    64U
+
+void SysTick_Handler(void);
+
+#define BENCH_VECTORS(BIND, WEAK)                                              \
+  BIND(SysTicK_IRQn, SysTick_Handler)
+RV_VECTOR_TABLE(BENCH_VECTORS)
+
+static uint8_t aucStorage[BENCH_SIZE];
+static volatile uint32_t ulTicks;
+
+#ifndef USE_MASKED
+typedef Ring_t Queue_t;
+
+/*!****************************************************************************
+ * @brief
+ * Push byte: Ring_Push()
+ *
+ * @param[in,out] queue   Queue
+ * @param[in] data        Byte
+ * @return  (ErrorStatus)  ERROR if full
+ * @date  16.10.2026
+ ******************************************************************************/
+__attribute__((noinline)) ErrorStatus queue_push(Queue_t* queue, uint8_t data)
+{
+  return Ring_Push(queue, data);
+}
+
+/*!****************************************************************************
+ * @brief
+ * Pop byte: Ring_Pop()
+ *
+ * @param[in,out] queue   Queue
+ * @param[out] data       Byte
+ * @return  (ErrorStatus)  ERROR if empty
+ * @date  16.10.2026
+ ******************************************************************************/
+__attribute__((noinline)) ErrorStatus queue_pop(Queue_t* queue, uint8_t* data)
+{
+  return Ring_Pop(queue, data);
+}
+#else
+/* Queue with a shared fill count                                             */
+typedef struct {
+  uint8_t* pucBuf;            /*!< Storage                                    */
+  uint32_t ulMask;            /*!< Size - 1                                   */
+  uint32_t ulHead;            /*!< Write index                                */
+  uint32_t ulTail;            /*!< Read index                                 */
+  uint32_t ulCount;           /*!< Fill count, written by both sides          */
+} Queue_t;
+
+/*!****************************************************************************
+ * @brief
+ * Push byte with interrupts masked
+ *
+ * @param[in,out] queue   Queue
+ * @param[in] data        Byte
+ * @return  (ErrorStatus)  ERROR if full
+ * @date  16.10.2026
+ ******************************************************************************/
+__attribute__((noinline)) ErrorStatus queue_push(Queue_t* queue, uint8_t data)
+{
+  uint32_t ulState = __disable_irq_save();
+
+  if (queue->ulCount > queue->ulMask)
+  {
+    __restore_irq(ulState);
+    return ERROR;
+  }
+  queue->ulCount++;
+  queue->pucBuf[queue->ulHead] = data;
+  queue->ulHead = (queue->ulHead + 1U) & queue->ulMask;
+  __restore_irq(ulState);
+  return SUCCESS;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Pop byte with interrupts masked
+ *
+ * @param[in,out] queue   Queue
+ * @param[out] data       Byte
+ * @return  (ErrorStatus)  ERROR if empty
+ * @date  16.10.2026
+ ******************************************************************************/
+__attribute__((noinline)) ErrorStatus queue_pop(Queue_t* queue, uint8_t* data)
+{
+  uint32_t ulState = __disable_irq_save();
+
+  if (queue->ulCount == 0)
+  {
+    __restore_irq(ulState);
+    return ERROR;
+  }
+  queue->ulCount--;
+  *data = queue->pucBuf[queue->ulTail];
+  queue->ulTail = (queue->ulTail + 1U) & queue->ulMask;
+  __restore_irq(ulState);
+  return SUCCESS;
+}
+#endif /* USE_MASKED */
+
+static Queue_t xQueue;
+
+/*!****************************************************************************
+ * @brief
+ * SysTick interrupt: count ticks
+ *
+ * @date  16.10.2026
+ ******************************************************************************/
+RV_INTERRUPT void SysTick_Handler(void)
+{
+  SysTick->SR = 0;
+  ulTicks++;
+}
+
+void SystemInit(void)
+{
+}
+
+int main(void)
+{
+  uint32_t ulPushed = 0;
+  uint8_t ucData;
+
+  xQueue.pucBuf = aucStorage;
+  xQueue.ulMask = BENCH_SIZE - 1U;
+
+  SysTick->CMPR = 996U;
+  SysTick->CTLR = SYSTICK_CTLR_STE | SYSTICK_CTLR_STIE | SYSTICK_CTLR_STCLK | SYSTICK_CTLR_STRE;
+  PFIC_EnableIRQ(SysTicK_IRQn);
+
+  while (ulPushed < BENCH_BYTES)
+  {
+    for (uint32_t i = 0; i < BENCH_BLOCK; ++i)
+    {
+      if (queue_push(&xQueue, (uint8_t)ulPushed++) != SUCCESS) __asm volatile ("unimp");
+    }
+    for (uint32_t i = BENCH_BLOCK; i > 0; --i)
+    {
+      if ((queue_pop(&xQueue, &ucData) != SUCCESS) || (ucData != (uint8_t)(ulPushed - i)))
+      {
+        __asm volatile ("unimp");
+      }
+    }
+  }
+  if (queue_pop(&xQueue, &ucData) != ERROR) __asm volatile ("unimp");
+  SysTick->CTLR = 0;
+  return 0;
+}
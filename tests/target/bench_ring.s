@@ -0,0 +1,242 @@
+/******************************************************************************
+ * Queue throughput benchmark: lock-free ring vs. interrupt-masked queue
+ *
+ * main() moves BYTES bytes through a 64-byte queue in blocks of BLOCK bytes
+ * (push BLOCK, pop BLOCK) while SysTick fires. The per-symbol table gives the
+ * cycles per call of queue_push and queue_pop, the IRQ 12 max-lat column the
+ * worst-case entry latency added by the queue.
+ *
+ * Default build: Ring_Push()/Ring_Pop() of core_riscv_ring.h (free-running
+ * head/tail, each written by one side, compiler barriers only).
+ * --defsym USE_MASKED=1: conventional queue with a shared fill count, each
+ * operation wrapped in __disable_irq_save()/__restore_irq().
+ *
+ * Both are written as the out-of-line equivalent of the C sequences (a0 =
+ * queue, a1 = byte or destination, a0 = ErrorStatus), so call overhead is
+ * included in both. The figures are a model of the C code; bench_ring.c
+ * builds the same workload from C (Makefile target ring-c).
+ ******************************************************************************/
+
+.equ  BYTES,          4096            /* Bytes transferred                    */
+.equ  BLOCK,          32              /* Bytes per push/pop block             */
+.equ  SIZE,           64              /* Queue size (power of two)            */
+
+.equ  Q_BUF,          0               /* Ring_t / queue field offsets         */
+.equ  Q_MASK,         4
+.equ  Q_HEAD,         8
+.equ  Q_TAIL,         12
+.equ  Q_COUNT,        16              /* Masked queue only                    */
+
+/******************************************************************************
+ * Vector table: reset jump, SysTick (12)
+ ******************************************************************************/
+.section  .vector_table.0, "ax"
+.option push
+.option norvc
+.globl  _vector_base
+_vector_base:
+  j     _start                        /* Reset entry (address 0)              */
+.option pop
+.section  .vector_table.1, "a"
+  .word 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+  .word SysTick_Handler               /* 12: SysTick                          */
+
+.text
+.globl  SystemInit
+SystemInit:
+  ret
+
+/******************************************************************************
+ * main
+ ******************************************************************************/
+.globl  main
+main:
+  addi  sp,   sp,   -16
+  sw    ra,   12(sp)
+  la    s0,   queue                   /* Init: buffer, mask                   */
+  la    t0,   storage
+  sw    t0,   Q_BUF(s0)
+  li    t0,   SIZE - 1
+  sw    t0,   Q_MASK(s0)
+
+  li    t0,   0xE000F000              /* SysTick: period 997 cycles           */
+  li    t1,   996
+  sw    t1,   0x10(t0)
+  li    t1,   0xF                     /* STE|STIE|STCLK|STRE                  */
+  sw    t1,   0(t0)
+  li    t0,   0xE000E100              /* Enable IRQ 12                        */
+  li    t1,   1 << 12
+  sw    t1,   0(t0)
+
+  li    s1,   0                       /* Bytes pushed = expected pop value    */
+main_block:
+  li    t2,   BLOCK
+  sw    t2,   8(sp)
+main_push:
+  mv    a0,   s0
+  andi  a1,   s1,   0xFF
+  call  queue_push
+  bnez  a0,   fail
+  addi  s1,   s1,   1
+  lw    t2,   8(sp)
+  addi  t2,   t2,   -1
+  sw    t2,   8(sp)
+  bnez  t2,   main_push
+
+  li    t2,   BLOCK
+  sw    t2,   8(sp)
+main_pop:
+  mv    a0,   s0
+  addi  a1,   sp,   4
+  call  queue_pop
+  bnez  a0,   fail
+  lw    t2,   8(sp)                   /* Expected: s1 - remaining             */
+  sub   t1,   s1,   t2
+  andi  t1,   t1,   0xFF
+  lbu   t0,   4(sp)
+  bne   t0,   t1,   fail
+  addi  t2,   t2,   -1
+  sw    t2,   8(sp)
+  bnez  t2,   main_pop
+
+  li    t2,   BYTES
+  bltu  s1,   t2,   main_block
+
+  mv    a0,   s0                      /* Empty now                            */
+  addi  a1,   sp,   4
+  call  queue_pop
+  beqz  a0,   fail
+  li    t0,   0xE000F000              /* Stop SysTick                         */
+  sw    zero, 0(t0)
+  lw    ra,   12(sp)
+  addi  sp,   sp,   16
+  li    a0,   0
+  ret
+fail:
+  unimp
+
+.ifndef USE_MASKED
+/******************************************************************************
+ * queue_push: Ring_Push()
+ ******************************************************************************/
+.globl  queue_push
+queue_push:
+  lw    a2,   Q_HEAD(a0)
+  lw    a3,   Q_TAIL(a0)
+  lw    a4,   Q_MASK(a0)
+  sub   a3,   a2,   a3
+  bltu  a4,   a3,   1f                /* Full                                 */
+  lw    a5,   Q_BUF(a0)
+  and   a4,   a4,   a2
+  add   a5,   a5,   a4
+  sb    a1,   0(a5)
+  addi  a2,   a2,   1
+  sw    a2,   Q_HEAD(a0)
+  li    a0,   0
+  ret
+1:
+  li    a0,   1
+  ret
+
+/******************************************************************************
+ * queue_pop: Ring_Pop()
+ ******************************************************************************/
+.globl  queue_pop
+queue_pop:
+  lw    a3,   Q_TAIL(a0)
+  lw    a2,   Q_HEAD(a0)
+  beq   a2,   a3,   1f                /* Empty                                */
+  lw    a4,   Q_MASK(a0)
+  lw    a5,   Q_BUF(a0)
+  and   a4,   a4,   a3
+  add   a5,   a5,   a4
+  lbu   a5,   0(a5)
+  sb    a5,   0(a1)
+  addi  a3,   a3,   1
+  sw    a3,   Q_TAIL(a0)
+  li    a0,   0
+  ret
+1:
+  li    a0,   1
+  ret
+
+.else
+/******************************************************************************
+ * queue_push: shared count, interrupts masked
+ ******************************************************************************/
+.globl  queue_push
+queue_push:
+  csrrci a3,  mstatus,  0x08
+  lw    a4,   Q_COUNT(a0)
+  lw    a5,   Q_MASK(a0)
+  bltu  a5,   a4,   1f                /* Full                                 */
+  addi  a4,   a4,   1
+  sw    a4,   Q_COUNT(a0)
+  lw    a2,   Q_HEAD(a0)
+  lw    a4,   Q_BUF(a0)
+  add   a4,   a4,   a2
+  sb    a1,   0(a4)
+  addi  a2,   a2,   1
+  and   a2,   a2,   a5
+  sw    a2,   Q_HEAD(a0)
+  andi  a3,   a3,   0x08
+  csrs  mstatus,  a3
+  li    a0,   0
+  ret
+1:
+  andi  a3,   a3,   0x08
+  csrs  mstatus,  a3
+  li    a0,   1
+  ret
+
+/******************************************************************************
+ * queue_pop: shared count, interrupts masked
+ ******************************************************************************/
+.globl  queue_pop
+queue_pop:
+  csrrci a3,  mstatus,  0x08
+  lw    a4,   Q_COUNT(a0)
+  beqz  a4,   1f                      /* Empty                                */
+  addi  a4,   a4,   -1
+  sw    a4,   Q_COUNT(a0)
+  lw    a2,   Q_TAIL(a0)
+  lw    a4,   Q_BUF(a0)
+  lw    a5,   Q_MASK(a0)
+  add   a4,   a4,   a2
+  lbu   a4,   0(a4)
+  sb    a4,   0(a1)
+  addi  a2,   a2,   1
+  and   a2,   a2,   a5
+  sw    a2,   Q_TAIL(a0)
+  andi  a3,   a3,   0x08
+  csrs  mstatus,  a3
+  li    a0,   0
+  ret
+1:
+  andi  a3,   a3,   0x08
+  csrs  mstatus,  a3
+  li    a0,   1
+  ret
+.endif
+
+/******************************************************************************
+ * SysTick_Handler
+ ******************************************************************************/
+.globl  SysTick_Handler
+SysTick_Handler:
+  li    t0,   0xE000F000
+  sw    zero, 4(t0)                   /* Clear CNTIF                          */
+  la    t0,   ticks
+  lw    a0,   0(t0)
+  addi  a0,   a0,   1
+  sw    a0,   0(t0)
+  mret
+
+.bss
+.balign 4
+queue:
+  .skip 20
+storage:
+  .skip SIZE
+ticks:
+  .skip 4
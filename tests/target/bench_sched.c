@@ -0,0 +1,81 @@
+/*!****************************************************************************
+ * @file
+ * bench_sched.c
+ *
+ * @brief
+ * Target Benchmark: Context Switch of the Compiled core_riscv_sched.c
+ *
+ * The hand-over of bench_sched.s on the real module: task A (priority 0)
+ * suspends itself, task B (priority 1) resumes A, BENCH_ROUNDS times; every
+ * switch interrupt is a full task switch. Run under rv32ec_sim, the
+ * Sched_Switch and Sched_SysTickHandler rows give the cycles per switch of
+ * the compiled code (Makefile target sched-c, gated).
+ *
+ * @date  16.10.2026
+ ******************************************************************************/
+
+#include "host_device.h"
+#include "core_riscv_sched.h"
+#include "core_riscv_vectors.h"
+
+/* Hand-overs A -> B -> A                                                     */
+#define BENCH_ROUNDS                  64U
+
+/* Per task stack in words                                                    */
+#define BENCH_STACK_WORDS             (SCHED_STACK_MIN + 16U)
+
+#define BENCH_VECTORS(BIND, WEAK)                                              \
+  BIND(SysTicK_IRQn, Sched_SysTickHandler)
+RV_VECTOR_TABLE(BENCH_VECTORS)
+
+static Sched_Task_t xTaskA, xTaskB;
+static uint32_t aulStackA[BENCH_STACK_WORDS], aulStackB[BENCH_STACK_WORDS];
+static volatile uint32_t ulRounds;
+
+/*!****************************************************************************
+ * @brief
+ * Task A: count round and suspend; end both tasks after BENCH_ROUNDS
+ *
+ * @param[in] arg         Unused
+ * @date  16.10.2026
+ ******************************************************************************/
+static void prvTaskA(void* arg)
+{
+  (void)arg;
+  for (;;)
+  {
+    if (++ulRounds == BENCH_ROUNDS) Sched_Suspend(&xTaskB);
+    Sched_Suspend(NULL);
+  }
+}
+
+/*!****************************************************************************
+ * @brief
+ * Task B: resume task A
+ *
+ * @param[in] arg         Unused
+ * @date  16.10.2026
+ ******************************************************************************/
+static void prvTaskB(void* arg)
+{
+  (void)arg;
+  for (;;) Sched_Resume(&xTaskA);
+}
+
+void SystemInit(void)
+{
+}
+
+int main(void)
+{
+  Sched_Create(&xTaskA, 0, prvTaskA, NULL, aulStackA, BENCH_STACK_WORDS);
+  Sched_Create(&xTaskB, 1, prvTaskB, NULL, aulStackB, BENCH_STACK_WORDS);
+  Sched_Start();
+
+  /* Idle until both tasks are suspended: idle -> A, A <-> B, A -> idle     */
+  if ((ulRounds != BENCH_ROUNDS) || (Sched_GetSwitches() != 2U * BENCH_ROUNDS))
+  {
+    __asm volatile ("unimp");
+  }
+  return 0;
+}
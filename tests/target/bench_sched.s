@@ -0,0 +1,267 @@
+/******************************************************************************
+ * Context switch benchmark for core_riscv_sched.c
+ *
+ * Two tasks hand over to each other ROUNDS times: task A (priority 0)
+ * suspends itself, task B (priority 1) resumes A, each followed by a pend of
+ * the switch interrupt, so every handler run is a full task switch. The
+ * simulator's per-symbol table gives the cycles per call of
+ * Sched_SysTickHandler (handler code, entry to mret) and Sched_Switch; the
+ * IRQ 12 row gives the total per switch including interrupt entry.
+ *
+ * Sched_SysTickHandler is the inline assembly of core_riscv_sched.c
+ * verbatim. Sched_Switch is a model: a hand translation of the C function in
+ * the style of gcc -Os (SCHED_PRIOS 8, prvLowestBit() inlined, no tick
+ * pending), so its figures are estimates. bench_sched.c runs the same
+ * hand-over on the compiled module when a cross compiler is available.
+ ******************************************************************************/
+
+/* prvPend(): set SYSTICK_CTLR_SWIE with interrupts masked                   */
+.macro PEND
+  csrrci a1,  mstatus,  0x08
+  li    a4,   0xE000F000
+  lw    a5,   0(a4)
+  lui   a3,   0x80000
+  or    a5,   a5,   a3
+  sw    a5,   0(a4)
+  andi  a1,   a1,   0x08
+  csrs  mstatus,  a1
+.endm
+
+.equ  ROUNDS,         64              /* A -> B -> A hand-overs               */
+.equ  STACK_WORDS,    48              /* Per task stack                       */
+
+.equ  FRAME_WORDS,    13              /* Software-saved frame                 */
+
+/******************************************************************************
+ * Vector table: reset jump, SysTick (12)
+ ******************************************************************************/
+.section  .vector_table.0, "ax"
+.option push
+.option norvc
+.globl  _vector_base
+_vector_base:
+  j     _start                        /* Reset entry (address 0)              */
+.option pop
+.section  .vector_table.1, "a"
+  .word 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+  .word Sched_SysTickHandler          /* 12: SysTick                          */
+
+.text
+.globl  SystemInit
+SystemInit:
+  ret
+
+/******************************************************************************
+ * main: Sched_Create() of both tasks, Sched_Start(), idle until done
+ ******************************************************************************/
+.globl  main
+main:
+  addi  sp,   sp,   -16
+  sw    ra,   12(sp)
+  la    t0,   tcb_a                   /* Initial frames: mepc = entry         */
+  la    t1,   stack_a + 4 * (STACK_WORDS - FRAME_WORDS)
+  sw    t1,   0(t0)
+  la    t2,   task_a
+  sw    t2,   0(t1)
+  la    t0,   tcb_b
+  la    t1,   stack_b + 4 * (STACK_WORDS - FRAME_WORDS)
+  sw    t1,   0(t0)
+  la    t2,   task_b
+  sw    t2,   0(t1)
+  la    t0,   apxTask
+  la    t1,   tcb_a
+  sw    t1,   0(t0)
+  la    t1,   tcb_b
+  sw    t1,   4(t0)
+  la    t0,   ulReady
+  li    t1,   3
+  sw    t1,   0(t0)
+  la    t0,   pxCurrent
+  la    t1,   xIdle
+  sw    t1,   0(t0)
+
+  csrci 0x804,  1                     /* INTSYSCR.HWSTKEN off                 */
+  li    t0,   0xE000E40C              /* IPRIOR[3]: SysTick priority 0xFF     */
+  li    t1,   0xFF
+  sw    t1,   0(t0)
+  li    t0,   0xE000E100              /* Enable IRQ 12                        */
+  li    t1,   1 << 12
+  sw    t1,   0(t0)
+  PEND
+
+  la    t0,   rounds                  /* Back in idle: all done               */
+  lw    t1,   0(t0)
+  li    t2,   ROUNDS
+  bne   t1,   t2,   fail
+  la    t0,   ulSwitches              /* A, then A <-> B, then idle           */
+  lw    t1,   0(t0)
+  li    t2,   2 * ROUNDS
+  bne   t1,   t2,   fail
+  lw    ra,   12(sp)
+  addi  sp,   sp,   16
+  li    a0,   0
+  ret
+fail:
+  unimp
+
+/******************************************************************************
+ * Task A (priority 0): count round, suspend itself; end after ROUNDS
+ ******************************************************************************/
+task_a:
+  la    s0,   rounds
+  lw    s1,   0(s0)
+  addi  s1,   s1,   1
+  sw    s1,   0(s0)
+  la    s0,   ulReady
+  csrci mstatus,  0x08
+  lw    s1,   0(s0)
+  andi  s1,   s1,   ~1
+  li    a0,   ROUNDS                  /* Last round: end task B as well       */
+  la    a1,   rounds
+  lw    a1,   0(a1)
+  bne   a1,   a0,   1f
+  li    s1,   0
+1:
+  sw    s1,   0(s0)
+  csrsi mstatus,  0x08
+  PEND
+  j     task_a
+
+/******************************************************************************
+ * Task B (priority 1): resume task A
+ ******************************************************************************/
+task_b:
+  la    s0,   ulReady
+  csrci mstatus,  0x08
+  lw    s1,   0(s0)
+  ori   s1,   s1,   1
+  sw    s1,   0(s0)
+  csrsi mstatus,  0x08
+  PEND
+  j     task_b
+
+/******************************************************************************
+ * Sched_Switch (hand translation, see above)
+ ******************************************************************************/
+.globl  Sched_Switch
+Sched_Switch:
+  addi  sp,   sp,   -16
+  sw    ra,   12(sp)
+  sw    s0,   8(sp)
+  mv    s0,   a0
+  lui   a5,   0xE000F
+  lw    a4,   4(a5)                   /* SR.CNTIF: Sched_OnSysTick()          */
+  andi  a4,   a4,   1
+  beqz  a4,   1f
+  call  fail
+1:
+  csrrci a3,  mstatus,  0x08
+  lw    a4,   0(a5)                   /* Clear SWIE                           */
+  slli  a4,   a4,   1
+  srli  a4,   a4,   1
+  sw    a4,   0(a5)
+  la    a1,   pxCurrent
+  lw    a2,   0(a1)
+  sw    s0,   0(a2)                   /* pxCurrent->pulSP = sp                */
+  la    a5,   ulReady
+  lw    a0,   0(a5)
+  la    a5,   xIdle
+  beqz  a0,   5f
+  li    a4,   0                       /* prvLowestBit()                       */
+  andi  a5,   a0,   15
+  bnez  a5,   2f
+  addi  a4,   a4,   4
+  srli  a0,   a0,   4
+2:
+  andi  a5,   a0,   3
+  bnez  a5,   3f
+  addi  a4,   a4,   2
+  srli  a0,   a0,   2
+3:
+  andi  a5,   a0,   1
+  bnez  a5,   4f
+  addi  a4,   a4,   1
+4:
+  slli  a4,   a4,   2
+  la    a5,   apxTask
+  add   a5,   a5,   a4
+  lw    a5,   0(a5)
+5:
+  beq   a5,   a2,   6f
+  sw    a5,   0(a1)                   /* pxCurrent = pxNext, count switch     */
+  la    a4,   ulSwitches
+  lw    a2,   0(a4)
+  addi  a2,   a2,   1
+  sw    a2,   0(a4)
+6:
+  andi  a3,   a3,   0x08
+  csrs  mstatus,  a3
+  lw    a0,   0(a5)
+  lw    ra,   12(sp)
+  lw    s0,   8(sp)
+  addi  sp,   sp,   16
+  ret
+
+/******************************************************************************
+ * Sched_SysTickHandler (core_riscv_sched.c)
+ ******************************************************************************/
+.globl  Sched_SysTickHandler
+Sched_SysTickHandler:
+  csrci mstatus, 8
+  addi  sp, sp, -52
+  sw    ra, 4(sp)
+  sw    t0, 8(sp)
+  sw    t1, 12(sp)
+  sw    t2, 16(sp)
+  sw    s0, 20(sp)
+  sw    s1, 24(sp)
+  sw    a0, 28(sp)
+  sw    a1, 32(sp)
+  sw    a2, 36(sp)
+  sw    a3, 40(sp)
+  sw    a4, 44(sp)
+  sw    a5, 48(sp)
+  csrr  t0, mepc
+  sw    t0, 0(sp)
+  mv    a0, sp
+  call  Sched_Switch
+  mv    sp, a0
+  lw    t0, 0(sp)
+  csrw  mepc, t0
+  lw    ra, 4(sp)
+  lw    t0, 8(sp)
+  lw    t1, 12(sp)
+  lw    t2, 16(sp)
+  lw    s0, 20(sp)
+  lw    s1, 24(sp)
+  lw    a0, 28(sp)
+  lw    a1, 32(sp)
+  lw    a2, 36(sp)
+  lw    a3, 40(sp)
+  lw    a4, 44(sp)
+  lw    a5, 48(sp)
+  addi  sp, sp, 52
+  mret
+
+.bss
+.balign 4
+apxTask:
+  .skip 4 * 8
+ulReady:
+  .skip 4
+ulSwitches:
+  .skip 4
+pxCurrent:
+  .skip 4
+xIdle:
+  .skip 4
+tcb_a:
+  .skip 4
+tcb_b:
+  .skip 4
+rounds:
+  .skip 4
+stack_a:
+  .skip 4 * STACK_WORDS
+stack_b:
+  .skip 4 * STACK_WORDS
@@ -0,0 +1,194 @@
+/******************************************************************************
+ * Reset-to-main benchmark and simulator self-test for rv32ec_sim
+ *
+ * Linked with startup_riscv.s and link.ld. Reset-to-main is measured with
+ * "-k SystemInit -s main" (SystemInit polls RCC ready flags, which never
+ * set on the plain peripheral memory of the simulator). The full run checks
+ * the .data copy and .bss clear, SysTick and software interrupts and the
+ * hardware prologue/epilogue; any failure executes an illegal instruction
+ * (simulator exit status 1).
+ *
+ * --defsym BSS_EXTRA=<n> / DATA_EXTRA=<n> enlarge .bss and .data by n bytes
+ * to measure the clear/copy loops on larger sections. The .data extension is
+ * a zero run followed by a repeated byte, exercising the zero run and match
+ * tokens of USE_DATA_PACKED.
+ ******************************************************************************/
+
+.ifndef BSS_EXTRA
+.equ  BSS_EXTRA,      0
+.endif
+.ifndef DATA_EXTRA
+.equ  DATA_EXTRA,     0
+.endif
+
+/******************************************************************************
+ * Vector table: reset jump, SysTick (12) and software interrupt (14)
+ ******************************************************************************/
+.section  .vector_table.0, "ax"
+.option push
+.option norvc
+.globl  _vector_base
+_vector_base:
+  j     _start                        /* Reset entry (address 0)              */
+.option pop
+.section  .vector_table.1, "a"
+  .word 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+  .word SysTick_Handler               /* 12: SysTick                          */
+  .word 0
+  .word SW_Handler                    /* 14: Software interrupt               */
+
+/******************************************************************************
+ * SystemInit
+ * Wait for HSI ready (RCC_CTLR.HSIRDY)
+ ******************************************************************************/
+.text
+.globl  SystemInit
+SystemInit:
+  lui   t0,   0x40021                 /* RCC base                             */
+1:
+  lw    t1,   0(t0)
+  andi  t1,   t1,   2
+  beqz  t1,   1b
+  ret
+
+/******************************************************************************
+ * crc32
+ * Bit-wise CRC-32 (a0 = data, a1 = length) -> a0
+ ******************************************************************************/
+.globl  crc32
+crc32:
+  li    a2,   -1
+  li    a5,   0xEDB88320
+crc32_byte:
+  beqz  a1,   crc32_done
+  lbu   a3,   0(a0)
+  xor   a2,   a2,   a3
+  li    a4,   8
+crc32_bit:
+  andi  a3,   a2,   1
+  srli  a2,   a2,   1
+  beqz  a3,   1f
+  xor   a2,   a2,   a5
+1:
+  addi  a4,   a4,   -1
+  bnez  a4,   crc32_bit
+  addi  a0,   a0,   1
+  addi  a1,   a1,   -1
+  j     crc32_byte
+crc32_done:
+  not   a0,   a2
+  ret
+
+/******************************************************************************
+ * main
+ ******************************************************************************/
+.globl  main
+main:
+  addi  sp,   sp,   -16
+  sw    ra,   12(sp)
+  la    a0,   msg                     /* CRC-32 check value of "123456789"    */
+  li    a1,   9
+  call  crc32
+  li    t0,   0xCBF43926
+  bne   a0,   t0,   fail
+  la    t0,   zeroed                  /* .bss cleared                         */
+  lw    t1,   32(t0)
+  bnez  t1,   fail
+  la    t0,   initd                   /* .data copied, unaligned tail         */
+  lw    t1,   24(t0)
+  li    t2,   7
+  bne   t1,   t2,   fail
+  lbu   t1,   28(t0)
+  li    t2,   9
+  bne   t1,   t2,   fail
+.if DATA_EXTRA
+  la    t0,   initd_extra + DATA_EXTRA / 2
+  lbu   t1,   -1(t0)
+  bnez  t1,   fail
+  lbu   t1,   0(t0)
+  li    t2,   0x5A
+  bne   t1,   t2,   fail
+  lbu   t1,   DATA_EXTRA - DATA_EXTRA / 2 - 1(t0)
+  bne   t1,   t2,   fail
+.endif
+
+  /* SysTick every 1000 cycles (STE|STIE|STCLK|STRE), enable IRQs 12 and 14 */
+  li    t0,   0xE000F000
+  li    t1,   999
+  sw    t1,   0x10(t0)
+  li    t1,   0xF
+  sw    t1,   0(t0)
+  li    t0,   0xE000E100
+  li    t1,   (1 << 12) | (1 << 14)
+  sw    t1,   0(t0)
+
+  li    a5,   0x1234                  /* Clobbered by the handler (HPE check) */
+  la    s0,   ticks
+main_wait:
+  wfi
+  lw    t1,   0(s0)
+  li    t2,   5
+  bltu  t1,   t2,   main_wait
+  li    t2,   0x1234
+  bne   a5,   t2,   fail
+
+  li    t0,   0xE000E200              /* Pend software interrupt              */
+  li    t1,   1 << 14
+  sw    t1,   0(t0)
+  nop
+  la    t0,   swcount
+  lw    t1,   0(t0)
+  li    t2,   1
+  bne   t1,   t2,   fail
+
+  li    t0,   0xE000F000              /* Stop SysTick                         */
+  sw    zero, 0(t0)
+  lw    ra,   12(sp)
+  addi  sp,   sp,   16
+  li    a0,   0
+  ret
+fail:
+  unimp
+
+/******************************************************************************
+ * Interrupt handlers (registers saved by the hardware prologue)
+ ******************************************************************************/
+.globl  SysTick_Handler
+SysTick_Handler:
+  li    t0,   0xE000F000
+  sw    zero, 4(t0)                   /* Clear CNTIF                          */
+  la    t0,   ticks
+  lw    a0,   0(t0)
+  addi  a0,   a0,   1
+  sw    a0,   0(t0)
+  li    a5,   0
+  mret
+
+.globl  SW_Handler
+SW_Handler:
+  la    t0,   swcount
+  lw    a0,   0(t0)
+  addi  a0,   a0,   1
+  sw    a0,   0(t0)
+  mret
+
+.section  .rodata
+msg:
+  .ascii "123456789"
+
+.data
+initd:
+  .word 1, 2, 3, 4, 5, 6, 7
+  .byte 9
+initd_extra:
+  .fill DATA_EXTRA / 2, 1, 0
+  .fill DATA_EXTRA - DATA_EXTRA / 2, 1, 0x5A
+
+.bss
+ticks:
+  .skip 4
+swcount:
+  .skip 4
+zeroed:
+  .skip 37
+  .skip BSS_EXTRA
@@ -0,0 +1,113 @@
+/******************************************************************************
+ * Critical section latency benchmark: global masking vs. priority threshold
+ *
+ * main() runs a critical section of fixed length in a loop while SysTick
+ * (priority 0x40) fires with a period that is not a multiple of the loop,
+ * so its pend time sweeps over every instruction of the loop. The
+ * simulator's max-lat column for IRQ 12 is the worst-case blocking of the
+ * urgent interrupt.
+ *
+ * Default build: __disable_irq_save()/__restore_irq() sequence.
+ * --defsym USE_THRESHOLD=1: PFIC_RaiseThreshold(0x80)/PFIC_RestoreThreshold()
+ * sequence, which leaves priority 0x40 unmasked.
+ ******************************************************************************/
+
+.equ  SECTION_LOOPS,  16              /* Critical section body iterations     */
+.equ  TICKS,          64              /* SysTick interrupts to sample         */
+
+/******************************************************************************
+ * Vector table: reset jump, SysTick (12)
+ ******************************************************************************/
+.section  .vector_table.0, "ax"
+.option push
+.option norvc
+.globl  _vector_base
+_vector_base:
+  j     _start                        /* Reset entry (address 0)              */
+.option pop
+.section  .vector_table.1, "a"
+  .word 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+  .word SysTick_Handler               /* 12: SysTick                          */
+
+.text
+.globl  SystemInit
+SystemInit:
+  ret
+
+/******************************************************************************
+ * main
+ ******************************************************************************/
+.globl  main
+main:
+  li    t0,   0xE000E40C              /* IPRIOR[3]: SysTick priority 0x40     */
+  li    t1,   0x40
+  sw    t1,   0(t0)
+  li    t0,   0xE000F000              /* SysTick: period 997 cycles           */
+  li    t1,   996
+  sw    t1,   0x10(t0)
+  li    t1,   0xF                     /* STE|STIE|STCLK|STRE                  */
+  sw    t1,   0(t0)
+  li    t0,   0xE000E100              /* Enable IRQ 12                        */
+  li    t1,   1 << 12
+  sw    t1,   0(t0)
+  la    s0,   ticks
+  li    s1,   0xE000E040              /* ITHRESDR                             */
+
+main_loop:
+.ifdef USE_THRESHOLD
+section_enter:                        /* PFIC_RaiseThreshold(0x80)            */
+  csrrci a1,  mstatus,  0x08
+  lw    a2,   0(s1)
+  li    a3,   0x80
+  beqz  a2,   1f
+  bgeu  a3,   a2,   2f
+1:
+  sw    a3,   0(s1)
+2:
+  andi  a1,   a1,   0x08
+  csrs  mstatus,  a1
+.else
+section_enter:                        /* __disable_irq_save()                 */
+  csrrci a1,  mstatus,  0x08
+.endif
+
+section_body:
+  li    t2,   SECTION_LOOPS
+1:
+  addi  t2,   t2,   -1
+  bnez  t2,   1b
+
+.ifdef USE_THRESHOLD
+section_exit:                         /* PFIC_RestoreThreshold()              */
+  sw    a2,   0(s1)
+.else
+section_exit:                         /* __restore_irq()                      */
+  andi  a1,   a1,   0x08
+  csrs  mstatus,  a1
+.endif
+
+  lw    t1,   0(s0)
+  li    t2,   TICKS
+  bltu  t1,   t2,   main_loop
+
+  li    t0,   0xE000F000              /* Stop SysTick                         */
+  sw    zero, 0(t0)
+  li    a0,   0
+  ret
+
+/******************************************************************************
+ * SysTick_Handler
+ ******************************************************************************/
+.globl  SysTick_Handler
+SysTick_Handler:
+  li    t0,   0xE000F000
+  sw    zero, 4(t0)                   /* Clear CNTIF                          */
+  la    t0,   ticks
+  lw    a0,   0(t0)
+  addi  a0,   a0,   1
+  sw    a0,   0(t0)
+  mret
+
+.bss
+ticks:
+  .skip 4
@@ -0,0 +1,5 @@
+/******************************************************************************
+ * Packed .data image (tools/data_pack.c output) for USE_DATA_PACKED builds
+ ******************************************************************************/
+.section  .data_packed, "a"
+  .incbin "data.lz"
@@ -0,0 +1,108 @@
+/*!****************************************************************************
+ * @file
+ * test_alloc.c
+ *
+ * @brief
+ * Host Test: Pool and Arena Allocators
+ *
+ * Checks that sizes above ALLOC_SIZE_MAX are rejected instead of wrapping in
+ * ALLOC_ROUND(), that heap and static (POOL_DEFINE()) pools hand out each
+ * block once and reuse freed blocks, and that interrupts are re-enabled
+ * after each call.
+ *
+ * @date  16.10.2026
+ ******************************************************************************/
+
+#include "host_device.h"
+#include "host_test.h"
+#include "core_riscv_alloc.h"
+
+/* Heap region for Alloc_Init(), stands in for _sheap.._eheap               */
+#define TEST_REGION                   256UL
+
+#define TEST_STR_(x)                  #x
+#define TEST_STR(x)                   TEST_STR_(x)
+
+uint32_t _sheap[TEST_REGION / 4U];
+__asm__(".globl _eheap\n.set _eheap, _sheap + " TEST_STR(TEST_REGION));
+
+POOL_DEFINE(xStaticPool, 6, 4);
+
+/*!****************************************************************************
+ * @brief
+ * Oversized requests fail without consuming memory
+ *
+ * @date  16.10.2026
+ ******************************************************************************/
+static void prvTestLimits(void)
+{
+  uint32_t ulFree = Alloc_GetFree();
+  Pool_t xPool;
+  Arena_t xArena;
+
+  CHECK(Alloc_Carve(UINT32_MAX) == NULL);
+  CHECK(Alloc_Carve(ALLOC_SIZE_MAX + 1U) == NULL);
+  CHECK(Pool_Init(&xPool, UINT32_MAX, 1) == ERROR);
+  CHECK(Pool_Init(&xPool, 0x80000000UL, 2) == ERROR);
+  CHECK(Pool_Init(&xPool, 4, 0) == ERROR);
+  CHECK(Arena_Init(&xArena, UINT32_MAX) == ERROR);
+  CHECK(Alloc_GetFree() == ulFree);
+
+  CHECK(Arena_Init(&xArena, 32) == SUCCESS);
+  CHECK(Arena_Alloc(&xArena, UINT32_MAX) == NULL);
+  CHECK(Arena_Alloc(&xArena, ALLOC_SIZE_MAX + 1U) == NULL);
+  CHECK(Arena_Mark(&xArena) == 0);
+  CHECK(Arena_Alloc(&xArena, 30) != NULL);
+  CHECK(Arena_Mark(&xArena) == 32);
+  CHECK(Alloc_GetFree() == ulFree - 32U);
+  CHECK((RVSim_ReadCSR("mstatus") & MSTATUS_MIE) != 0);
+}
+
+/*!****************************************************************************
+ * @brief
+ * Allocate all blocks of a pool, free one and allocate it again
+ *
+ * @param[in,out] pool    Empty pool
+ * @param[in] count       Number of blocks
+ * @date  16.10.2026
+ ******************************************************************************/
+static void prvTestPool(Pool_t* pool, uint32_t count)
+{
+  uint8_t* apucBlock[4];
+
+  for (uint32_t i = 0; i < count; ++i)
+  {
+    apucBlock[i] = Pool_Alloc(pool);
+    CHECK(apucBlock[i] == pool->pucBase + i * pool->ulBlockSize);
+  }
+  CHECK(Pool_Alloc(pool) == NULL);
+  Pool_Free(pool, apucBlock[1]);
+  Pool_Free(pool, NULL);
+  CHECK(Pool_Alloc(pool) == apucBlock[1]);
+  CHECK(Pool_Alloc(pool) == NULL);
+  for (uint32_t i = 0; i < count; ++i) Pool_Free(pool, apucBlock[i]);
+  for (uint32_t i = 0; i < count; ++i) CHECK(Pool_Alloc(pool) != NULL);
+  CHECK(Pool_Alloc(pool) == NULL);
+  CHECK((RVSim_ReadCSR("mstatus") & MSTATUS_MIE) != 0);
+}
+
+int main(void)
+{
+  Pool_t xPool;
+  uint32_t ulFree;
+
+  RVSim_Reset();
+  RVSim_WriteCSR("mstatus", MSTATUS_MIE);
+  CHECK(Alloc_Init() == TEST_REGION);
+  prvTestLimits();
+
+  CHECK(Pool_Init(&xPool, 10, 3) == SUCCESS);
+  CHECK(xPool.ulBlockSize == POOL_BLOCK_SIZE(10));
+  prvTestPool(&xPool, 3);
+
+  ulFree = Alloc_GetFree();
+  CHECK(sizeof(xStaticPool_Storage) == 4U * POOL_BLOCK_SIZE(6));
+  prvTestPool(&xStaticPool, 4);
+  CHECK(Alloc_GetFree() == ulFree);
+  return TEST_RESULT();
+}
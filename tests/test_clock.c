@@ -0,0 +1,75 @@
+/*!****************************************************************************
+ * @file
+ * test_clock.c
+ *
+ * @brief
+ * Host Test: Fixed-Point Clock Conversions
+ *
+ * Compares Clock_Scale32()/Clock_Scale64() with the exact truncated product
+ * and checks the documented error bound: never below, at most
+ * ceil(value / 2^32) units above.
+ *
+ * @date  16.10.2026
+ ******************************************************************************/
+
+#include "host_device.h"
+#include "host_test.h"
+#include "core_riscv_clock.h"
+
+/* Random samples per factor                                                  */
+#define TEST_SAMPLES                  100000UL
+
+/*!****************************************************************************
+ * @brief
+ * Check conversions by to/from over random values of up to 2^44
+ *
+ * @param[in] to          Numerator of the factor
+ * @param[in] from        Denominator of the factor
+ * @return  (uint64_t)  Largest error in units
+ * @date  16.10.2026
+ ******************************************************************************/
+static uint64_t prvCheckFactor(uint64_t to, uint64_t from)
+{
+  uint32_t ulInt = CLOCK_FACTOR_INT(to, from);
+  uint32_t ulFrac = CLOCK_FACTOR_FRAC(to, from);
+  uint64_t ullSeed = to ^ from, ullMaxErr = 0;
+
+  for (uint32_t i = 0; i < TEST_SAMPLES; ++i)
+  {
+    uint64_t ullValue, ullExact, ullErr;
+
+    ullSeed = ullSeed * 6364136223846793005ULL + 1442695040888963407ULL;
+    ullValue = ullSeed >> (i % 40U + 20U);
+    if ((double)ullValue * (double)to / (double)from > 1.8e19) continue;
+
+    ullExact = (uint64_t)(((unsigned __int128)ullValue * to) / from);
+    ullErr = Clock_Scale64(ullValue, ulInt, ulFrac) - ullExact;
+    CHECK(Clock_Scale64(ullValue, ulInt, ulFrac) >= ullExact);
+    CHECK(ullErr <= ((ullValue + 0xFFFFFFFFULL) >> 32));
+    if (ullErr > ullMaxErr) ullMaxErr = ullErr;
+
+    if ((ullValue >> 32) == 0 && (ullExact >> 32) == 0)
+    {
+      uint32_t ulScaled = Clock_Scale32((uint32_t)ullValue, ulInt, ulFrac);
+      CHECK((ulScaled == ullExact) || (ulScaled == ullExact + 1U));
+    }
+  }
+  return ullMaxErr;
+}
+
+int main(void)
+{
+  static const uint64_t aullFactor[][2] = {
+    { 1000000000ULL, 6000000ULL }, { 1000000ULL, 6000000ULL }, { 6000000ULL, 1000000ULL },
+    { 6000000ULL, 1000000000ULL }, { 1000000000ULL, 48000000ULL }, { 1000000000ULL, 24000000ULL },
+  };
+
+  printf("%-12s %-12s %10s\n", "to", "from", "max error");
+  for (uint32_t i = 0; i < sizeof(aullFactor) / sizeof(aullFactor[0]); ++i)
+  {
+    printf("%-12llu %-12llu %10llu\n", (unsigned long long)aullFactor[i][0],
+           (unsigned long long)aullFactor[i][1],
+           (unsigned long long)prvCheckFactor(aullFactor[i][0], aullFactor[i][1]));
+  }
+  return TEST_RESULT();
+}
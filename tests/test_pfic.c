@@ -0,0 +1,275 @@
+/*!****************************************************************************
+ * @file
+ * test_pfic.c
+ *
+ * @brief
+ * Host Test: PFIC Register API on the Simulated Register File
+ *
+ * Checks the register state and the number of register accesses of the PFIC
+ * API (single and batch enable/pending, priorities, VTF). The access counts
+ * are the regression criterion: every read or write is a bus access on the
+ * target. The micro-benchmark prints accesses per call and host time per
+ * call.
+ *
+ * @date  16.10.2026
+ ******************************************************************************/
+
+#include "host_device.h"
+#include "host_test.h"
+
+/* Micro-benchmark iterations per API                                         */
+#define BENCH_ITERATIONS              1000000UL
+
+/*!****************************************************************************
+ * @brief
+ * Single enable/disable/pending: one write-1-to-set/clear access each
+ *
+ * @date  16.10.2026
+ ******************************************************************************/
+static void prvTestSingle(void)
+{
+  RVSim_Reset();
+
+  PFIC_EnableIRQ(USART1_IRQn);
+  PFIC_EnableIRQ(EXTI7_0_IRQn);
+  CHECK_ACCESS(0, 2);
+  CHECK(PFIC->ISR[0] == (1UL << 20));
+  CHECK(PFIC->ISR[1] == (1UL << 0));
+
+  RVSim_ResetCounters();
+  PFIC_DisableIRQ(USART1_IRQn);
+  CHECK_ACCESS(0, 1);
+  CHECK(PFIC->ISR[1] == 0);
+  CHECK(PFIC_GetStatusIRQ(EXTI7_0_IRQn) == 1);
+  CHECK(PFIC_GetStatusIRQ(USART1_IRQn) == 0);
+
+  RVSim_ResetCounters();
+  PFIC_SetPendingIRQ(TIM2_IRQn);
+  CHECK_ACCESS(0, 1);
+  CHECK(PFIC_GetPendingIRQ(TIM2_IRQn) == 1);
+  PFIC_ClearPendingIRQ(TIM2_IRQn);
+  CHECK(PFIC_GetPendingIRQ(TIM2_IRQn) == 0);
+}
+
+/*!****************************************************************************
+ * @brief
+ * Batch APIs: one access per non-empty register bank
+ *
+ * @date  16.10.2026
+ ******************************************************************************/
+static void prvTestBatch(void)
+{
+  PFIC_IRQSet_t xSet = { { 0 } };
+  PFIC_IRQSet_t xPending;
+
+  RVSim_Reset();
+  PFIC_EnableIRQMask(0, PFIC_IRQn_MASK(SysTicK_IRQn) | PFIC_IRQn_MASK(Software_IRQn));
+  CHECK_ACCESS(0, 1);
+  CHECK(PFIC_GetStatusIRQBank(0) == ((1UL << 12) | (1UL << 14)));
+  PFIC_DisableIRQMask(0, PFIC_IRQn_MASK(Software_IRQn));
+  CHECK(PFIC_GetStatusIRQBank(0) == (1UL << 12));
+
+  /* Set spanning both banks                                                  */
+  PFIC_IRQSetAdd(&xSet, EXTI7_0_IRQn);
+  PFIC_IRQSetAdd(&xSet, USART1_IRQn);
+  PFIC_IRQSetAdd(&xSet, TIM2_IRQn);
+  CHECK(xSet.ulMask[0] == (1UL << 20));
+  CHECK(xSet.ulMask[1] == ((1UL << 0) | (1UL << 6)));
+
+  RVSim_ResetCounters();
+  PFIC_EnableIRQSet(&xSet);
+  CHECK_ACCESS(0, 2);
+  CHECK(PFIC->ISR[0] == ((1UL << 12) | (1UL << 20)));
+  CHECK(PFIC->ISR[1] == ((1UL << 0) | (1UL << 6)));
+
+  RVSim_ResetCounters();
+  PFIC_DisableIRQSet(&xSet);
+  CHECK_ACCESS(0, 2);
+  CHECK(PFIC->ISR[0] == (1UL << 12));
+  CHECK(PFIC->ISR[1] == 0);
+
+  /* A set confined to one bank touches that bank only                        */
+  xSet.ulMask[0] = 0;
+  RVSim_ResetCounters();
+  PFIC_SetPendingIRQSet(&xSet);
+  CHECK_ACCESS(0, 1);
+  CHECK(PFIC->IPR[1] == ((1UL << 0) | (1UL << 6)));
+
+  RVSim_ResetCounters();
+  PFIC_GetPendingIRQSet(&xPending);
+  CHECK_ACCESS(PFIC_IRQSET_BANKS, 0);
+  CHECK(xPending.ulMask[0] == 0);
+  CHECK(xPending.ulMask[1] == xSet.ulMask[1]);
+
+  RVSim_ResetCounters();
+  PFIC_ClearPendingIRQSet(&xSet);
+  CHECK_ACCESS(0, 1);
+  CHECK(PFIC->IPR[1] == 0);
+}
+
+/*!****************************************************************************
+ * @brief
+ * Priorities: read-modify-write of one byte lane, implemented bits only
+ *
+ * @date  16.10.2026
+ ******************************************************************************/
+static void prvTestPriority(void)
+{
+  static const PFIC_Priority_t axTable[] = {
+    { SysTicK_IRQn, 0xC0 }, { Software_IRQn, 0x40 }, { TIM2_IRQn, 0x80 },
+  };
+  uint32_t aulWords[10] = { 0 };
+
+  RVSim_Reset();
+  PFIC_SetPriority(TIM2_IRQn, 0xFF);
+  CHECK_ACCESS(1, 1);
+  CHECK(PFIC->IPRIOR[9] == 0x00C00000UL);
+
+  PFIC_SetPriority(USART1_IRQn, 0x80);
+  PFIC_SetPriority(TIM2_IRQn, 0x40);
+  CHECK(PFIC->IPRIOR[8] == 0x00000080UL);
+  CHECK(PFIC->IPRIOR[9] == 0x00400000UL);
+
+  /* Subpriority-only and unimplemented bits read as zero                     */
+  PFIC_SetPriority(TIM2_IRQn, 0x3F);
+  CHECK(PFIC->IPRIOR[9] == 0);
+
+  /* Table: one write per word, no reads                                      */
+  PFIC_PackPriorityTable(axTable, 3, aulWords, 0, 10);
+  CHECK(aulWords[3] == PFIC_IPRIOR_WORD(0xC0, 0, 0x40, 0));
+  CHECK(aulWords[9] == PFIC_IPRIOR_WORD(0, 0, 0x80, 0));
+  RVSim_ResetCounters();
+  PFIC_SetPriorityTable(&aulWords[3], 3, 7);
+  CHECK_ACCESS(0, 7);
+  CHECK(PFIC_VerifyPriorityTable(&aulWords[3], 3, 7) == SUCCESS);
+  PFIC_SetPriority(Software_IRQn, 0x80);
+  CHECK(PFIC_VerifyPriorityTable(&aulWords[3], 3, 7) == ERROR);
+}
+
+/*!****************************************************************************
+ * @brief
+ * VTF: channel ID lane, handler address with enable bit
+ *
+ * @date  16.10.2026
+ ******************************************************************************/
+static void prvTestFastIRQ(void)
+{
+  RVSim_Reset();
+  PFIC_ConfigFastIRQ(1, 0x00001235UL, USART1_IRQn);
+  CHECK_ACCESS(1, 2);
+  CHECK(PFIC->VTFIDR == (32UL << 8));
+  CHECK(PFIC->VTFADDRR[1] == 0x00001234UL);
+
+  PFIC_ConfigFastIRQ(3, 0x00000800UL, TIM2_IRQn);
+  CHECK(PFIC->VTFIDR == ((32UL << 8) | (38UL << 24)));
+
+  RVSim_ResetCounters();
+  PFIC_EnableFastIRQ(1);
+  CHECK_ACCESS(1, 1);
+  CHECK(PFIC->VTFADDRR[1] == 0x00001235UL);
+  PFIC_DisableFastIRQ(1);
+  CHECK(PFIC->VTFADDRR[1] == 0x00001234UL);
+
+  /* Reconfiguring a channel replaces its ID only                             */
+  PFIC_ConfigFastIRQ(1, 0x00000400UL, EXTI7_0_IRQn);
+  CHECK(PFIC->VTFIDR == ((20UL << 8) | (38UL << 24)));
+}
+
+/*!****************************************************************************
+ * @brief
+ * Threshold: rounded up to implemented bits, only ever tightened
+ *
+ * @date  16.10.2026
+ ******************************************************************************/
+static void prvTestThreshold(void)
+{
+  uint8_t ucOuter, ucInner, ucNone;
+
+  RVSim_Reset();
+  CHECK(PFIC_THRESHOLD(0x00) == 0x00);
+  CHECK(PFIC_THRESHOLD(0x20) == 0x40);
+  CHECK(PFIC_THRESHOLD(0x3F) == 0x40);
+  CHECK(PFIC_THRESHOLD(0x80) == 0x80);
+  CHECK(PFIC_THRESHOLD(0xC0) == 0xC0);
+  CHECK(PFIC_THRESHOLD(0xC1) == 0x00);
+
+  /* Sub-threshold values mask instead of disabling the threshold             */
+  ucOuter = PFIC_RaiseThreshold(0x80);
+  CHECK(ucOuter == 0);
+  CHECK(PFIC_GetThreshold() == 0x80);
+  ucInner = PFIC_RaiseThreshold(0x3F);
+  CHECK(ucInner == 0x80);
+  CHECK(PFIC_GetThreshold() == 0x40);
+
+  /* Looser or inexpressible thresholds leave it unchanged                    */
+  ucNone = PFIC_RaiseThreshold(0x7F);
+  CHECK(PFIC_GetThreshold() == 0x40);
+  PFIC_RestoreThreshold(ucNone);
+  ucNone = PFIC_RaiseThreshold(0);
+  CHECK(PFIC_GetThreshold() == 0x40);
+  PFIC_RestoreThreshold(ucNone);
+  ucNone = PFIC_RaiseThreshold(0xE0);
+  CHECK(PFIC_GetThreshold() == 0x40);
+  PFIC_RestoreThreshold(ucNone);
+
+  PFIC_RestoreThreshold(ucInner);
+  CHECK(PFIC_GetThreshold() == 0x80);
+  PFIC_RestoreThreshold(ucOuter);
+  CHECK(PFIC_GetThreshold() == 0);
+  CHECK((RVSim_ReadCSR("mstatus") & MSTATUS_MIE) == 0);
+}
+
+/* Micro-benchmark cases                                                      */
+static PFIC_IRQSet_t xBenchSet = { { (1UL << 20), (1UL << 0) | (1UL << 6) } };
+static uint32_t aulBenchWords[3] = { 0xC0004000UL, 0x00800000UL, 0x40404040UL };
+
+static void prvBenchEnable(uint32_t i)    { PFIC_EnableIRQ((IRQn_Type)(i & 63U)); }
+static void prvBenchSetPrio(uint32_t i)   { PFIC_SetPriority((IRQn_Type)(i & 63U), (uint8_t)i); }
+static void prvBenchPrioTab(uint32_t i)   { PFIC_SetPriorityTable(aulBenchWords, i & 7U, 3); }
+static void prvBenchEnableSet(uint32_t i) { (void)i; PFIC_EnableIRQSet(&xBenchSet); }
+static void prvBenchConfigVtf(uint32_t i) { PFIC_ConfigFastIRQ((uint8_t)i, i << 2, (IRQn_Type)(i & 63U)); }
+
+/*!****************************************************************************
+ * @brief
+ * Print register accesses and host time per call
+ *
+ * @date  16.10.2026
+ ******************************************************************************/
+static void prvBenchmark(void)
+{
+  static const struct {
+    const char* pcName;
+    void (*pfnCall)(uint32_t);
+  } axBench[] = {
+    { "PFIC_EnableIRQ",        prvBenchEnable    },
+    { "PFIC_SetPriority",      prvBenchSetPrio   },
+    { "PFIC_SetPriorityTable", prvBenchPrioTab   },
+    { "PFIC_EnableIRQSet",     prvBenchEnableSet },
+    { "PFIC_ConfigFastIRQ",    prvBenchConfigVtf },
+  };
+
+  printf("%-24s %8s %8s %10s\n", "call", "reads", "writes", "host ns");
+  for (uint32_t b = 0; b < sizeof(axBench) / sizeof(axBench[0]); ++b)
+  {
+    double dStart;
+
+    RVSim_Reset();
+    dStart = Test_Now();
+    for (uint32_t i = 0; i < BENCH_ITERATIONS; ++i) axBench[b].pfnCall(i);
+    printf("%-24s %8.2f %8.2f %10.2f\n", axBench[b].pcName,
+           (double)RVSim_State.ulReads / BENCH_ITERATIONS,
+           (double)RVSim_State.ulWrites / BENCH_ITERATIONS,
+           (Test_Now() - dStart) / BENCH_ITERATIONS);
+  }
+}
+
+int main(void)
+{
+  prvTestSingle();
+  prvTestBatch();
+  prvTestPriority();
+  prvTestFastIRQ();
+  prvTestThreshold();
+  prvBenchmark();
+  return TEST_RESULT();
+}
@@ -0,0 +1,175 @@
+/*!****************************************************************************
+ * @file
+ * test_ring.c
+ *
+ * @brief
+ * Host Test: Lock-Free Byte Ring Buffers
+ *
+ *  - SPSC stress: a producer thread alternates Ring_Push() and 7-byte
+ *    Ring_Write() blocks through a 64-byte ring while the main thread
+ *    consumes with Ring_ReadSpan()/Ring_Release() and checks the sequence.
+ *    The ring relies on ordered stores as on the in-order target, which a
+ *    strongly ordered host (x86) provides; on weakly ordered hosts the
+ *    stress part is skipped.
+ *  - MPSC: wrap-around of Ring_MpscWrite(), Ring_MpscPush() up to full, byte
+ *    order across the wrap, no publication while a reservation is pending
+ *    and interrupts re-enabled after each call.
+ *
+ * @date  16.10.2026
+ ******************************************************************************/
+
+#include "host_device.h"
+#include "host_test.h"
+#include "core_riscv_ring.h"
+#include <pthread.h>
+#include <sched.h>
+
+/* Bytes transferred by the SPSC stress test                                  */
+#define TEST_BYTES                    200000UL
+
+/* Block length of Ring_Write() in the SPSC stress test                       */
+#define TEST_BLOCK                    7UL
+
+static uint8_t aucBuf[64];
+static Ring_t xRing;
+
+/*!****************************************************************************
+ * @brief
+ * SPSC producer thread
+ *
+ * @param[in] arg         Unused
+ * @return  (void*)  NULL
+ * @date  16.10.2026
+ ******************************************************************************/
+static void* prvProducer(void* arg)
+{
+  uint8_t aucBlock[TEST_BLOCK];
+  uint32_t i = 0;
+
+  (void)arg;
+  while (i < TEST_BYTES)
+  {
+    if ((i & 1UL) != 0)
+    {
+      uint32_t ulLen = (TEST_BYTES - i < TEST_BLOCK) ? (TEST_BYTES - i) : TEST_BLOCK;
+      uint32_t ulDone;
+
+      for (uint32_t k = 0; k < ulLen; ++k) aucBlock[k] = (uint8_t)(i + k);
+      ulDone = Ring_Write(&xRing, aucBlock, ulLen);
+      i += ulDone;
+      if (ulDone == 0) sched_yield();
+    }
+    else if (Ring_Push(&xRing, (uint8_t)i) == SUCCESS)
+    {
+      i++;
+    }
+    else
+    {
+      sched_yield();
+    }
+  }
+  return NULL;
+}
+
+/*!****************************************************************************
+ * @brief
+ * SPSC stress test with concurrent producer and consumer
+ *
+ * @date  16.10.2026
+ ******************************************************************************/
+static void prvTestSpsc(void)
+{
+#if defined(__x86_64__) || defined(__i386__)
+  pthread_t xThread;
+  uint32_t i = 0, ulErrors = 0;
+  double dStart;
+
+  CHECK(Ring_Init(&xRing, aucBuf, sizeof(aucBuf)) == SUCCESS);
+  dStart = Test_Now();
+  CHECK(pthread_create(&xThread, NULL, prvProducer, NULL) == 0);
+  while (i < TEST_BYTES)
+  {
+    const uint8_t* pucSpan;
+    uint32_t ulLen = Ring_ReadSpan(&xRing, &pucSpan);
+
+    CHECK(ulLen <= sizeof(aucBuf));
+    for (uint32_t k = 0; k < ulLen; ++k)
+    {
+      if (pucSpan[k] != (uint8_t)(i + k)) ulErrors++;
+    }
+    Ring_Release(&xRing, ulLen);
+    i += ulLen;
+    if (ulLen == 0) sched_yield();
+  }
+  pthread_join(xThread, NULL);
+  CHECK(ulErrors == 0);
+  CHECK(i == TEST_BYTES);
+  CHECK(Ring_Count(&xRing) == 0);
+  printf("SPSC stress: %lu bytes, %.1f ns/byte (host)\n", TEST_BYTES,
+         (Test_Now() - dStart) / TEST_BYTES);
+#else
+  printf("SPSC stress: skipped (weakly ordered host)\n");
+#endif /* __x86_64__ || __i386__ */
+}
+
+/*!****************************************************************************
+ * @brief
+ * MPSC wrap-around, full and publication checks
+ *
+ * @date  16.10.2026
+ ******************************************************************************/
+static void prvTestMpsc(void)
+{
+  static const uint8_t aucSrc[10] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+  uint8_t aucDst[20];
+
+  /* 10 in, 5 out, 10 in across the end of the 16-byte buffer, 1 to fill   */
+  CHECK(Ring_Init(&xRing, aucBuf, 16) == SUCCESS);
+  CHECK(Ring_MpscWrite(&xRing, aucSrc, 10) == 10);
+  CHECK(Ring_Read(&xRing, aucDst, 5) == 5);
+  CHECK(aucDst[0] == 0 && aucDst[4] == 4);
+  CHECK(Ring_MpscWrite(&xRing, aucSrc, 10) == 10);
+  CHECK(Ring_MpscPush(&xRing, 99) == SUCCESS);
+  CHECK(Ring_Count(&xRing) == 16);
+  CHECK(Ring_MpscPush(&xRing, 1) == ERROR);
+  CHECK(Ring_MpscWrite(&xRing, aucSrc, 10) == 0);
+  CHECK((RVSim_ReadCSR("mstatus") & MSTATUS_MIE) != 0);
+
+  CHECK(Ring_Read(&xRing, aucDst, sizeof(aucDst)) == 16);
+  for (uint32_t k = 0; k < 5; ++k) CHECK(aucDst[k] == 5 + k);
+  for (uint32_t k = 0; k < 10; ++k) CHECK(aucDst[5 + k] == k);
+  CHECK(aucDst[15] == 99);
+
+  /* Truncated write: only the free space is reserved and published         */
+  CHECK(Ring_MpscWrite(&xRing, aucSrc, 10) == 10);
+  CHECK(Ring_MpscWrite(&xRing, aucSrc, 10) == 6);
+  CHECK(Ring_Count(&xRing) == 16);
+  CHECK(Ring_Read(&xRing, aucDst, sizeof(aucDst)) == 16);
+  CHECK(aucDst[10] == 0 && aucDst[15] == 5);
+
+  /* Interrupted producer: a push is stored but not published until the     */
+  /* pending reservation completes                                          */
+  CHECK(Ring_Init(&xRing, aucBuf, 16) == SUCCESS);
+  xRing.ulWriters = 1;
+  xRing.ulReserve = 3;
+  CHECK(Ring_MpscPush(&xRing, 7) == SUCCESS);
+  CHECK(Ring_Count(&xRing) == 0);
+  CHECK(xRing.ulReserve == 4);
+  CHECK(aucBuf[3] == 7);
+  CHECK(Ring_MpscWrite(&xRing, aucSrc, 2) == 2);
+  CHECK(Ring_Count(&xRing) == 0);
+  xRing.ulWriters = 0;
+  CHECK(Ring_MpscPush(&xRing, 8) == SUCCESS);
+  CHECK(Ring_Count(&xRing) == 7);
+  CHECK((RVSim_ReadCSR("mstatus") & MSTATUS_MIE) != 0);
+}
+
+int main(void)
+{
+  RVSim_Reset();
+  RVSim_WriteCSR("mstatus", MSTATUS_MIE);
+  CHECK(Ring_Init(&xRing, aucBuf, 12) == ERROR);
+  prvTestSpsc();
+  prvTestMpsc();
+  return TEST_RESULT();
+}
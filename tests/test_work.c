@@ -0,0 +1,114 @@
+/*!****************************************************************************
+ * @file
+ * test_work.c
+ *
+ * @brief
+ * Host Test: Deferred Interrupt Work Queue
+ *
+ * Checks FIFO order and coalescing, priority order and cancellation from the
+ * live queue and from the batch being drained (an item cancelled by an
+ * earlier item of the same batch must not run).
+ *
+ * @date  16.10.2026
+ ******************************************************************************/
+
+#include "host_device.h"
+#include "host_test.h"
+#include "core_riscv_work.h"
+
+static Work_t axWork[3];
+static Work_t xLow;
+static char acOrder[8];
+static uint32_t ulRuns;
+static ErrorStatus eCancelRunning, eCancelBatch;
+
+/*!****************************************************************************
+ * @brief
+ * Record item letter in run order
+ *
+ * @param[in] work        Work item
+ * @param[in] arg         Letter
+ * @date  16.10.2026
+ ******************************************************************************/
+static void prvRecord(Work_t* work, void* arg)
+{
+  (void)work;
+  if (ulRuns < sizeof(acOrder) - 1U) acOrder[ulRuns++] = (char)(uintptr_t)arg;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Record, then cancel itself and the next item of the batch
+ *
+ * @param[in] work        Work item
+ * @param[in] arg         Letter
+ * @date  16.10.2026
+ ******************************************************************************/
+static void prvCancelNext(Work_t* work, void* arg)
+{
+  prvRecord(work, arg);
+  eCancelRunning = Work_Cancel(work);
+  eCancelBatch = Work_Cancel(&axWork[1]);
+}
+
+/*!****************************************************************************
+ * @brief
+ * Reset run log
+ *
+ * @date  16.10.2026
+ ******************************************************************************/
+static void prvReset(void)
+{
+  ulRuns = 0;
+  for (uint32_t i = 0; i < sizeof(acOrder); ++i) acOrder[i] = 0;
+}
+
+int main(void)
+{
+  Work_t xInit = WORK_INIT(prvRecord, (void*)'x', 1);
+
+  RVSim_Reset();
+  RVSim_WriteCSR("mstatus", MSTATUS_MIE);
+  Work_Init(0xC0);
+  CHECK(xInit.ucPrio == 1);
+  Work_Setup(&axWork[0], prvRecord, (void*)'a', 0);
+  Work_Setup(&axWork[1], prvRecord, (void*)'b', 0);
+  Work_Setup(&axWork[2], prvRecord, (void*)'c', 0);
+  Work_Setup(&xLow, prvRecord, (void*)'l', 1);
+
+  /* FIFO per level, high level first, coalescing                           */
+  prvReset();
+  CHECK(Work_Post(&xLow) == SUCCESS);
+  CHECK(Work_Post(&axWork[0]) == SUCCESS);
+  CHECK(Work_Post(&axWork[1]) == SUCCESS);
+  CHECK(Work_Post(&axWork[0]) == ERROR);
+  CHECK(PFIC_GetPendingIRQ(WORK_IRQn) != 0);
+  Work_Handler();
+  CHECK(acOrder[0] == 'a' && acOrder[1] == 'b' && acOrder[2] == 'l' && ulRuns == 3);
+
+  /* Cancel from the live queue                                             */
+  prvReset();
+  CHECK(Work_Post(&axWork[0]) == SUCCESS);
+  CHECK(Work_Post(&axWork[1]) == SUCCESS);
+  CHECK(Work_Post(&axWork[2]) == SUCCESS);
+  CHECK(Work_Cancel(&axWork[1]) == SUCCESS);
+  CHECK(Work_Cancel(&axWork[1]) == ERROR);
+  CHECK(Work_Cancel(&axWork[2]) == SUCCESS);
+  CHECK(Work_Post(&axWork[2]) == SUCCESS);
+  Work_Handler();
+  CHECK(acOrder[0] == 'a' && acOrder[1] == 'c' && ulRuns == 2);
+
+  /* Cancel from the batch being drained                                    */
+  prvReset();
+  axWork[0].pfnFunc = prvCancelNext;
+  CHECK(Work_Post(&axWork[0]) == SUCCESS);
+  CHECK(Work_Post(&axWork[1]) == SUCCESS);
+  CHECK(Work_Post(&axWork[2]) == SUCCESS);
+  Work_Handler();
+  CHECK(eCancelRunning == ERROR);
+  CHECK(eCancelBatch == SUCCESS);
+  CHECK(acOrder[0] == 'a' && acOrder[1] == 'c' && ulRuns == 2);
+  CHECK(axWork[1].ucQueued == 0);
+  CHECK((RVSim_ReadCSR("mstatus") & MSTATUS_MIE) != 0);
+  return TEST_RESULT();
+}
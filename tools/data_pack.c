@@ -0,0 +1,444 @@
+/*!****************************************************************************
+ * @file
+ * data_pack.c
+ *
+ * @brief
+ * Host tool: Packed .data Initialiser Image for the Startup Code
+ *
+ * Usage: data_pack [-w waitstates] <data.bin> <packed.bin>
+ *
+ * Exits with status 3 if the packed image is not smaller than the plain one
+ * (the output is still written); link the plain .data copy instead.
+ *
+ * Compresses the .data initialiser image for startup_riscv.s assembled with
+ * USE_DATA_PACKED. The image is a sequence of byte tokens:
+ *  - 0x00          end of image
+ *  - 0x01..0x7F    n literal bytes follow
+ *  - 0x80..0x9F    (n & 0x1F) + 1 zero bytes
+ *  - 0xA0..0xBF    (n & 0x1F) + 1 zero words, at a word aligned output
+ *                  offset (.data starts word aligned)
+ *  - 0xC0..0xFF    (n & 0x3F) + 3 bytes copied from 16-bit little-endian
+ *                  offset back in the unpacked output
+ *
+ * Zero runs of at least one word are emitted as word runs, preceded by a
+ * byte run up to the next word boundary, so they unpack with one store per
+ * word.
+ *
+ * Build flow (two links, code addresses do not change between them):
+ *  1. Link normally, extract the image:
+ *       objcopy -O binary -j .data fw.elf data.bin
+ *  2. Pack and convert to an object:
+ *       data_pack data.bin data.lz
+ *       objcopy -I binary -O elf32-littleriscv \
+ *         --rename-section .data=.data_packed,alloc,load,readonly data.lz dp.o
+ *  3. Link again with dp.o, the linker script placing .data as NOLOAD in RAM
+ *     and *(.data_packed) in flash at _sidata.
+ *
+ * The size and startup cost of plain copy and unpacking are reported, the
+ * latter from the instruction counts of both startup loops. Cycle estimates
+ * add the given number of wait states per flash data load. The unpacker
+ * copies literals word-wise where source and destination are both word
+ * aligned, assuming the packed image starts word aligned (.data_packed in
+ * tests/target/link.ld), and fills offset-1 matches (byte runs) word-wise.
+ *
+ * Build: cc -O2 -o data_pack data_pack.c
+ *
+ * @date  16.10.2026
+ ******************************************************************************/
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* Token format                                                               */
+#define TOK_END                       0x00U
+#define TOK_LITERAL_MAX               0x7FU
+#define TOK_ZERO                      0x80U
+#define TOK_ZERO_WORDS                0xA0U
+#define TOK_MATCH                     0xC0U
+#define TOK_LEN_MASK                  0x3FU
+#define TOK_ZERO_MASK                 0x1FU
+#define ZERO_MIN                      2U
+#define ZERO_WORDS_MAX                (TOK_ZERO_MASK + 1U)
+#define MATCH_MIN                     4U
+#define MATCH_MAX                     (TOK_LEN_MASK + 3U)
+#define MATCH_WINDOW                  0xFFFFU
+
+/* Match finder: hash of the next three bytes, chain depth limit              */
+#define HASH_BITS                     12U
+#define HASH_SIZE                     (1U << HASH_BITS)
+#define CHAIN_DEPTH                   256U
+
+/* Startup loop instruction counts (see startup_riscv.s)                      */
+#define COST_TOKEN                    5U    /* Fetch and classify token       */
+#define COST_LITERAL(n)               (6U + 5U * (n))  /* Unaligned, bytes   */
+#define COST_LITERAL_SHORT(n)         (8U + 5U * (n))  /* Aligned, n < 4     */
+#define COST_LITERAL_WORDS(w, r)      (((r) != 0) ? (9U + 5U * ((w) + (r))) : (8U + 5U * (w)))
+#define COST_ZERO(n)                  (8U + 3U * (n))
+#define COST_ZERO_WORDS(n)            (9U + 3U * (n))
+#define COST_MATCH(n)                 (13U + 5U * (n))
+#define COST_FILL_SHORT(n)            (19U + 5U * (n)) /* Before a boundary  */
+#define COST_FILL(h, w, t)            (22U + 5U * (h) + 3U * (w) + 4U * (t))
+#define COST_END                      1U
+
+/* Unpack statistics                                                          */
+typedef struct {
+  uint64_t ullInstr;
+  uint64_t ullFlashLoads;
+  uint32_t ulTokens[4];       /*!< Literal, zero byte, zero word, match       */
+} Cost_t;
+
+/*!****************************************************************************
+ * @brief
+ * Read whole file into memory
+ *
+ * @param[in] path        File path
+ * @param[out] size       File size
+ * @return  (uint8_t*)  File contents, NULL on error
+ * @date  16.10.2026
+ ******************************************************************************/
+static uint8_t* prvReadFile(const char* path, size_t* size)
+{
+  FILE* f = fopen(path, "rb");
+  uint8_t* pucData;
+  long lSize;
+
+  if (f == NULL) return NULL;
+  fseek(f, 0, SEEK_END);
+  lSize = ftell(f);
+  fseek(f, 0, SEEK_SET);
+  pucData = malloc((lSize > 0) ? (size_t)lSize : 1U);
+  if ((pucData != NULL) && (lSize > 0) && (fread(pucData, 1, (size_t)lSize, f) != (size_t)lSize))
+  {
+    free(pucData);
+    pucData = NULL;
+  }
+  fclose(f);
+  *size = (lSize > 0) ? (size_t)lSize : 0U;
+  return pucData;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Hash of three bytes
+ *
+ * @param[in] p           Source bytes
+ * @return  (uint32_t)  Hash value
+ * @date  16.10.2026
+ ******************************************************************************/
+static uint32_t prvHash(const uint8_t* p)
+{
+  return (uint32_t)((((uint32_t)p[0] << 16) | ((uint32_t)p[1] << 8) | p[2]) * 2654435761U) >> (32U - HASH_BITS);
+}
+
+/*!****************************************************************************
+ * @brief
+ * Flush pending literal bytes
+ *
+ * @param[in] src         Literal bytes
+ * @param[in] len         Number of literal bytes
+ * @param[out] dst        Output buffer
+ * @return  (size_t)  Number of bytes written
+ * @date  16.10.2026
+ ******************************************************************************/
+static size_t prvFlushLiterals(const uint8_t* src, size_t len, uint8_t* dst)
+{
+  size_t xOut = 0;
+
+  while (len > 0)
+  {
+    size_t xRun = (len > TOK_LITERAL_MAX) ? TOK_LITERAL_MAX : len;
+    dst[xOut++] = (uint8_t)xRun;
+    memcpy(&dst[xOut], src, xRun);
+    xOut += xRun;
+    src += xRun;
+    len -= xRun;
+  }
+  return xOut;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Pack image (greedy parse: zero runs, then longest match, else literal)
+ *
+ * Zero runs at a word aligned offset are emitted in words. An unaligned zero
+ * run reaching at least one word past the next boundary is split there, so
+ * its remainder is emitted in words.
+ *
+ * @param[in] src         Unpacked image
+ * @param[in] len         Image size
+ * @param[out] dst        Output buffer (at least len + len / 127 + 2 bytes)
+ * @return  (size_t)  Packed size, including end token
+ * @date  16.10.2026
+ ******************************************************************************/
+static size_t prvPack(const uint8_t* src, size_t len, uint8_t* dst)
+{
+  int32_t* plHead = malloc(HASH_SIZE * sizeof(int32_t));
+  int32_t* plPrev = malloc((len + 1U) * sizeof(int32_t));
+  size_t xOut = 0, xLit = 0, i = 0;
+
+  for (uint32_t h = 0; h < HASH_SIZE; ++h) plHead[h] = -1;
+
+  while (i < len)
+  {
+    size_t xZero = 0, xBestLen = 0, xBestOfs = 0, xAdvance;
+    size_t xAlign = (4U - (i & 3U)) & 3U;
+
+    while ((i + xZero < len) && (src[i + xZero] == 0) && (xZero < 4U * ZERO_WORDS_MAX)) xZero++;
+
+    /* Word runs at aligned offsets, byte runs up to the next boundary      */
+    if ((xAlign == 0) && (xZero >= 4U))
+    {
+      xZero &= ~(size_t)3U;
+    }
+    else if ((xAlign != 0) && (xZero >= xAlign + 4U))
+    {
+      xZero = xAlign;
+    }
+    else if (xZero < ZERO_MIN)
+    {
+      xZero = 0;
+    }
+
+    if ((xZero == 0) && (i + 3U <= len))
+    {
+      int32_t lCand = plHead[prvHash(&src[i])];
+      for (uint32_t d = 0; (lCand >= 0) && (d < CHAIN_DEPTH) && (i - (size_t)lCand <= MATCH_WINDOW); ++d)
+      {
+        size_t xLen = 0;
+        while ((i + xLen < len) && (xLen < MATCH_MAX) && (src[(size_t)lCand + xLen] == src[i + xLen])) xLen++;
+        if (xLen > xBestLen)
+        {
+          xBestLen = xLen;
+          xBestOfs = i - (size_t)lCand;
+        }
+        lCand = plPrev[lCand];
+      }
+    }
+
+    if ((xAlign == 0) && (xZero >= 4U))
+    {
+      xOut += prvFlushLiterals(&src[i - xLit], xLit, &dst[xOut]);
+      xLit = 0;
+      dst[xOut++] = (uint8_t)(TOK_ZERO_WORDS | (xZero / 4U - 1U));
+      xAdvance = xZero;
+    }
+    else if (xZero != 0)
+    {
+      xOut += prvFlushLiterals(&src[i - xLit], xLit, &dst[xOut]);
+      xLit = 0;
+      dst[xOut++] = (uint8_t)(TOK_ZERO | (xZero - 1U));
+      xAdvance = xZero;
+    }
+    else if (xBestLen >= MATCH_MIN)
+    {
+      xOut += prvFlushLiterals(&src[i - xLit], xLit, &dst[xOut]);
+      xLit = 0;
+      dst[xOut++] = (uint8_t)(TOK_MATCH | (xBestLen - 3U));
+      dst[xOut++] = (uint8_t)xBestOfs;
+      dst[xOut++] = (uint8_t)(xBestOfs >> 8);
+      xAdvance = xBestLen;
+    }
+    else
+    {
+      xLit++;
+      xAdvance = 1;
+    }
+
+    /* Insert skipped positions into the match finder                       */
+    for (size_t j = 0; j < xAdvance; ++j, ++i)
+    {
+      if (i + 3U <= len)
+      {
+        uint32_t h = prvHash(&src[i]);
+        plPrev[i] = plHead[h];
+        plHead[h] = (int32_t)i;
+      }
+    }
+  }
+  xOut += prvFlushLiterals(&src[i - xLit], xLit, &dst[xOut]);
+  dst[xOut++] = TOK_END;
+
+  free(plHead);
+  free(plPrev);
+  return xOut;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Unpack image as the startup code does, accounting its cost
+ *
+ * @param[in] src         Packed image
+ * @param[in] srclen      Packed size
+ * @param[out] dst        Output buffer
+ * @param[in] dstlen      Output buffer size
+ * @param[out] cost       Unpack statistics
+ * @return  (long)  Unpacked size, -1 on malformed image
+ * @date  16.10.2026
+ ******************************************************************************/
+static long prvUnpack(const uint8_t* src, size_t srclen, uint8_t* dst, size_t dstlen, Cost_t* cost)
+{
+  size_t xIn = 0, xOut = 0;
+
+  memset(cost, 0, sizeof(*cost));
+  for (;;)
+  {
+    uint32_t ulTok, ulLen, ulOfs;
+
+    if (xIn >= srclen) return -1;
+    ulTok = src[xIn++];
+    cost->ullInstr += COST_TOKEN;
+    cost->ullFlashLoads++;
+
+    if (ulTok == TOK_END)
+    {
+      cost->ullInstr += COST_END;
+      return (long)xOut;
+    }
+    if (ulTok <= TOK_LITERAL_MAX)
+    {
+      if ((xIn + ulTok > srclen) || (xOut + ulTok > dstlen)) return -1;
+      memcpy(&dst[xOut], &src[xIn], ulTok);
+      if (((xIn | xOut) & 3U) != 0)
+      {
+        cost->ullInstr += COST_LITERAL(ulTok);
+        cost->ullFlashLoads += ulTok;
+      }
+      else if (ulTok < 4U)
+      {
+        cost->ullInstr += COST_LITERAL_SHORT(ulTok);
+        cost->ullFlashLoads += ulTok;
+      }
+      else
+      {
+        cost->ullInstr += COST_LITERAL_WORDS(ulTok / 4U, ulTok % 4U);
+        cost->ullFlashLoads += ulTok / 4U + ulTok % 4U;
+      }
+      xIn += ulTok;
+      xOut += ulTok;
+      cost->ulTokens[0]++;
+    }
+    else if (ulTok < TOK_ZERO_WORDS)
+    {
+      ulLen = (ulTok & TOK_ZERO_MASK) + 1U;
+      if (xOut + ulLen > dstlen) return -1;
+      memset(&dst[xOut], 0, ulLen);
+      xOut += ulLen;
+      cost->ullInstr += COST_ZERO(ulLen);
+      cost->ulTokens[1]++;
+    }
+    else if (ulTok < TOK_MATCH)
+    {
+      ulLen = (ulTok & TOK_ZERO_MASK) + 1U;
+      if (((xOut & 3U) != 0) || (xOut + 4U * ulLen > dstlen)) return -1;
+      memset(&dst[xOut], 0, 4U * ulLen);
+      xOut += 4U * ulLen;
+      cost->ullInstr += COST_ZERO_WORDS(ulLen);
+      cost->ulTokens[2]++;
+    }
+    else
+    {
+      ulLen = (ulTok & TOK_LEN_MASK) + 3U;
+      if (xIn + 2U > srclen) return -1;
+      ulOfs = src[xIn] | ((uint32_t)src[xIn + 1] << 8);
+      xIn += 2;
+      if ((ulOfs == 0) || (ulOfs > xOut) || (xOut + ulLen > dstlen)) return -1;
+      if (ulOfs != 1U)
+      {
+        cost->ullInstr += COST_MATCH(ulLen);
+      }
+      else
+      {
+        uint32_t ulHead = (4U - (uint32_t)(xOut & 3U)) & 3U;
+
+        if ((ulHead != 0) && (ulLen <= ulHead))
+        {
+          cost->ullInstr += COST_FILL_SHORT(ulLen);
+        }
+        else
+        {
+          cost->ullInstr += COST_FILL(ulHead, (ulLen - ulHead) / 4U, (ulLen - ulHead) % 4U);
+        }
+      }
+      for (uint32_t j = 0; j < ulLen; ++j, ++xOut) dst[xOut] = dst[xOut - ulOfs];
+      cost->ullFlashLoads += 2U;
+      cost->ulTokens[3]++;
+    }
+  }
+}
+
+int main(int argc, char** argv)
+{
+  uint32_t ulWait = 0;
+  uint8_t *pucData, *pucPacked, *pucCheck;
+  size_t xSize, xPacked;
+  uint64_t ullCopyInstr, ullCopyLoads;
+  int iArg = 1;
+  Cost_t xCost;
+  FILE* f;
+
+  if ((argc > 2) && (strcmp(argv[1], "-w") == 0))
+  {
+    ulWait = (uint32_t)strtoul(argv[2], NULL, 0);
+    iArg = 3;
+  }
+  if (argc - iArg != 2)
+  {
+    fprintf(stderr, "usage: %s [-w waitstates] <data.bin> <packed.bin>\n", argv[0]);
+    return 2;
+  }
+
+  pucData = prvReadFile(argv[iArg], &xSize);
+  if (pucData == NULL)
+  {
+    fprintf(stderr, "%s: cannot read\n", argv[iArg]);
+    return 1;
+  }
+
+  pucPacked = malloc(xSize + xSize / TOK_LITERAL_MAX + 2U);
+  pucCheck = malloc(xSize + 1U);
+  xPacked = prvPack(pucData, xSize, pucPacked);
+
+  /* Verify round trip with the startup decoder semantics                   */
+  if ((prvUnpack(pucPacked, xPacked, pucCheck, xSize, &xCost) != (long)xSize) ||
+      (memcmp(pucCheck, pucData, xSize) != 0))
+  {
+    fprintf(stderr, "internal error: round trip mismatch\n");
+    return 1;
+  }
+
+  f = fopen(argv[iArg + 1], "wb");
+  if ((f == NULL) || (fwrite(pucPacked, 1, xPacked, f) != xPacked))
+  {
+    fprintf(stderr, "%s: cannot write\n", argv[iArg + 1]);
+    return 1;
+  }
+  fclose(f);
+
+  /* Plain copy: 16-byte blocks, then words, then bytes (see startup)       */
+  ullCopyInstr = 2U + 11U * (xSize / 16U) + 6U * ((xSize % 16U) / 4U) + 6U * (xSize % 4U) + 3U;
+  ullCopyLoads = xSize / 4U + xSize % 4U;
+
+  printf("image     %8zu bytes\n", xSize);
+  printf("packed    %8zu bytes (%.1f %%), saves %ld bytes of flash\n", xPacked,
+         (xSize != 0) ? (100.0 * (double)xPacked / (double)xSize) : 0.0, (long)xSize - (long)xPacked);
+  printf("tokens    %u literal, %u zero byte run, %u zero word run, %u match\n", xCost.ulTokens[0],
+         xCost.ulTokens[1], xCost.ulTokens[2], xCost.ulTokens[3]);
+  printf("\n%-8s %12s %12s %12s\n", "startup", "instr", "flash loads", "cycles*");
+  printf("%-8s %12llu %12llu %12llu\n", "copy", (unsigned long long)ullCopyInstr,
+         (unsigned long long)ullCopyLoads, (unsigned long long)(ullCopyInstr + ullCopyLoads * ulWait));
+  printf("%-8s %12llu %12llu %12llu\n", "unpack", (unsigned long long)xCost.ullInstr,
+         (unsigned long long)xCost.ullFlashLoads, (unsigned long long)(xCost.ullInstr + xCost.ullFlashLoads * ulWait));
+  printf("* one cycle per instruction plus %u wait states per flash data load\n", ulWait);
+
+  free(pucData);
+  free(pucPacked);
+  free(pucCheck);
+  if (xPacked >= xSize)
+  {
+    fprintf(stderr, "warning: packed image saves no flash, use the plain .data copy\n");
+    return 3;
+  }
+  return 0;
+}
@@ -0,0 +1,259 @@
+/*!****************************************************************************
+ * @file
+ * irq_trace_decode.c
+ *
+ * @brief
+ * Host tool: Interrupt Latency and Jitter Report from an IrqTrace_Data Dump
+ *
+ * Usage: irq_trace_decode <dump.bin> [-v]
+ *
+ * The dump is the raw contents of IrqTrace_Data (see core_riscv_trace.h),
+ * e.g. saved with "dump binary memory dump.bin &IrqTrace_Data
+ * (&IrqTrace_Data)+1" in gdb. Records are grouped by IRQn and interrupt entry
+ * mode; per group, entry latency (pend to entry), handler duration (entry to
+ * exit) and inter-arrival jitter are reported as min/mean/max/stddev with a
+ * histogram. With -v, all records are listed in order.
+ *
+ * Build: cc -O2 -o irq_trace_decode irq_trace_decode.c -lm
+ *
+ * @date  16.10.2026
+ ******************************************************************************/
+
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* Dump layout (little endian), see IrqTrace_Data_t                           */
+#define IRQTRACE_MAGIC                0x54515249UL
+#define IRQTRACE_VERSION              1U
+#define IRQTRACE_HEADER_SIZE          16U
+#define IRQTRACE_RECORD_SIZE          16U
+#define IRQTRACE_FLAG_VALID           0x01U
+#define IRQTRACE_FLAG_PEND            0x02U
+
+/* Report settings                                                            */
+#define HIST_BINS                     8U
+#define HIST_WIDTH                    40U
+#define MAX_GROUPS                    64U
+
+/* Sample statistics                                                          */
+typedef struct {
+  uint32_t ulCount;
+  uint32_t ulMin;
+  uint32_t ulMax;
+  double dSum;
+  double dSumSq;
+  uint32_t* pulSamples;
+} Stat_t;
+
+/* Records of one (IRQn, mode) combination                                    */
+typedef struct {
+  uint8_t ucIRQn;
+  uint8_t ucMode;
+  uint8_t ucMaxDepth;
+  uint32_t ulLastEntry;
+  Stat_t xLatency;
+  Stat_t xDuration;
+  Stat_t xPeriod;
+} Group_t;
+
+static const char* const apcModes[] = { "standard", "fast", "naked" };
+
+/*!****************************************************************************
+ * @brief
+ * Read little-endian 32-bit word
+ *
+ * @param[in] p           Source bytes
+ * @return  (uint32_t)  Value
+ * @date  16.10.2026
+ ******************************************************************************/
+static uint32_t prvRd32(const uint8_t* p)
+{
+  return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+/*!****************************************************************************
+ * @brief
+ * Read whole file into memory
+ *
+ * @param[in] path        File path
+ * @param[out] size       File size
+ * @return  (uint8_t*)  File contents, NULL on error
+ * @date  16.10.2026
+ ******************************************************************************/
+static uint8_t* prvReadFile(const char* path, size_t* size)
+{
+  FILE* f = fopen(path, "rb");
+  uint8_t* pucData;
+  long lSize;
+
+  if (f == NULL) return NULL;
+  fseek(f, 0, SEEK_END);
+  lSize = ftell(f);
+  fseek(f, 0, SEEK_SET);
+  pucData = (lSize > 0) ? malloc((size_t)lSize) : NULL;
+  if ((pucData != NULL) && (fread(pucData, 1, (size_t)lSize, f) != (size_t)lSize))
+  {
+    free(pucData);
+    pucData = NULL;
+  }
+  fclose(f);
+  *size = (size_t)lSize;
+  return pucData;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Add sample to statistics
+ *
+ * @param[in,out] stat    Statistics
+ * @param[in] value       Sample in cycles
+ * @param[in] capacity    Maximum number of samples
+ * @date  16.10.2026
+ ******************************************************************************/
+static void prvStatAdd(Stat_t* stat, uint32_t value, uint32_t capacity)
+{
+  if (stat->pulSamples == NULL) stat->pulSamples = malloc(capacity * sizeof(uint32_t));
+  if (stat->ulCount == 0 || value < stat->ulMin) stat->ulMin = value;
+  if (stat->ulCount == 0 || value > stat->ulMax) stat->ulMax = value;
+  stat->dSum += value;
+  stat->dSumSq += (double)value * value;
+  stat->pulSamples[stat->ulCount++] = value;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Print statistics line and histogram
+ *
+ * @param[in] name        Quantity name
+ * @param[in] stat        Statistics
+ * @param[in] corehz      Core clock frequency in Hz (0: cycles only)
+ * @date  16.10.2026
+ ******************************************************************************/
+static void prvStatPrint(const char* name, const Stat_t* stat, uint32_t corehz)
+{
+  uint32_t aulBins[HIST_BINS] = { 0 };
+  uint32_t ulSpan, ulPeak = 0;
+  double dMean, dVar;
+
+  if (stat->ulCount == 0) return;
+  dMean = stat->dSum / stat->ulCount;
+  dVar = stat->dSumSq / stat->ulCount - dMean * dMean;
+  printf("  %-9s n=%-6u min %8u  mean %10.1f  max %8u  sd %8.1f cycles",
+         name, stat->ulCount, stat->ulMin, dMean, stat->ulMax, (dVar > 0) ? sqrt(dVar) : 0.0);
+  if (corehz != 0) printf("  (mean %.3f us)", dMean * 1e6 / corehz);
+  printf("\n");
+
+  ulSpan = stat->ulMax - stat->ulMin;
+  if (ulSpan == 0) return;
+  for (uint32_t i = 0; i < stat->ulCount; ++i)
+  {
+    uint32_t ulBin = (uint32_t)(((uint64_t)(stat->pulSamples[i] - stat->ulMin) * HIST_BINS) / (ulSpan + 1ULL));
+    if (++aulBins[ulBin] > ulPeak) ulPeak = aulBins[ulBin];
+  }
+  for (uint32_t i = 0; i < HIST_BINS; ++i)
+  {
+    uint32_t ulLo = stat->ulMin + (uint32_t)(((uint64_t)ulSpan + 1U) * i / HIST_BINS);
+    uint32_t ulBar = (uint32_t)((uint64_t)aulBins[i] * HIST_WIDTH / ulPeak);
+    printf("    >= %8u |", ulLo);
+    for (uint32_t j = 0; j < ulBar; ++j) putchar('#');
+    printf(" %u\n", aulBins[i]);
+  }
+}
+
+int main(int argc, char** argv)
+{
+  Group_t axGroups[MAX_GROUPS];
+  uint32_t ulGroups = 0, ulRecords, ulHead, ulFirst, ulCoreHz, ulValid = 0;
+  int iVerbose = (argc > 2) && (strcmp(argv[2], "-v") == 0);
+  uint8_t* pucDump;
+  size_t xSize;
+
+  if (argc < 2)
+  {
+    fprintf(stderr, "usage: %s <dump.bin> [-v]\n", argv[0]);
+    return 2;
+  }
+
+  pucDump = prvReadFile(argv[1], &xSize);
+  if ((pucDump == NULL) || (xSize < IRQTRACE_HEADER_SIZE) || (prvRd32(pucDump) != IRQTRACE_MAGIC))
+  {
+    fprintf(stderr, "%s: not an interrupt trace dump\n", argv[1]);
+    return 1;
+  }
+  if ((pucDump[4] | (pucDump[5] << 8)) != IRQTRACE_VERSION)
+  {
+    fprintf(stderr, "%s: unsupported dump version\n", argv[1]);
+    return 1;
+  }
+
+  ulRecords = pucDump[6] | ((uint32_t)pucDump[7] << 8);
+  if ((ulRecords == 0) || (xSize < IRQTRACE_HEADER_SIZE + ulRecords * IRQTRACE_RECORD_SIZE))
+  {
+    fprintf(stderr, "%s: truncated dump (%u records expected)\n", argv[1], ulRecords);
+    return 1;
+  }
+  ulCoreHz = prvRd32(pucDump + 8);
+  ulHead = prvRd32(pucDump + 12);
+  ulFirst = (ulHead > ulRecords) ? (ulHead - ulRecords) : 0;
+  memset(axGroups, 0, sizeof(axGroups));
+
+  printf("core clock %u Hz, %u records logged, last %u kept\n", ulCoreHz, ulHead, ulHead - ulFirst);
+  if (iVerbose) printf("\n%8s %4s %-8s %5s %10s %10s %10s\n", "seq", "irq", "mode", "depth", "entry", "latency", "duration");
+
+  /* Oldest to newest; slots still being written (not valid) are skipped    */
+  for (uint32_t ulSeq = ulFirst; ulSeq != ulHead; ++ulSeq)
+  {
+    const uint8_t* pucRec = pucDump + IRQTRACE_HEADER_SIZE + (ulSeq & (ulRecords - 1U)) * IRQTRACE_RECORD_SIZE;
+    uint32_t ulPend = prvRd32(pucRec + 4), ulEntry = prvRd32(pucRec + 8), ulExit = prvRd32(pucRec + 12);
+    Group_t* pxGroup = NULL;
+
+    if ((pucRec[3] & IRQTRACE_FLAG_VALID) == 0) continue;
+    ulValid++;
+
+    for (uint32_t i = 0; i < ulGroups; ++i)
+    {
+      if ((axGroups[i].ucIRQn == pucRec[0]) && (axGroups[i].ucMode == pucRec[1])) pxGroup = &axGroups[i];
+    }
+    if ((pxGroup == NULL) && (ulGroups < MAX_GROUPS))
+    {
+      pxGroup = &axGroups[ulGroups++];
+      pxGroup->ucIRQn = pucRec[0];
+      pxGroup->ucMode = pucRec[1];
+    }
+    if (pxGroup == NULL) continue;
+
+    if (pucRec[2] > pxGroup->ucMaxDepth) pxGroup->ucMaxDepth = pucRec[2];
+    if (pucRec[3] & IRQTRACE_FLAG_PEND) prvStatAdd(&pxGroup->xLatency, ulEntry - ulPend, ulRecords);
+    prvStatAdd(&pxGroup->xDuration, ulExit - ulEntry, ulRecords);
+    if (pxGroup->xDuration.ulCount > 1) prvStatAdd(&pxGroup->xPeriod, ulEntry - pxGroup->ulLastEntry, ulRecords);
+    pxGroup->ulLastEntry = ulEntry;
+
+    if (iVerbose)
+    {
+      printf("%8u %4u %-8s %5u %10u ", ulSeq, pucRec[0], (pucRec[1] < 3) ? apcModes[pucRec[1]] : "?", pucRec[2], ulEntry);
+      if (pucRec[3] & IRQTRACE_FLAG_PEND) printf("%10u ", ulEntry - ulPend);
+      else printf("%10s ", "-");
+      printf("%10u\n", ulExit - ulEntry);
+    }
+  }
+  printf("%u valid records\n", ulValid);
+
+  for (uint32_t i = 0; i < ulGroups; ++i)
+  {
+    Group_t* pxGroup = &axGroups[i];
+    printf("\nIRQ %u (%s entry), max nesting depth %u\n", pxGroup->ucIRQn,
+           (pxGroup->ucMode < 3) ? apcModes[pxGroup->ucMode] : "?", pxGroup->ucMaxDepth);
+    prvStatPrint("latency", &pxGroup->xLatency, ulCoreHz);
+    prvStatPrint("duration", &pxGroup->xDuration, ulCoreHz);
+    prvStatPrint("period", &pxGroup->xPeriod, ulCoreHz);
+    free(pxGroup->xLatency.pulSamples);
+    free(pxGroup->xDuration.pulSamples);
+    free(pxGroup->xPeriod.pulSamples);
+  }
+
+  free(pucDump);
+  return 0;
+}
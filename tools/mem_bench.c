@@ -0,0 +1,248 @@
+/*!****************************************************************************
+ * @file
+ * mem_bench.c
+ *
+ * @brief
+ * Target program: mcycle Benchmark of the Memory and CRC Kernels
+ *
+ * Compares Mem_Copy/Mem_Set/Mem_Move with the C library memcpy/memset/
+ * memmove across buffer sizes and alignments, and times the CRC variants.
+ * Every kernel result is checked against the C library (or the bitwise CRC)
+ * first. Each figure is the minimum of MEMBENCH_RUNS runs in core cycles,
+ * with the mcycle read overhead subtracted. Output goes through printf(),
+ * e.g. retargeted to a UART by the device SDK.
+ *
+ * Call MemBench_Run() from the application, or build with -DMEMBENCH_MAIN
+ * for a stand-alone main(). Do not define USE_MEM_LIBC for this program, or
+ * both columns measure the same code. Under USE_HOST_SIM it checks results
+ * only; the simulated mcycle does not reflect execution time.
+ *
+ * Build: add mem_bench.c, core_riscv_mem.c and core_riscv_crc.c to the
+ *        firmware, -DRV_DEVICE_HEADER=\"ch32v00x.h\" -I<core dir>
+ *
+ * @date  16.10.2026
+ ******************************************************************************/
+
+#include <stdio.h>
+#include <string.h>
+#include RV_DEVICE_HEADER
+#include "core_riscv_mem.h"
+#include "core_riscv_crc.h"
+
+#ifdef USE_MEM_LIBC
+#error "mem_bench compares against the C library, build without USE_MEM_LIBC"
+#endif
+
+/* Timed runs per figure, buffer size                                         */
+#define MEMBENCH_RUNS                 8U
+#define MEMBENCH_BUF                  1040U
+
+static uint8_t aucSrc[MEMBENCH_BUF] __attribute__((aligned(4)));
+static uint8_t aucDst[MEMBENCH_BUF] __attribute__((aligned(4)));
+static uint8_t aucRef[MEMBENCH_BUF] __attribute__((aligned(4)));
+
+static const uint32_t aulSizes[] = { 4, 7, 16, 64, 256, 1024 };
+
+/* Alignment cases: destination and source offset                             */
+static const uint8_t aucAlign[][2] = { { 0, 0 }, { 1, 1 }, { 0, 3 }, { 2, 1 } };
+
+/* Cycles of an empty measurement                                             */
+static uint32_t ulOverhead;
+
+/* Benchmark operation on (dst, src, len)                                     */
+typedef void (*MemBench_Op_t)(uint8_t* dst, const uint8_t* src, uint32_t len);
+
+static void prvOpMemCopy(uint8_t* d, const uint8_t* s, uint32_t n) { Mem_Copy(d, s, n); }
+static void prvOpMemcpy(uint8_t* d, const uint8_t* s, uint32_t n)  { memcpy(d, s, n); }
+static void prvOpMemSet(uint8_t* d, const uint8_t* s, uint32_t n)  { (void)s; Mem_Set(d, 0x5A, n); }
+static void prvOpMemset(uint8_t* d, const uint8_t* s, uint32_t n)  { (void)s; memset(d, 0x5A, n); }
+static void prvOpMemMove(uint8_t* d, const uint8_t* s, uint32_t n) { (void)s; Mem_Move(d + 3, d, n); }
+static void prvOpMemmove(uint8_t* d, const uint8_t* s, uint32_t n) { (void)s; memmove(d + 3, d, n); }
+static void prvOpNop(uint8_t* d, const uint8_t* s, uint32_t n)     { (void)d; (void)s; (void)n; }
+
+/*!****************************************************************************
+ * @brief
+ * Time an operation: minimum over MEMBENCH_RUNS
+ *
+ * @param[in] op          Operation
+ * @param[out] dst        Destination
+ * @param[in] src         Source
+ * @param[in] len         Number of bytes
+ * @return  (uint32_t)  Cycles, overhead subtracted
+ * @date  16.10.2026
+ ******************************************************************************/
+static uint32_t prvTime(MemBench_Op_t op, uint8_t* dst, const uint8_t* src, uint32_t len)
+{
+  uint32_t ulBest = UINT32_MAX;
+
+  for (uint32_t i = 0; i < MEMBENCH_RUNS; ++i)
+  {
+    uint32_t ulStart = __get_MCYCLE();
+    op(dst, src, len);
+    uint32_t ulCycles = __get_MCYCLE() - ulStart;
+    if (ulCycles < ulBest) ulBest = ulCycles;
+  }
+  return (ulBest > ulOverhead) ? (ulBest - ulOverhead) : 0;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Run an operation pair on fresh buffers and compare the results
+ *
+ * @param[in] kernel      Kernel operation
+ * @param[in] libc        C library operation
+ * @param[in] dofs        Destination offset
+ * @param[in] sofs        Source offset
+ * @param[in] len         Number of bytes
+ * @return  (int)  Non-zero if the results differ
+ * @date  16.10.2026
+ ******************************************************************************/
+static int prvCheck(MemBench_Op_t kernel, MemBench_Op_t libc, uint32_t dofs, uint32_t sofs, uint32_t len)
+{
+  memset(aucRef, 0xEE, sizeof(aucRef));
+  for (uint32_t i = 0; i < 32U; ++i) aucRef[i] = (uint8_t)(i * 7U + 1U);
+  libc(aucRef + dofs, aucSrc + sofs, len);
+
+  memset(aucDst, 0xEE, sizeof(aucDst));
+  for (uint32_t i = 0; i < 32U; ++i) aucDst[i] = (uint8_t)(i * 7U + 1U);
+  kernel(aucDst + dofs, aucSrc + sofs, len);
+
+  return memcmp(aucDst, aucRef, sizeof(aucDst)) != 0;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Print one comparison table
+ *
+ * @param[in] name        Table title
+ * @param[in] kernel      Kernel operation
+ * @param[in] libc        C library operation
+ * @return  (int)  Number of mismatches
+ * @date  16.10.2026
+ ******************************************************************************/
+static int prvTable(const char* name, MemBench_Op_t kernel, MemBench_Op_t libc)
+{
+  int iErrors = 0;
+
+  printf("\n%s [cycles]\n%6s %8s %10s %10s %7s\n", name, "bytes", "dst/src", "kernel", "libc", "ratio");
+  for (uint32_t a = 0; a < sizeof(aucAlign) / sizeof(aucAlign[0]); ++a)
+  {
+    for (uint32_t s = 0; s < sizeof(aulSizes) / sizeof(aulSizes[0]); ++s)
+    {
+      uint32_t ulLen = aulSizes[s];
+      uint32_t ulDofs = aucAlign[a][0], ulSofs = aucAlign[a][1];
+      uint32_t ulKernel, ulLibc;
+      int iBad = prvCheck(kernel, libc, ulDofs, ulSofs, ulLen);
+
+      ulKernel = prvTime(kernel, aucDst + ulDofs, aucSrc + ulSofs, ulLen);
+      ulLibc = prvTime(libc, aucDst + ulDofs, aucSrc + ulSofs, ulLen);
+      printf("%6lu %4lu/%-3lu %10lu %10lu %7.2f%s\n", (unsigned long)ulLen,
+             (unsigned long)ulDofs, (unsigned long)ulSofs, (unsigned long)ulKernel, (unsigned long)ulLibc,
+             (ulKernel != 0) ? ((double)ulLibc / ulKernel) : 0.0, iBad ? "  MISMATCH" : "");
+      iErrors += iBad;
+    }
+  }
+  return iErrors;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Time the CRC variants and check them against the bitwise result
+ *
+ * @return  (int)  Number of mismatches
+ * @date  16.10.2026
+ ******************************************************************************/
+static int prvCrcTable(void)
+{
+  int iErrors = 0;
+
+  printf("\nCRC [cycles]\n%6s %-6s %10s %10s %10s\n", "bytes", "crc", "bitwise", "nibble", "table");
+  for (uint32_t s = 0; s < sizeof(aulSizes) / sizeof(aulSizes[0]); ++s)
+  {
+    uint32_t ulLen = aulSizes[s];
+    uint32_t aulCycles[3][3];
+
+    for (uint32_t i = 0; i < 3U; ++i)
+    {
+      uint32_t ulBest[3] = { UINT32_MAX, UINT32_MAX, UINT32_MAX };
+      uint32_t ulRes[3] = { 0 };
+
+      for (uint32_t r = 0; r < MEMBENCH_RUNS; ++r)
+      {
+        uint32_t ulStart = __get_MCYCLE();
+        if (i == 0) ulRes[0] = Crc8_UpdateBitwise(CRC8_INIT, aucSrc, ulLen);
+        else if (i == 1) ulRes[0] = Crc8_UpdateNibble(CRC8_INIT, aucSrc, ulLen);
+        else ulRes[0] = Crc8_UpdateTable(CRC8_INIT, aucSrc, ulLen);
+        uint32_t ulC8 = __get_MCYCLE() - ulStart;
+
+        ulStart = __get_MCYCLE();
+        if (i == 0) ulRes[1] = Crc16_UpdateBitwise(CRC16_INIT, aucSrc, ulLen);
+        else if (i == 1) ulRes[1] = Crc16_UpdateNibble(CRC16_INIT, aucSrc, ulLen);
+        else ulRes[1] = Crc16_UpdateTable(CRC16_INIT, aucSrc, ulLen);
+        uint32_t ulC16 = __get_MCYCLE() - ulStart;
+
+        ulStart = __get_MCYCLE();
+        if (i == 0) ulRes[2] = Crc32_UpdateBitwise(CRC32_INIT, aucSrc, ulLen);
+        else if (i == 1) ulRes[2] = Crc32_UpdateNibble(CRC32_INIT, aucSrc, ulLen);
+        else ulRes[2] = Crc32_UpdateTable(CRC32_INIT, aucSrc, ulLen);
+        uint32_t ulC32 = __get_MCYCLE() - ulStart;
+
+        if (ulC8 < ulBest[0]) ulBest[0] = ulC8;
+        if (ulC16 < ulBest[1]) ulBest[1] = ulC16;
+        if (ulC32 < ulBest[2]) ulBest[2] = ulC32;
+      }
+      for (uint32_t w = 0; w < 3U; ++w)
+      {
+        aulCycles[w][i] = (ulBest[w] > ulOverhead) ? (ulBest[w] - ulOverhead) : 0;
+      }
+      if ((ulRes[0] != Crc8_UpdateBitwise(CRC8_INIT, aucSrc, ulLen)) ||
+          (ulRes[1] != Crc16_UpdateBitwise(CRC16_INIT, aucSrc, ulLen)) ||
+          (ulRes[2] != Crc32_UpdateBitwise(CRC32_INIT, aucSrc, ulLen)))
+      {
+        printf("%6lu CRC variant %lu MISMATCH\n", (unsigned long)ulLen, (unsigned long)i);
+        iErrors++;
+      }
+    }
+    for (uint32_t w = 0; w < 3U; ++w)
+    {
+      static const char* const apcName[3] = { "crc8", "crc16", "crc32" };
+      printf("%6lu %-6s %10lu %10lu %10lu\n", (unsigned long)ulLen, apcName[w],
+             (unsigned long)aulCycles[w][0], (unsigned long)aulCycles[w][1], (unsigned long)aulCycles[w][2]);
+    }
+  }
+  return iErrors;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Run all benchmarks and print the results
+ *
+ * @return  (int)  Number of result mismatches
+ * @date  16.10.2026
+ ******************************************************************************/
+int MemBench_Run(void)
+{
+  int iErrors = 0;
+
+  for (uint32_t i = 0; i < MEMBENCH_BUF; ++i) aucSrc[i] = (uint8_t)(i ^ (i >> 3) ^ 0xA5U);
+  ulOverhead = 0;
+  ulOverhead = prvTime(prvOpNop, aucDst, aucSrc, 0);
+
+  printf("mcycle overhead %lu cycles (subtracted), min of %u runs\n",
+         (unsigned long)ulOverhead, MEMBENCH_RUNS);
+  iErrors += prvTable("copy: Mem_Copy vs memcpy", prvOpMemCopy, prvOpMemcpy);
+  iErrors += prvTable("fill: Mem_Set vs memset", prvOpMemSet, prvOpMemset);
+  iErrors += prvTable("overlapping move by +3: Mem_Move vs memmove", prvOpMemMove, prvOpMemmove);
+  iErrors += prvCrcTable();
+
+  printf("\n%s: CRC-32 of \"123456789\" = 0x%08lX (expected 0xCBF43926)\n",
+         (iErrors == 0) ? "PASS" : "FAIL", (unsigned long)Crc32("123456789", 9));
+  return iErrors;
+}
+
+#ifdef MEMBENCH_MAIN
+int main(void)
+{
+  return (MemBench_Run() == 0) ? 0 : 1;
+}
+#endif /* MEMBENCH_MAIN */
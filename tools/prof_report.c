@@ -0,0 +1,154 @@
+/*!****************************************************************************
+ * @file
+ * prof_report.c
+ *
+ * @brief
+ * Host tool: Profiling Report from a Prof_Data Memory Dump
+ *
+ * Usage: prof_report <dump.bin> [names.txt]
+ *
+ * The dump is the raw contents of Prof_Data (see core_riscv_prof.h), e.g.
+ * saved with "dump binary memory dump.bin &Prof_Data (&Prof_Data)+1" in gdb.
+ * The optional names file holds one probe name per line, in probe ID order.
+ *
+ * Build: cc -O2 -o prof_report prof_report.c
+ *
+ * @date  16.10.2026
+ ******************************************************************************/
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* Dump layout (little endian), see Prof_Data_t                               */
+#define PROF_MAGIC                    0x464F5250UL
+#define PROF_VERSION                  1U
+#define PROF_HEADER_SIZE              24U
+#define PROF_PROBE_SIZE               32U
+#define PROF_NAME_LEN                 48U
+
+/*!****************************************************************************
+ * @brief
+ * Read little-endian 32-bit word
+ *
+ * @param[in] p           Source bytes
+ * @return  (uint32_t)  Value
+ * @date  16.10.2026
+ ******************************************************************************/
+static uint32_t prvRd32(const uint8_t* p)
+{
+  return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+/*!****************************************************************************
+ * @brief
+ * Read little-endian 64-bit word
+ *
+ * @param[in] p           Source bytes
+ * @return  (uint64_t)  Value
+ * @date  16.10.2026
+ ******************************************************************************/
+static uint64_t prvRd64(const uint8_t* p)
+{
+  return (uint64_t)prvRd32(p) | ((uint64_t)prvRd32(p + 4) << 32);
+}
+
+/*!****************************************************************************
+ * @brief
+ * Read whole file into memory
+ *
+ * @param[in] path        File path
+ * @param[out] size       File size
+ * @return  (uint8_t*)  File contents, NULL on error
+ * @date  16.10.2026
+ ******************************************************************************/
+static uint8_t* prvReadFile(const char* path, size_t* size)
+{
+  FILE* f = fopen(path, "rb");
+  uint8_t* pucData;
+  long lSize;
+
+  if (f == NULL) return NULL;
+  fseek(f, 0, SEEK_END);
+  lSize = ftell(f);
+  fseek(f, 0, SEEK_SET);
+  pucData = (lSize > 0) ? malloc((size_t)lSize) : NULL;
+  if ((pucData != NULL) && (fread(pucData, 1, (size_t)lSize, f) != (size_t)lSize))
+  {
+    free(pucData);
+    pucData = NULL;
+  }
+  fclose(f);
+  *size = (size_t)lSize;
+  return pucData;
+}
+
+int main(int argc, char** argv)
+{
+  char acNames[256][PROF_NAME_LEN] = { { 0 } };
+  uint32_t ulProbes, ulCoreHz;
+  uint8_t* pucDump;
+  size_t xSize;
+
+  if (argc < 2)
+  {
+    fprintf(stderr, "usage: %s <dump.bin> [names.txt]\n", argv[0]);
+    return 2;
+  }
+
+  pucDump = prvReadFile(argv[1], &xSize);
+  if ((pucDump == NULL) || (xSize < PROF_HEADER_SIZE) || (prvRd32(pucDump) != PROF_MAGIC))
+  {
+    fprintf(stderr, "%s: not a profiling dump\n", argv[1]);
+    return 1;
+  }
+  if ((pucDump[4] | (pucDump[5] << 8)) != PROF_VERSION)
+  {
+    fprintf(stderr, "%s: unsupported dump version\n", argv[1]);
+    return 1;
+  }
+
+  ulProbes = pucDump[6] | ((uint32_t)pucDump[7] << 8);
+  if (xSize < PROF_HEADER_SIZE + ulProbes * PROF_PROBE_SIZE)
+  {
+    fprintf(stderr, "%s: truncated dump (%u probes expected)\n", argv[1], ulProbes);
+    return 1;
+  }
+  ulCoreHz = prvRd32(pucDump + 8);
+
+  if (argc > 2)
+  {
+    FILE* f = fopen(argv[2], "r");
+    for (uint32_t i = 0; (f != NULL) && (i < 256) && fgets(acNames[i], PROF_NAME_LEN, f); ++i)
+    {
+      acNames[i][strcspn(acNames[i], "\r\n")] = '\0';
+    }
+    if (f != NULL) fclose(f);
+  }
+
+  printf("core clock %u Hz, overhead %u cycles / %u instr per sample (subtracted)\n\n",
+         ulCoreHz, prvRd32(pucDump + 12), prvRd32(pucDump + 16));
+  printf("%-3s %-24s %10s %10s %10s %12s %10s %6s\n",
+         "id", "name", "count", "min", "max", "mean", "mean[us]", "IPC");
+
+  for (uint32_t i = 0; i < ulProbes; ++i)
+  {
+    const uint8_t* pucProbe = pucDump + PROF_HEADER_SIZE + i * PROF_PROBE_SIZE;
+    uint64_t ullCycles = prvRd64(pucProbe);
+    uint64_t ullInstr = prvRd64(pucProbe + 8);
+    uint32_t ulCount = prvRd32(pucProbe + 16);
+    double dMean;
+
+    if (ulCount == 0) continue;
+    dMean = (double)ullCycles / ulCount;
+    printf("%-3u %-24s %10u %10u %10u %12.1f %10.3f %6.3f\n",
+           i, (i < 256) ? acNames[i] : "", ulCount,
+           prvRd32(pucProbe + 20), prvRd32(pucProbe + 24), dMean,
+           (ulCoreHz != 0) ? (dMean * 1e6 / ulCoreHz) : 0.0,
+           (ullCycles != 0) ? ((double)ullInstr / (double)ullCycles) : 0.0);
+  }
+
+  free(pucDump);
+  return 0;
+}
@@ -0,0 +1,176 @@
+/*!****************************************************************************
+ * @file
+ * reg_compare.cpp
+ *
+ * @brief
+ * Host tool: Register Access Comparison of C Macros and core_riscv.hpp
+ *
+ * Usage: reg_compare
+ *
+ * Runs equivalent register sequences through the C API/macros of
+ * core_riscv.h and through the typed layer of core_riscv.hpp on the host
+ * simulation (USE_HOST_SIM), and reports the number of register loads and
+ * stores of each. The final register file contents of both variants are
+ * compared; a mismatch is reported and fails the run. Built and run by
+ * "make -C tests".
+ *
+ * Without USE_HOST_SIM only the sequences are compiled, for the code size
+ * comparison of "make -C tests/target reg-compare" (needs $(CROSS)g++).
+ *
+ * @date  16.10.2026
+ ******************************************************************************/
+
+#include <stdint.h>
+#ifdef USE_HOST_SIM
+#include <stdio.h>
+#include <string.h>
+#endif /* USE_HOST_SIM */
+
+/* Minimal device interrupt numbers                                           */
+typedef enum { SysTicK_IRQn = 12, Software_IRQn = 14, TIM2_IRQn = 38 } IRQn_Type;
+
+extern "C" {
+#include "core_riscv.h"
+}
+#include "core_riscv.hpp"
+
+using namespace rv;
+
+/* Comparison case: the same effect written both ways                         */
+typedef struct {
+  const char* pcName;
+  void (*pfnC)(void);
+  void (*pfnCpp)(void);
+} Case_t;
+
+static void prvWfeModeC(void)
+{
+  RV_REG_WRITE(PFIC->SCTLR, RV_REG_READ(PFIC->SCTLR) | PFIC_SCTLR_WFITOWFE);
+}
+
+static void prvWfeModeCpp(void)
+{
+  pfic::SCTLR::modify(pfic::SCTLR_WFITOWFE::set());
+}
+
+static void prvSleepSetupC(void)
+{
+  RV_REG_WRITE(PFIC->SCTLR, RV_REG_READ(PFIC->SCTLR) | PFIC_SCTLR_SEVONPEND);
+  RV_REG_WRITE(PFIC->SCTLR, RV_REG_READ(PFIC->SCTLR) | PFIC_SCTLR_SLEEPDEEP);
+  RV_REG_WRITE(PFIC->SCTLR, RV_REG_READ(PFIC->SCTLR) & ~PFIC_SCTLR_WFITOWFE);
+}
+
+static void prvSleepSetupCpp(void)
+{
+  pfic::SCTLR::modify(pfic::SCTLR_SEVONPEND::set(), pfic::SCTLR_SLEEPDEEP::set(),
+                      pfic::SCTLR_WFITOWFE::clear());
+}
+
+static void prvFastIrqC(void)
+{
+  PFIC_ConfigFastIRQ(1, 0x00000468UL, TIM2_IRQn);
+  PFIC_EnableFastIRQ(1);
+}
+
+static void prvFastIrqCpp(void)
+{
+  pfic::VTFIDR::modify(pfic::VTFIDR_VTFID<1>::val(TIM2_IRQn));
+  pfic::VTFADDRR<1>::write(pfic::VTFADDRR_ADDR<1>::val(0x00000468UL >> 1), pfic::VTFADDRR_VTFEN<1>::set());
+}
+
+static void prvSysTickStartC(void)
+{
+  RV_REG_WRITE(SysTick->SR, 0);
+  RV_REG_WRITE(SysTick->CMPR, 5999UL);
+  RV_REG_WRITE(SysTick->CTLR, SYSTICK_CTLR_STE | SYSTICK_CTLR_STIE | SYSTICK_CTLR_STRE);
+}
+
+static void prvSysTickStartCpp(void)
+{
+  systick::SR::modify(systick::SR_CNTIF::clear());
+  systick::CMPR::write(5999UL);
+  systick::CTLR::write(systick::CTLR_STE::set(), systick::CTLR_STIE::set(), systick::CTLR_STRE::set());
+}
+
+static void prvPendSwieC(void)
+{
+  RV_REG_WRITE(SysTick->CTLR, RV_REG_READ(SysTick->CTLR) | SYSTICK_CTLR_SWIE);
+}
+
+static void prvPendSwieCpp(void)
+{
+  systick::CTLR::modify(systick::CTLR_SWIE::set());
+}
+
+static void prvThresholdC(void)
+{
+  PFIC_SetPriority(TIM2_IRQn, 0x40);
+  PFIC_EnableIRQ(TIM2_IRQn);
+}
+
+static void prvThresholdCpp(void)
+{
+  pfic::IPRIOR<TIM2_IRQn / 4>::modify(pfic::IPRIOR_PRIO<TIM2_IRQn>::val(0x40));
+  pfic::EnableIRQ<TIM2_IRQn>();
+}
+
+/* External, so that an rv32ec build without main() keeps all sequences      */
+extern const Case_t axCases[];
+const Case_t axCases[] = {
+  { "WFE mode (SCTLR.WFITOWFE)",         prvWfeModeC,      prvWfeModeCpp      },
+  { "Sleep setup (3 SCTLR fields)",      prvSleepSetupC,   prvSleepSetupCpp   },
+  { "VTF channel config + enable",       prvFastIrqC,      prvFastIrqCpp      },
+  { "SysTick start (SR, CMPR, CTLR)",    prvSysTickStartC, prvSysTickStartCpp },
+  { "SysTick SWIE pend",                 prvPendSwieC,     prvPendSwieCpp     },
+  { "IRQ priority + enable",             prvThresholdC,    prvThresholdCpp    },
+};
+
+#ifdef USE_HOST_SIM
+/*!****************************************************************************
+ * @brief
+ * Run one variant from reset
+ *
+ * @param[in] fn          Variant
+ * @param[out] reads      Register loads
+ * @param[out] writes     Register stores
+ * @param[out] pfic       PFIC register file after the run
+ * @param[out] systick    SysTick register file after the run
+ * @date  16.10.2026
+ ******************************************************************************/
+static void prvRun(void (*fn)(void), uint32_t* reads, uint32_t* writes,
+                   uint32_t* pfic, uint32_t* systick)
+{
+  RVSim_Reset();
+  RV_REG_WRITE(PFIC->SCTLR, PFIC_SCTLR_SLEEPONEXIT);
+  RVSim_ResetCounters();
+  fn();
+  *reads = RVSim_State.ulReads;
+  *writes = RVSim_State.ulWrites;
+  memcpy(pfic, RVSim_PFICMem, sizeof(RVSim_PFICMem));
+  memcpy(systick, RVSim_SysTickMem, sizeof(RVSim_SysTickMem));
+}
+
+int main(void)
+{
+  static uint32_t aulPficC[RVSIM_PFIC_WORDS], aulPficCpp[RVSIM_PFIC_WORDS];
+  static uint32_t aulTickC[RVSIM_SYSTICK_WORDS], aulTickCpp[RVSIM_SYSTICK_WORDS];
+  int iResult = 0;
+
+  printf("%-34s %8s %8s %8s %8s %6s\n", "sequence", "C ld", "C st", "C++ ld", "C++ st", "state");
+  for (size_t i = 0; i < sizeof(axCases) / sizeof(axCases[0]); ++i)
+  {
+    uint32_t ulReadC, ulWriteC, ulReadCpp, ulWriteCpp;
+    int iSame;
+
+    prvRun(axCases[i].pfnC, &ulReadC, &ulWriteC, aulPficC, aulTickC);
+    prvRun(axCases[i].pfnCpp, &ulReadCpp, &ulWriteCpp, aulPficCpp, aulTickCpp);
+    iSame = (memcmp(aulPficC, aulPficCpp, sizeof(aulPficC)) == 0) &&
+            (memcmp(aulTickC, aulTickCpp, sizeof(aulTickC)) == 0);
+    if (!iSame) iResult = 1;
+
+    printf("%-34s %8u %8u %8u %8u %6s\n", axCases[i].pcName,
+           ulReadC, ulWriteC, ulReadCpp, ulWriteCpp, iSame ? "same" : "DIFF");
+  }
+  return iResult;
+}
+#endif /* USE_HOST_SIM */
@@ -0,0 +1,1686 @@
+/*!****************************************************************************
+ * @file
+ * rv32ec_sim.c
+ *
+ * @brief
+ * Host tool: RV32EC Instruction-Set Simulator for Cycle Benchmarks
+ *
+ * Usage: rv32ec_sim [options] <firmware.elf>
+ *  -s <symbol>     Stop when <symbol> is reached, e.g. main (reset-to-main)
+ *  -k <symbol>     Skip <symbol>: calls return immediately, e.g. SystemInit
+ *                  (repeatable)
+ *  -i <IRQn>@<t>   Pend interrupt IRQn at cycle t (repeatable)
+ *  -n <count>      Instruction limit (default 100000000)
+ *  -w <n>          Flash wait states (default 0)
+ *  -b <n>          Taken branch/jump penalty in cycles (default 1)
+ *  -f <bytes>      Flash size (default 16384)
+ *  -r <bytes>      SRAM size (default 2048)
+ *  -g <cycles>     Regression gate: exit with 3 if more cycles were used
+ *
+ * Runs a linked firmware image from reset (address 0) and reports the
+ * number of executed instructions and estimated cycles per symbol and per
+ * interrupt. Symbols are taken from the ELF symbol table, so local labels of
+ * startup_riscv.s (e.g. __crt0_clear_bss_loop) are reported separately.
+ *
+ * Emulated core: RV32EC (x0..x15, no M/A), Zicsr, mret, wfi. CSRs mstatus,
+ * misa, mtvec, mscratch, mepc, mcause, mtval, mcycle(h), minstret(h),
+ * intsyscr (0x804) and debugcr (0x7c0). Memory map:
+ *  - Flash at 0x00000000, aliased at 0x08000000 (read-only)
+ *  - SRAM at 0x20000000
+ *  - Peripherals at 0x40000000..0x4002FFFF as plain read/write memory, so
+ *    polling loops on status flags do not terminate (skip them with -k)
+ *  - PFIC at 0xE000E000 and SysTick at 0xE000F000 (see core_riscv.h)
+ *
+ * Cycle model (estimate, not cycle exact):
+ *  - one cycle per instruction, plus the wait states per flash data load
+ *  - taken branches, jumps and mret add the branch penalty, plus the wait
+ *    states if the target is in flash
+ *  - interrupt entry costs the branch penalty, plus the wait states per
+ *    vector table read and for a flash target; hardware prologue/epilogue
+ *    (intsyscr.HWSTKEN) overlaps the entry and mret
+ *  - mcycle halts during WFI/WFE, SysTick keeps counting (sleep cycles are
+ *    reported separately; -i times include them)
+ *
+ * Interrupt model: vectored through mtvec (mode bits as in startup_riscv.s)
+ * or VTF. With intsyscr.INESTEN, mstatus.MIE stays set on entry and an
+ * interrupt preempts another one if its IPRIOR bit 7 (preemption bit) is
+ * clear and the active one's is set, up to two levels. mepc, mcause and MPIE
+ * are stacked per level. SysTick pends IRQ 12 when CNTIF is set with STIE,
+ * and while SWIE is set. WFI with SCTLR.WFITOWFE executes as WFE once.
+ *
+ * The run stops at the stop symbol, ebreak, a jump-to-self with no possible
+ * interrupt (e.g. after main() returns), a sleep without wakeup source, a
+ * system reset request, a fault or the instruction limit.
+ *
+ * Build: cc -O2 -o rv32ec_sim rv32ec_sim.c
+ *
+ * @date  16.10.2026
+ ******************************************************************************/
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* Memory map                                                                 */
+#define SIM_FLASH_ALIAS               0x08000000UL
+#define SIM_SRAM_BASE                 0x20000000UL
+#define SIM_PERIPH_BASE               0x40000000UL
+#define SIM_PERIPH_SIZE               0x00030000UL
+#define SIM_PFIC_BASE                 0xE000E000UL
+#define SIM_SYSTICK_BASE              0xE000F000UL
+
+/* Core configuration                                                         */
+#define SIM_MISA                      0x40800014UL  /* RV32, E, C, X          */
+#define SIM_NEST_MAX                  2U
+#define SIM_LEVELS                    (SIM_NEST_MAX + 1U)
+#define SIM_INJECT_MAX                64U
+#define SIM_SKIP_MAX                  16U
+
+/* CSR bits                                                                   */
+#define MSTATUS_MIE                   0x00000008UL
+#define MSTATUS_MPIE                  0x00000080UL
+#define MSTATUS_MPP                   0x00001800UL
+#define INTSYSCR_HWSTKEN              0x00000001UL
+#define INTSYSCR_INESTEN              0x00000002UL
+
+/* PFIC / SysTick bits (see core_riscv.h)                                     */
+#define PFIC_CFGR_KEY3                0xBEEF0000UL
+#define PFIC_CFGR_RESETSYS            0x00000080UL
+#define PFIC_SCTLR_WFITOWFE           0x00000008UL
+#define PFIC_SCTLR_SEVONPEND          0x00000010UL
+#define PFIC_SCTLR_SETEVENT           0x00000020UL
+#define PFIC_SCTLR_SYSRESET           0x80000000UL
+#define SYSTICK_CTLR_STE              0x00000001UL
+#define SYSTICK_CTLR_STIE             0x00000002UL
+#define SYSTICK_CTLR_STCLK            0x00000004UL
+#define SYSTICK_CTLR_STRE             0x00000008UL
+#define SYSTICK_CTLR_SWIE             0x80000000UL
+#define SYSTICK_SR_CNTIF              0x00000001UL
+#define SYSTICK_IRQN                  12U
+#define ECALL_IRQN                    5U
+#define ECALL_CAUSE                   11UL
+
+/* Registers saved by the hardware prologue (ra, t0..t2, a0..a5)              */
+static const uint8_t aucHpeRegs[] = { 1, 5, 6, 7, 10, 11, 12, 13, 14, 15 };
+
+/* Symbol with execution counters                                             */
+typedef struct {
+  uint32_t ulAddr;
+  const char* pcName;
+  uint8_t ucRank;             /*!< Preference among aliases, lower is better  */
+  uint64_t ullCalls;
+  uint64_t ullInstr;
+  uint64_t ullCycles;
+} Sym_t;
+
+/* Interrupt statistics                                                       */
+typedef struct {
+  uint64_t ullCount;
+  uint64_t ullCycles;         /*!< Entry to mret, including nested handlers   */
+  uint64_t ullMin;
+  uint64_t ullMax;
+  uint64_t ullLatMax;         /*!< Pend to entry                              */
+  uint64_t ullPend;           /*!< Time of pending                            */
+} Irq_Stats_t;
+
+/* Active interrupt level                                                     */
+typedef struct {
+  uint8_t ucIRQn;
+  uint8_t ucHpe;
+  uint32_t ulMepc;
+  uint32_t ulMcause;
+  uint32_t ulMpie;
+  uint64_t ullEntry;
+  uint32_t aulHpe[sizeof(aucHpeRegs)];
+} Level_t;
+
+/* Injected interrupt                                                         */
+typedef struct {
+  uint8_t ucIRQn;
+  uint8_t ucDone;
+  uint64_t ullTime;
+} Inject_t;
+
+/* Simulator state                                                            */
+typedef struct {
+  uint32_t x[16];
+  uint32_t ulPc;
+  uint32_t ulNextPc;
+  uint32_t ulCost;
+  uint32_t ulMstatus, ulMtvec, ulMscratch, ulMepc, ulMcause, ulMtval;
+  uint32_t ulIntsyscr, ulDebugcr;
+  uint64_t ullCycle;          /*!< mcycle                                     */
+  uint64_t ullInstret;        /*!< minstret                                   */
+  uint64_t ullTime;           /*!< Elapsed core clocks, including sleep       */
+  uint64_t ullSleep;
+  uint64_t ullBranches;
+  uint64_t ullFlashLoads;
+  uint8_t* pucFlash;
+  uint32_t ulFlashSize;
+  uint8_t* pucSram;
+  uint32_t ulSramSize;
+  uint8_t* pucPeriph;
+  uint32_t aulEnable[8], aulPend[8], aulActive[8];
+  uint8_t aucPrio[256];
+  uint32_t ulThreshold, ulVtfId, aulVtfAddr[4], ulSctlr;
+  uint8_t ucEvent;
+  Level_t axLevel[SIM_LEVELS];
+  uint32_t ulDepth;
+  uint32_t ulStCtlr, ulStSr, ulStCntr, ulStCmpr, ulStPresc;
+  Irq_Stats_t axIrq[256];
+  const char* pcStop;
+  int iExit;
+} Sim_t;
+
+static Sim_t xSim;
+static uint32_t ulWait;
+static uint32_t ulPenalty = 1;
+static Sym_t* axSym;
+static uint32_t ulSyms;
+static Sym_t xUnknown = { 0, "(no symbol)", 0, 0, 0, 0 };
+static Sym_t* pxCurSym;
+static uint32_t ulCurLo, ulCurHi;
+static Inject_t axInject[SIM_INJECT_MAX];
+static uint32_t ulInjects;
+
+/* Instruction encoders (compressed instructions are expanded)                */
+#define ENC_R(f7, rs2, rs1, f3, rd, op) \
+  (((uint32_t)(f7) << 25) | ((uint32_t)(rs2) << 20) | ((uint32_t)(rs1) << 15) | \
+   ((uint32_t)(f3) << 12) | ((uint32_t)(rd) << 7) | (op))
+#define ENC_I(imm, rs1, f3, rd, op) \
+  ((((uint32_t)(imm) & 0xFFFU) << 20) | ((uint32_t)(rs1) << 15) | \
+   ((uint32_t)(f3) << 12) | ((uint32_t)(rd) << 7) | (op))
+#define ENC_S(imm, rs2, rs1, f3) \
+  (((((uint32_t)(imm) >> 5) & 0x7FU) << 25) | ((uint32_t)(rs2) << 20) | ((uint32_t)(rs1) << 15) | \
+   ((uint32_t)(f3) << 12) | (((uint32_t)(imm) & 0x1FU) << 7) | 0x23U)
+#define ENC_B(imm, rs2, rs1, f3) \
+  (((((uint32_t)(imm) >> 12) & 1U) << 31) | ((((uint32_t)(imm) >> 5) & 0x3FU) << 25) | \
+   ((uint32_t)(rs2) << 20) | ((uint32_t)(rs1) << 15) | ((uint32_t)(f3) << 12) | \
+   ((((uint32_t)(imm) >> 1) & 0xFU) << 8) | ((((uint32_t)(imm) >> 11) & 1U) << 7) | 0x63U)
+#define ENC_J(imm, rd) \
+  (((((uint32_t)(imm) >> 20) & 1U) << 31) | ((((uint32_t)(imm) >> 1) & 0x3FFU) << 21) | \
+   ((((uint32_t)(imm) >> 11) & 1U) << 20) | ((uint32_t)(imm) & 0xFF000U) | \
+   ((uint32_t)(rd) << 7) | 0x6FU)
+#define ENC_ILLEGAL                   0x00000000UL
+
+/*!****************************************************************************
+ * @brief
+ * Read little-endian 16-bit word
+ *
+ * @param[in] p           Source bytes
+ * @return  (uint32_t)  Value
+ * @date  16.10.2026
+ ******************************************************************************/
+static uint32_t prvRd16(const uint8_t* p)
+{
+  return (uint32_t)p[0] | ((uint32_t)p[1] << 8);
+}
+
+/*!****************************************************************************
+ * @brief
+ * Read little-endian 32-bit word
+ *
+ * @param[in] p           Source bytes
+ * @return  (uint32_t)  Value
+ * @date  16.10.2026
+ ******************************************************************************/
+static uint32_t prvRd32(const uint8_t* p)
+{
+  return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+/*!****************************************************************************
+ * @brief
+ * Read whole file into memory
+ *
+ * @param[in] path        File path
+ * @param[out] size       File size
+ * @return  (uint8_t*)  File contents, NULL on error
+ * @date  16.10.2026
+ ******************************************************************************/
+static uint8_t* prvReadFile(const char* path, size_t* size)
+{
+  FILE* f = fopen(path, "rb");
+  uint8_t* pucData;
+  long lSize;
+
+  if (f == NULL) return NULL;
+  fseek(f, 0, SEEK_END);
+  lSize = ftell(f);
+  fseek(f, 0, SEEK_SET);
+  pucData = (lSize > 0) ? malloc((size_t)lSize) : NULL;
+  if ((pucData != NULL) && (fread(pucData, 1, (size_t)lSize, f) != (size_t)lSize))
+  {
+    free(pucData);
+    pucData = NULL;
+  }
+  fclose(f);
+  *size = (size_t)lSize;
+  return pucData;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Sign-extend bit field
+ *
+ * @param[in] value       Field value (upper bits ignored)
+ * @param[in] bits        Field width
+ * @return  (uint32_t)  Sign-extended value
+ * @date  16.10.2026
+ ******************************************************************************/
+static uint32_t prvSext(uint32_t value, uint32_t bits)
+{
+  uint32_t ulSign = 1UL << (bits - 1U);
+  value &= (ulSign << 1) - 1U;
+  return (value ^ ulSign) - ulSign;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Stop simulation
+ *
+ * @param[in] reason      Stop reason (static string)
+ * @param[in] code        Exit status
+ * @date  16.10.2026
+ ******************************************************************************/
+static void prvStop(const char* reason, int code)
+{
+  if (xSim.pcStop != NULL) return;
+  xSim.pcStop = reason;
+  xSim.iExit = code;
+}
+
+/* ############################ Symbols ##################################### */
+/*!****************************************************************************
+ * @brief
+ * Order symbols by address, then preference
+ *
+ * @date  16.10.2026
+ ******************************************************************************/
+static int prvSymCompare(const void* a, const void* b)
+{
+  const Sym_t* pxA = a;
+  const Sym_t* pxB = b;
+  if (pxA->ulAddr != pxB->ulAddr) return (pxA->ulAddr < pxB->ulAddr) ? -1 : 1;
+  if (pxA->ucRank != pxB->ucRank) return (pxA->ucRank < pxB->ucRank) ? -1 : 1;
+  return strcmp(pxA->pcName, pxB->pcName);
+}
+
+/*!****************************************************************************
+ * @brief
+ * Order symbols by cycles, descending
+ *
+ * @date  16.10.2026
+ ******************************************************************************/
+static int prvSymCompareCycles(const void* a, const void* b)
+{
+  const Sym_t* pxA = *(Sym_t* const*)a;
+  const Sym_t* pxB = *(Sym_t* const*)b;
+  if (pxA->ullCycles != pxB->ullCycles) return (pxA->ullCycles > pxB->ullCycles) ? -1 : 1;
+  return (pxA->ulAddr < pxB->ulAddr) ? -1 : 1;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Find symbol by name
+ *
+ * @param[in] name        Symbol name
+ * @return  (Sym_t*)  Symbol, NULL if not found
+ * @date  16.10.2026
+ ******************************************************************************/
+static Sym_t* prvSymByName(const char* name)
+{
+  for (uint32_t i = 0; i < ulSyms; ++i)
+  {
+    if (strcmp(axSym[i].pcName, name) == 0) return &axSym[i];
+  }
+  return NULL;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Find symbol containing an address (nearest symbol at or below it)
+ *
+ * @param[in] addr        Code address
+ * @return  (Sym_t*)  Symbol, &xUnknown if below all symbols
+ * @date  16.10.2026
+ ******************************************************************************/
+static Sym_t* prvSymAt(uint32_t addr)
+{
+  uint32_t ulLo = 0, ulHi = ulSyms;
+
+  if ((pxCurSym != NULL) && (addr >= ulCurLo) && (addr < ulCurHi)) return pxCurSym;
+
+  while (ulLo < ulHi)
+  {
+    uint32_t ulMid = (ulLo + ulHi) / 2U;
+    if (axSym[ulMid].ulAddr <= addr) ulLo = ulMid + 1U;
+    else ulHi = ulMid;
+  }
+  /* ulLo: first symbol above addr                                            */
+  ulCurHi = (ulLo < ulSyms) ? axSym[ulLo].ulAddr : 0xFFFFFFFFUL;
+  if (ulLo == 0)
+  {
+    ulCurLo = 0;
+    pxCurSym = &xUnknown;
+  }
+  else
+  {
+    ulCurLo = axSym[ulLo - 1U].ulAddr;
+    pxCurSym = &axSym[ulLo - 1U];
+  }
+  return pxCurSym;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Load code symbols from the ELF symbol table
+ *
+ * Keeps function and untyped symbols (assembler labels) of executable
+ * sections; of several symbols at one address, functions and global symbols
+ * are preferred.
+ *
+ * @param[in] elf         ELF image
+ * @param[in] size        Image size
+ * @date  16.10.2026
+ ******************************************************************************/
+static void prvLoadSymbols(const uint8_t* elf, size_t size)
+{
+  uint32_t ulShOff = prvRd32(elf + 0x20);
+  uint32_t ulShEnt = prvRd16(elf + 0x2E);
+  uint32_t ulShNum = prvRd16(elf + 0x30);
+  uint32_t ulKept = 0;
+
+  for (uint32_t s = 0; s < ulShNum; ++s)
+  {
+    const uint8_t* pucSh = elf + ulShOff + s * ulShEnt;
+    const uint8_t* pucStr;
+    uint32_t ulOff, ulCount, ulStrOff, ulStrSize;
+
+    if ((ulShOff + (s + 1U) * ulShEnt > size) || (prvRd32(pucSh + 4) != 2U)) continue;
+    ulOff = prvRd32(pucSh + 16);
+    ulCount = prvRd32(pucSh + 20) / 16U;
+    pucStr = elf + ulShOff + prvRd32(pucSh + 24) * ulShEnt;
+    ulStrOff = prvRd32(pucStr + 16);
+    ulStrSize = prvRd32(pucStr + 20);
+    if ((ulOff + ulCount * 16U > size) || (ulStrOff + ulStrSize > size)) continue;
+
+    axSym = realloc(axSym, (ulSyms + ulCount) * sizeof(Sym_t));
+    for (uint32_t i = 0; i < ulCount; ++i)
+    {
+      const uint8_t* pucSym = elf + ulOff + i * 16U;
+      uint32_t ulName = prvRd32(pucSym);
+      uint32_t ulType = pucSym[12] & 0xFU;
+      uint32_t ulShndx = prvRd16(pucSym + 14);
+      const char* pcName;
+
+      if ((ulType > 2U) || (ulType == 1U) || (ulShndx == 0U) || (ulShndx >= ulShNum)) continue;
+      if ((prvRd32(elf + ulShOff + ulShndx * ulShEnt + 8) & 0x4U) == 0U) continue;
+      if (ulName >= ulStrSize) continue;
+      pcName = (const char*)elf + ulStrOff + ulName;
+      if ((pcName[0] == '\0') || (pcName[0] == '$') || (strncmp(pcName, ".L", 2) == 0)) continue;
+
+      axSym[ulSyms].ulAddr = prvRd32(pucSym + 4) & ~1UL;
+      axSym[ulSyms].pcName = pcName;
+      axSym[ulSyms].ucRank = (uint8_t)(((ulType == 2U) ? 0U : 2U) + (((pucSym[12] >> 4) != 0U) ? 0U : 1U));
+      axSym[ulSyms].ullCalls = axSym[ulSyms].ullInstr = axSym[ulSyms].ullCycles = 0;
+      ++ulSyms;
+    }
+  }
+
+  if (ulSyms == 0) return;
+  qsort(axSym, ulSyms, sizeof(Sym_t), prvSymCompare);
+  for (uint32_t i = 0; i < ulSyms; ++i)
+  {
+    if ((ulKept == 0) || (axSym[ulKept - 1U].ulAddr != axSym[i].ulAddr)) axSym[ulKept++] = axSym[i];
+  }
+  ulSyms = ulKept;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Load PT_LOAD segments at their load (physical) addresses
+ *
+ * @param[in] elf         ELF image
+ * @param[in] size        Image size
+ * @return  (int)  0 on success, -1 if a segment lies outside flash/SRAM
+ * @date  16.10.2026
+ ******************************************************************************/
+static int prvLoadSegments(const uint8_t* elf, size_t size)
+{
+  uint32_t ulPhOff = prvRd32(elf + 0x1C);
+  uint32_t ulPhEnt = prvRd16(elf + 0x2A);
+  uint32_t ulPhNum = prvRd16(elf + 0x2C);
+
+  for (uint32_t p = 0; p < ulPhNum; ++p)
+  {
+    const uint8_t* pucPh = elf + ulPhOff + p * ulPhEnt;
+    uint32_t ulOff, ulAddr, ulSize;
+    uint8_t* pucDest;
+
+    if (ulPhOff + (p + 1U) * ulPhEnt > size) return -1;
+    if (prvRd32(pucPh) != 1U) continue;
+    ulOff = prvRd32(pucPh + 4);
+    ulAddr = prvRd32(pucPh + 12);
+    ulSize = prvRd32(pucPh + 16);
+    if ((ulSize == 0) || (ulOff + ulSize > size)) continue;
+
+    if ((ulAddr >= SIM_FLASH_ALIAS) && (ulAddr - SIM_FLASH_ALIAS < xSim.ulFlashSize)) ulAddr -= SIM_FLASH_ALIAS;
+    if ((ulAddr < xSim.ulFlashSize) && (ulSize <= xSim.ulFlashSize - ulAddr))
+    {
+      pucDest = xSim.pucFlash + ulAddr;
+    }
+    else if ((ulAddr >= SIM_SRAM_BASE) && (ulAddr - SIM_SRAM_BASE < xSim.ulSramSize) &&
+             (ulSize <= xSim.ulSramSize - (ulAddr - SIM_SRAM_BASE)))
+    {
+      pucDest = xSim.pucSram + (ulAddr - SIM_SRAM_BASE);
+    }
+    else
+    {
+      fprintf(stderr, "segment 0x%08x (%u bytes) outside flash/SRAM\n", ulAddr, ulSize);
+      return -1;
+    }
+    memcpy(pucDest, elf + ulOff, ulSize);
+  }
+  return 0;
+}
+
+/* ############################ Interrupts ################################## */
+/*!****************************************************************************
+ * @brief
+ * Set interrupt pending
+ *
+ * @param[in] IRQn        Interrupt Number
+ * @date  16.10.2026
+ ******************************************************************************/
+static void prvPend(uint32_t IRQn)
+{
+  uint32_t ulBit = 1UL << (IRQn & 31U);
+  if ((xSim.aulPend[IRQn >> 5] & ulBit) == 0U)
+  {
+    xSim.aulPend[IRQn >> 5] |= ulBit;
+    xSim.axIrq[IRQn].ullPend = xSim.ullTime;
+  }
+}
+
+/*!****************************************************************************
+ * @brief
+ * Check for a pending interrupt that wakes the core from sleep
+ *
+ * @param[in] any         Also wake on pending disabled interrupts (SEVONPEND)
+ * @return  (int)  Non-zero if a wakeup is pending
+ * @date  16.10.2026
+ ******************************************************************************/
+static int prvWakePending(int any)
+{
+  for (uint32_t i = 0; i < 8U; ++i)
+  {
+    if ((xSim.aulPend[i] & (any ? 0xFFFFFFFFUL : xSim.aulEnable[i])) != 0U) return 1;
+  }
+  return 0;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Select the interrupt to be taken, if any
+ *
+ * @return  (int)  IRQn, -1 if none may be taken now
+ * @date  16.10.2026
+ ******************************************************************************/
+static int prvSelectIrq(void)
+{
+  int iBest = -1;
+
+  if ((xSim.ulMstatus & MSTATUS_MIE) == 0U) return -1;
+  for (uint32_t i = 0; i < 256U; ++i)
+  {
+    if (((xSim.aulPend[i >> 5] & xSim.aulEnable[i >> 5]) >> (i & 31U)) & 1U)
+    {
+      if ((iBest < 0) || (xSim.aucPrio[i] < xSim.aucPrio[iBest])) iBest = (int)i;
+    }
+  }
+  if (iBest < 0) return -1;
+  if ((xSim.ulThreshold != 0U) && (xSim.aucPrio[iBest] >= (xSim.ulThreshold & 0xFFU))) return -1;
+  if (xSim.ulDepth > 0U)
+  {
+    uint8_t ucActive = xSim.aucPrio[xSim.axLevel[xSim.ulDepth - 1U].ucIRQn];
+    if (((xSim.ulIntsyscr & INTSYSCR_INESTEN) == 0U) || (xSim.ulDepth >= SIM_NEST_MAX)) return -1;
+    if (((xSim.aucPrio[iBest] & 0x80U) != 0U) || ((ucActive & 0x80U) == 0U)) return -1;
+  }
+  return iBest;
+}
+
+/* ############################# Memory ##################################### */
+/*!****************************************************************************
+ * @brief
+ * Advance SysTick by a number of core clocks
+ *
+ * @param[in] clocks      Elapsed core clocks
+ * @date  16.10.2026
+ ******************************************************************************/
+static void prvSysTickAdvance(uint64_t clocks)
+{
+  uint64_t ullCounts;
+  uint32_t ulDiv;
+
+  if ((xSim.ulStCtlr & SYSTICK_CTLR_STE) == 0U) return;
+  ulDiv = (xSim.ulStCtlr & SYSTICK_CTLR_STCLK) ? 1U : 8U;
+  ullCounts = (xSim.ulStPresc + clocks) / ulDiv;
+  xSim.ulStPresc = (uint32_t)((xSim.ulStPresc + clocks) % ulDiv);
+
+  while (ullCounts != 0U)
+  {
+    uint64_t ullSteps, ullPeriod = 0;
+
+    /* Counts to the next compare match; with STRE the counter runs 0..CMPR   */
+    if ((xSim.ulStCtlr & SYSTICK_CTLR_STRE) && (xSim.ulStCntr <= xSim.ulStCmpr))
+    {
+      ullPeriod = (uint64_t)xSim.ulStCmpr + 1U;
+      ullSteps = (xSim.ulStCntr < xSim.ulStCmpr) ? (xSim.ulStCmpr - xSim.ulStCntr) : ullPeriod;
+    }
+    else
+    {
+      ullSteps = (uint32_t)(xSim.ulStCmpr - xSim.ulStCntr);
+      if (ullSteps == 0U) ullSteps = 1ULL << 32;
+    }
+
+    if (ullCounts < ullSteps)
+    {
+      xSim.ulStCntr = ullPeriod ? (uint32_t)((xSim.ulStCntr + ullCounts) % ullPeriod)
+                                : (uint32_t)(xSim.ulStCntr + ullCounts);
+      break;
+    }
+    ullCounts -= ullSteps;
+    xSim.ulStCntr = xSim.ulStCmpr;
+    xSim.ulStSr |= SYSTICK_SR_CNTIF;
+    if (xSim.ulStCtlr & SYSTICK_CTLR_STIE) prvPend(SYSTICK_IRQN);
+  }
+}
+
+/*!****************************************************************************
+ * @brief
+ * Core clocks until the next SysTick compare match
+ *
+ * @return  (uint64_t)  Clocks, 0 if the counter is stopped
+ * @date  16.10.2026
+ ******************************************************************************/
+static uint64_t prvSysTickNext(void)
+{
+  uint64_t ullSteps;
+  uint32_t ulDiv;
+
+  if ((xSim.ulStCtlr & SYSTICK_CTLR_STE) == 0U) return 0;
+  ulDiv = (xSim.ulStCtlr & SYSTICK_CTLR_STCLK) ? 1U : 8U;
+  if ((xSim.ulStCtlr & SYSTICK_CTLR_STRE) && (xSim.ulStCntr <= xSim.ulStCmpr))
+  {
+    ullSteps = (xSim.ulStCntr < xSim.ulStCmpr) ? (xSim.ulStCmpr - xSim.ulStCntr) : ((uint64_t)xSim.ulStCmpr + 1U);
+  }
+  else
+  {
+    ullSteps = (uint32_t)(xSim.ulStCmpr - xSim.ulStCntr);
+    if (ullSteps == 0U) ullSteps = 1ULL << 32;
+  }
+  return ullSteps * ulDiv - xSim.ulStPresc;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Read PFIC register
+ *
+ * @param[in] offset      Word-aligned register offset
+ * @return  (uint32_t)  Register value
+ * @date  16.10.2026
+ ******************************************************************************/
+static uint32_t prvPficRead(uint32_t offset)
+{
+  uint32_t ulIdx = (offset >> 2) & 7U;
+
+  if (offset < 0x020U) return xSim.aulEnable[ulIdx];
+  if (offset < 0x040U) return xSim.aulPend[ulIdx];
+  if (offset == 0x040U) return xSim.ulThreshold;
+  if (offset == 0x04CU)
+  {
+    return ((1UL << xSim.ulDepth) - 1U) | ((xSim.ulDepth != 0U) ? 0x100U : 0U) |
+           (prvWakePending(0) ? 0x200U : 0U);
+  }
+  if (offset == 0x050U) return xSim.ulVtfId;
+  if ((offset >= 0x060U) && (offset < 0x070U)) return xSim.aulVtfAddr[ulIdx & 3U];
+  if ((offset >= 0x300U) && (offset < 0x320U)) return xSim.aulActive[ulIdx];
+  if ((offset >= 0x400U) && (offset < 0x500U)) return prvRd32(&xSim.aucPrio[offset - 0x400U]);
+  if (offset == 0xD10U) return xSim.ulSctlr;
+  return 0;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Write PFIC register
+ *
+ * @param[in] offset      Word-aligned register offset
+ * @param[in] value       Value, positioned in the word
+ * @param[in] mask        Written byte lanes
+ * @date  16.10.2026
+ ******************************************************************************/
+static void prvPficWrite(uint32_t offset, uint32_t value, uint32_t mask)
+{
+  uint32_t ulIdx = (offset >> 2) & 7U;
+
+  value &= mask;
+  if ((offset >= 0x100U) && (offset < 0x120U)) xSim.aulEnable[ulIdx] |= value;
+  else if ((offset >= 0x180U) && (offset < 0x1A0U)) xSim.aulEnable[ulIdx] &= ~value;
+  else if ((offset >= 0x200U) && (offset < 0x220U))
+  {
+    for (uint32_t i = 0; i < 32U; ++i)
+    {
+      if (value & (1UL << i)) prvPend(ulIdx * 32U + i);
+    }
+  }
+  else if ((offset >= 0x280U) && (offset < 0x2A0U)) xSim.aulPend[ulIdx] &= ~value;
+  else if ((offset >= 0x400U) && (offset < 0x500U))
+  {
+    for (uint32_t i = 0; i < 4U; ++i)
+    {
+      if (mask & (0xFFUL << (8U * i))) xSim.aucPrio[offset - 0x400U + i] = (uint8_t)(value >> (8U * i));
+    }
+  }
+  else if (offset == 0x040U) xSim.ulThreshold = (xSim.ulThreshold & ~mask) | value;
+  else if (offset == 0x048U)
+  {
+    if (((value & 0xFFFF0000UL) == PFIC_CFGR_KEY3) && (value & PFIC_CFGR_RESETSYS)) prvStop("system reset", 0);
+  }
+  else if (offset == 0x050U) xSim.ulVtfId = (xSim.ulVtfId & ~mask) | value;
+  else if ((offset >= 0x060U) && (offset < 0x070U))
+  {
+    xSim.aulVtfAddr[ulIdx & 3U] = (xSim.aulVtfAddr[ulIdx & 3U] & ~mask) | value;
+  }
+  else if (offset == 0xD10U)
+  {
+    if (value & PFIC_SCTLR_SETEVENT) xSim.ucEvent = 1U;
+    if (value & PFIC_SCTLR_SYSRESET) prvStop("system reset", 0);
+    xSim.ulSctlr = (xSim.ulSctlr & ~mask) | (value & ~(PFIC_SCTLR_SETEVENT | PFIC_SCTLR_SYSRESET));
+  }
+}
+
+/*!****************************************************************************
+ * @brief
+ * Read SysTick register
+ *
+ * @param[in] offset      Word-aligned register offset
+ * @return  (uint32_t)  Register value
+ * @date  16.10.2026
+ ******************************************************************************/
+static uint32_t prvSysTickRead(uint32_t offset)
+{
+  switch (offset)
+  {
+    case 0x00U: return xSim.ulStCtlr;
+    case 0x04U: return xSim.ulStSr;
+    case 0x08U: return xSim.ulStCntr;
+    case 0x10U: return xSim.ulStCmpr;
+    default:    return 0;
+  }
+}
+
+/*!****************************************************************************
+ * @brief
+ * Write SysTick register
+ *
+ * @param[in] offset      Word-aligned register offset
+ * @param[in] value       Value, positioned in the word
+ * @param[in] mask        Written byte lanes
+ * @date  16.10.2026
+ ******************************************************************************/
+static void prvSysTickWrite(uint32_t offset, uint32_t value, uint32_t mask)
+{
+  value &= mask;
+  switch (offset)
+  {
+    case 0x00U: xSim.ulStCtlr = (xSim.ulStCtlr & ~mask) | value; break;
+    case 0x04U: xSim.ulStSr &= value | ~mask; break;    /* Write 0 to clear   */
+    case 0x08U: xSim.ulStCntr = (xSim.ulStCntr & ~mask) | value; break;
+    case 0x10U: xSim.ulStCmpr = (xSim.ulStCmpr & ~mask) | value; break;
+    default: break;
+  }
+}
+
+/*!****************************************************************************
+ * @brief
+ * Check whether an address lies in flash
+ *
+ * @param[in] addr        Address
+ * @return  (int)  Non-zero for flash (including the alias)
+ * @date  16.10.2026
+ ******************************************************************************/
+static int prvIsFlash(uint32_t addr)
+{
+  return (addr < xSim.ulFlashSize) || ((addr - SIM_FLASH_ALIAS) < xSim.ulFlashSize);
+}
+
+/*!****************************************************************************
+ * @brief
+ * Map plain memory address
+ *
+ * @param[in] addr        Address
+ * @param[in] size        Access size
+ * @param[in] write       Non-zero for a write access
+ * @return  (uint8_t*)  Host pointer, NULL if not plain memory
+ * @date  16.10.2026
+ ******************************************************************************/
+static uint8_t* prvMap(uint32_t addr, uint32_t size, int write)
+{
+  if ((addr < xSim.ulFlashSize) && (size <= xSim.ulFlashSize - addr))
+  {
+    return write ? NULL : xSim.pucFlash + addr;
+  }
+  if ((addr - SIM_FLASH_ALIAS < xSim.ulFlashSize) && (size <= xSim.ulFlashSize - (addr - SIM_FLASH_ALIAS)))
+  {
+    return write ? NULL : xSim.pucFlash + (addr - SIM_FLASH_ALIAS);
+  }
+  if ((addr - SIM_SRAM_BASE < xSim.ulSramSize) && (size <= xSim.ulSramSize - (addr - SIM_SRAM_BASE)))
+  {
+    return xSim.pucSram + (addr - SIM_SRAM_BASE);
+  }
+  if (addr - SIM_PERIPH_BASE < SIM_PERIPH_SIZE) return xSim.pucPeriph + (addr - SIM_PERIPH_BASE);
+  return NULL;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Load from memory
+ *
+ * @param[in] addr        Address (aligned to size)
+ * @param[in] size        Access size (1, 2, 4)
+ * @param[out] value      Loaded value, zero-extended
+ * @return  (int)  0 on success, -1 on access fault
+ * @date  16.10.2026
+ ******************************************************************************/
+static int prvLoad(uint32_t addr, uint32_t size, uint32_t* value)
+{
+  uint8_t* pucMem;
+  uint32_t ulWord;
+
+  if ((addr & (size - 1U)) != 0U) return -1;
+  pucMem = prvMap(addr, size, 0);
+  if (pucMem != NULL)
+  {
+    *value = (size == 4U) ? prvRd32(pucMem) : (size == 2U) ? prvRd16(pucMem) : pucMem[0];
+    return 0;
+  }
+  if (addr - SIM_PFIC_BASE < 0x1000U) ulWord = prvPficRead((addr - SIM_PFIC_BASE) & ~3UL);
+  else if (addr - SIM_SYSTICK_BASE < 0x100U) ulWord = prvSysTickRead((addr - SIM_SYSTICK_BASE) & ~3UL);
+  else return -1;
+
+  ulWord >>= 8U * (addr & 3U);
+  *value = (size == 4U) ? ulWord : (size == 2U) ? (ulWord & 0xFFFFU) : (ulWord & 0xFFU);
+  return 0;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Store to memory
+ *
+ * @param[in] addr        Address (aligned to size)
+ * @param[in] size        Access size (1, 2, 4)
+ * @param[in] value       Value to store
+ * @return  (int)  0 on success, -1 on access fault
+ * @date  16.10.2026
+ ******************************************************************************/
+static int prvStore(uint32_t addr, uint32_t size, uint32_t value)
+{
+  uint8_t* pucMem;
+  uint32_t ulShift = 8U * (addr & 3U);
+  uint32_t ulMask = ((size == 4U) ? 0xFFFFFFFFUL : ((1UL << (8U * size)) - 1U)) << ulShift;
+
+  if ((addr & (size - 1U)) != 0U) return -1;
+  pucMem = prvMap(addr, size, 1);
+  if (pucMem != NULL)
+  {
+    for (uint32_t i = 0; i < size; ++i) pucMem[i] = (uint8_t)(value >> (8U * i));
+    return 0;
+  }
+  if (addr - SIM_PFIC_BASE < 0x1000U) prvPficWrite((addr - SIM_PFIC_BASE) & ~3UL, value << ulShift, ulMask);
+  else if (addr - SIM_SYSTICK_BASE < 0x100U)
+  {
+    prvSysTickWrite((addr - SIM_SYSTICK_BASE) & ~3UL, value << ulShift, ulMask);
+  }
+  else return -1;
+  return 0;
+}
+
+/* ############################### Core ##################################### */
+/*!****************************************************************************
+ * @brief
+ * Advance time by the cost of the current step
+ *
+ * @param[in] cycles      Active core cycles
+ * @date  16.10.2026
+ ******************************************************************************/
+static void prvAdvance(uint32_t cycles)
+{
+  xSim.ullCycle += cycles;
+  xSim.ullTime += cycles;
+  prvSysTickAdvance(cycles);
+}
+
+/*!****************************************************************************
+ * @brief
+ * Pend injected interrupts that are due, and the SysTick software interrupt
+ *
+ * @date  16.10.2026
+ ******************************************************************************/
+static void prvPoll(void)
+{
+  for (uint32_t i = 0; i < ulInjects; ++i)
+  {
+    if (!axInject[i].ucDone && (axInject[i].ullTime <= xSim.ullTime))
+    {
+      axInject[i].ucDone = 1U;
+      prvPend(axInject[i].ucIRQn);
+    }
+  }
+  if ((xSim.ulStCtlr & SYSTICK_CTLR_SWIE) &&
+      !((xSim.aulActive[SYSTICK_IRQN >> 5] >> (SYSTICK_IRQN & 31U)) & 1U))
+  {
+    prvPend(SYSTICK_IRQN);
+  }
+}
+
+/*!****************************************************************************
+ * @brief
+ * Enter trap handler (interrupt or ecall)
+ *
+ * @param[in] IRQn        Vector number
+ * @param[in] cause       mcause value
+ * @param[in] epc         Return address (mepc)
+ * @return  (int)  0 on success, -1 if the vector cannot be fetched
+ * @date  16.10.2026
+ ******************************************************************************/
+static int prvEnter(uint32_t IRQn, uint32_t cause, uint32_t epc)
+{
+  Level_t* pxLevel = &xSim.axLevel[xSim.ulDepth];
+  uint32_t ulBase = xSim.ulMtvec & ~3UL;
+  uint32_t ulTarget = ulBase, ulCost = ulPenalty;
+  uint32_t ulBit = 1UL << (IRQn & 31U);
+  int iVtf = 0;
+  Sym_t* pxSym;
+
+  /* Vector: VTF, else table of addresses, table of jumps or common entry     */
+  for (uint32_t k = 0; (k < 4U) && !iVtf; ++k)
+  {
+    if ((xSim.aulVtfAddr[k] & 1U) && (((xSim.ulVtfId >> (8U * k)) & 0xFFU) == IRQn))
+    {
+      ulTarget = xSim.aulVtfAddr[k] & ~1UL;
+      iVtf = 1;
+    }
+  }
+  if (!iVtf && ((xSim.ulMtvec & 3U) == 3U))
+  {
+    if (prvLoad(ulBase + 4U * IRQn, 4U, &ulTarget) != 0) return -1;
+    if (prvIsFlash(ulBase + 4U * IRQn)) ulCost += ulWait;
+    ulTarget &= ~1UL;
+  }
+  else if (!iVtf && (xSim.ulMtvec & 1U))
+  {
+    ulTarget = ulBase + 4U * IRQn;
+  }
+  if (prvIsFlash(ulTarget)) ulCost += ulWait;
+
+  pxLevel->ucIRQn = (uint8_t)IRQn;
+  pxLevel->ulMepc = xSim.ulMepc;
+  pxLevel->ulMcause = xSim.ulMcause;
+  pxLevel->ulMpie = xSim.ulMstatus & MSTATUS_MPIE;
+  pxLevel->ullEntry = xSim.ullCycle;
+  pxLevel->ucHpe = (uint8_t)(xSim.ulIntsyscr & INTSYSCR_HWSTKEN);
+  if (pxLevel->ucHpe)
+  {
+    for (uint32_t i = 0; i < sizeof(aucHpeRegs); ++i) pxLevel->aulHpe[i] = xSim.x[aucHpeRegs[i]];
+  }
+  ++xSim.ulDepth;
+
+  xSim.ulMepc = epc;
+  xSim.ulMcause = cause;
+  xSim.ulMstatus = (xSim.ulMstatus & ~MSTATUS_MPIE) | ((xSim.ulMstatus & MSTATUS_MIE) ? MSTATUS_MPIE : 0U);
+  if ((xSim.ulIntsyscr & INTSYSCR_INESTEN) == 0U) xSim.ulMstatus &= ~MSTATUS_MIE;
+  if ((xSim.aulPend[IRQn >> 5] & ulBit) &&
+      (xSim.axIrq[IRQn].ullLatMax < xSim.ullTime - xSim.axIrq[IRQn].ullPend))
+  {
+    xSim.axIrq[IRQn].ullLatMax = xSim.ullTime - xSim.axIrq[IRQn].ullPend;
+  }
+  xSim.aulPend[IRQn >> 5] &= ~ulBit;
+  xSim.aulActive[IRQn >> 5] |= ulBit;
+  pxSym = prvSymAt(ulTarget);
+  if (pxSym->ulAddr == ulTarget) ++pxSym->ullCalls;
+  pxSym->ullCycles += ulCost;
+  xSim.ulPc = ulTarget;
+  prvAdvance(ulCost);
+  return 0;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Return from trap handler (mret)
+ *
+ * @date  16.10.2026
+ ******************************************************************************/
+static void prvReturn(void)
+{
+  xSim.ulNextPc = xSim.ulMepc;
+  xSim.ulCost += ulPenalty + (prvIsFlash(xSim.ulNextPc) ? ulWait : 0U);
+  xSim.ulMstatus = (xSim.ulMstatus & ~MSTATUS_MIE) | ((xSim.ulMstatus & MSTATUS_MPIE) ? MSTATUS_MIE : 0U);
+  xSim.ulMstatus |= MSTATUS_MPIE;
+
+  if (xSim.ulDepth > 0U)
+  {
+    Level_t* pxLevel = &xSim.axLevel[--xSim.ulDepth];
+    Irq_Stats_t* pxIrq = &xSim.axIrq[pxLevel->ucIRQn];
+    uint64_t ullCycles = xSim.ullCycle + xSim.ulCost - pxLevel->ullEntry;
+
+    xSim.aulActive[pxLevel->ucIRQn >> 5] &= ~(1UL << (pxLevel->ucIRQn & 31U));
+    if (pxLevel->ucHpe)
+    {
+      for (uint32_t i = 0; i < sizeof(aucHpeRegs); ++i) xSim.x[aucHpeRegs[i]] = pxLevel->aulHpe[i];
+    }
+    xSim.ulMepc = pxLevel->ulMepc;
+    xSim.ulMcause = pxLevel->ulMcause;
+    xSim.ulMstatus = (xSim.ulMstatus & ~MSTATUS_MPIE) | pxLevel->ulMpie;
+
+    if ((pxIrq->ullCount == 0U) || (ullCycles < pxIrq->ullMin)) pxIrq->ullMin = ullCycles;
+    if (ullCycles > pxIrq->ullMax) pxIrq->ullMax = ullCycles;
+    pxIrq->ullCycles += ullCycles;
+    ++pxIrq->ullCount;
+  }
+}
+
+/*!****************************************************************************
+ * @brief
+ * Time until the next event that may wake the core or raise an interrupt
+ *
+ * @param[in] any         Also count interrupts that are not enabled (SEVONPEND)
+ * @return  (uint64_t)  Core clocks to the next SysTick compare match or
+ *                      injected interrupt, 0 if there is none
+ * @date  16.10.2026
+ ******************************************************************************/
+static uint64_t prvNextEvent(int any)
+{
+  uint64_t ullNext = 0, ullTick = prvSysTickNext();
+
+  if ((ullTick != 0U) && (xSim.ulStCtlr & SYSTICK_CTLR_STIE) &&
+      (any || ((xSim.aulEnable[SYSTICK_IRQN >> 5] >> (SYSTICK_IRQN & 31U)) & 1U)))
+  {
+    ullNext = ullTick;
+  }
+  for (uint32_t i = 0; i < ulInjects; ++i)
+  {
+    uint64_t ullDelta = axInject[i].ullTime - xSim.ullTime;
+    if (!axInject[i].ucDone && ((ullNext == 0U) || (ullDelta < ullNext))) ullNext = ullDelta;
+  }
+  return ullNext;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Sleep until a wakeup (WFI, or WFE with SCTLR.WFITOWFE)
+ *
+ * Time is fast-forwarded to the next SysTick compare match or injected
+ * interrupt. The simulation stops if no wakeup source is left.
+ *
+ * @date  16.10.2026
+ ******************************************************************************/
+static void prvSleep(void)
+{
+  int iWfe = (xSim.ulSctlr & PFIC_SCTLR_WFITOWFE) != 0U;
+  int iAny = iWfe && (xSim.ulSctlr & PFIC_SCTLR_SEVONPEND);
+
+  xSim.ulSctlr &= ~PFIC_SCTLR_WFITOWFE;
+  if (iWfe && xSim.ucEvent)
+  {
+    xSim.ucEvent = 0;
+    return;
+  }
+
+  for (;;)
+  {
+    uint64_t ullNext;
+
+    prvPoll();
+    if (prvWakePending(iAny)) break;
+    ullNext = prvNextEvent(iAny);
+    if (ullNext == 0U)
+    {
+      prvStop("sleep without wakeup source", 0);
+      return;
+    }
+    xSim.ullTime += ullNext;
+    xSim.ullSleep += ullNext;
+    prvSysTickAdvance(ullNext);
+  }
+  if (iWfe) xSim.ucEvent = 0;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Fast-forward a jump-to-self loop to the next interrupt
+ *
+ * Charges whole loop iterations to the loop's symbol, as if executed. The
+ * simulation stops if no interrupt can end the loop.
+ *
+ * @param[in] sym         Symbol of the loop
+ * @date  16.10.2026
+ ******************************************************************************/
+static void prvSpin(Sym_t* sym)
+{
+  uint64_t ullNext, ullIter;
+
+  if (!(xSim.ulMstatus & MSTATUS_MIE) || prvWakePending(0)) return;
+  ullNext = prvNextEvent(0);
+  if (ullNext == 0U)
+  {
+    prvStop("jump to self", 0);
+    return;
+  }
+  /* The current iteration is charged by prvStep()                            */
+  ullIter = (ullNext + xSim.ulCost - 1U) / xSim.ulCost - 1U;
+  xSim.ullInstret += ullIter;
+  xSim.ullBranches += ullIter;
+  sym->ullInstr += ullIter;
+  sym->ullCycles += ullIter * xSim.ulCost;
+  xSim.ullCycle += ullIter * xSim.ulCost;
+  xSim.ullTime += ullIter * xSim.ulCost;
+  prvSysTickAdvance(ullIter * xSim.ulCost);
+}
+
+/*!****************************************************************************
+ * @brief
+ * Read CSR
+ *
+ * @param[in] csr         CSR number
+ * @param[out] value      CSR value
+ * @return  (int)  0 on success, -1 if not implemented
+ * @date  16.10.2026
+ ******************************************************************************/
+static int prvCsrRead(uint32_t csr, uint32_t* value)
+{
+  switch (csr)
+  {
+    case 0x300U: *value = xSim.ulMstatus; break;
+    case 0x301U: *value = SIM_MISA; break;
+    case 0x304U: case 0x344U: *value = 0; break;        /* mie, mip           */
+    case 0x305U: *value = xSim.ulMtvec; break;
+    case 0x340U: *value = xSim.ulMscratch; break;
+    case 0x341U: *value = xSim.ulMepc; break;
+    case 0x342U: *value = xSim.ulMcause; break;
+    case 0x343U: *value = xSim.ulMtval; break;
+    case 0x7C0U: *value = xSim.ulDebugcr; break;
+    case 0x804U: *value = xSim.ulIntsyscr; break;
+    case 0xB00U: case 0xC00U: *value = (uint32_t)xSim.ullCycle; break;
+    case 0xB80U: case 0xC80U: *value = (uint32_t)(xSim.ullCycle >> 32); break;
+    case 0xB02U: case 0xC02U: *value = (uint32_t)xSim.ullInstret; break;
+    case 0xB82U: case 0xC82U: *value = (uint32_t)(xSim.ullInstret >> 32); break;
+    case 0xF11U: case 0xF12U: case 0xF13U: case 0xF14U: *value = 0; break;
+    default: return -1;
+  }
+  return 0;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Write CSR
+ *
+ * @param[in] csr         CSR number
+ * @param[in] value       New value
+ * @return  (int)  0 on success, -1 if not implemented or read-only
+ * @date  16.10.2026
+ ******************************************************************************/
+static int prvCsrWrite(uint32_t csr, uint32_t value)
+{
+  switch (csr)
+  {
+    case 0x300U: xSim.ulMstatus = (value & (MSTATUS_MIE | MSTATUS_MPIE)) | MSTATUS_MPP; break;
+    case 0x304U: case 0x344U: break;
+    case 0x305U: xSim.ulMtvec = value; break;
+    case 0x340U: xSim.ulMscratch = value; break;
+    case 0x341U: xSim.ulMepc = value & ~1UL; break;
+    case 0x342U: xSim.ulMcause = value; break;
+    case 0x343U: xSim.ulMtval = value; break;
+    case 0x7C0U: xSim.ulDebugcr = value; break;
+    case 0x804U: xSim.ulIntsyscr = value; break;
+    case 0xB00U: xSim.ullCycle = (xSim.ullCycle & 0xFFFFFFFF00000000ULL) | value; break;
+    case 0xB80U: xSim.ullCycle = (xSim.ullCycle & 0xFFFFFFFFULL) | ((uint64_t)value << 32); break;
+    case 0xB02U: xSim.ullInstret = (xSim.ullInstret & 0xFFFFFFFF00000000ULL) | value; break;
+    case 0xB82U: xSim.ullInstret = (xSim.ullInstret & 0xFFFFFFFFULL) | ((uint64_t)value << 32); break;
+    default: return -1;
+  }
+  return 0;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Expand compressed instruction to its 32-bit equivalent
+ *
+ * @param[in] ins         16-bit instruction
+ * @return  (uint32_t)  32-bit instruction, ENC_ILLEGAL if not valid on RV32EC
+ * @date  16.10.2026
+ ******************************************************************************/
+static uint32_t prvExpand(uint32_t ins)
+{
+  uint32_t ulRd = (ins >> 7) & 31U, ulRs2 = (ins >> 2) & 31U;
+  uint32_t ulRdc = 8U + ((ins >> 2) & 7U), ulRs1c = 8U + ((ins >> 7) & 7U);
+  uint32_t ulImm6 = prvSext(((ins >> 7) & 0x20U) | ((ins >> 2) & 0x1FU), 6U);
+  uint32_t ulImm;
+
+  switch (((ins & 3U) << 3) | (ins >> 13))
+  {
+    case 0x00U:                                         /* c.addi4spn         */
+      ulImm = ((ins >> 7) & 0x30U) | ((ins >> 1) & 0x3C0U) | ((ins >> 4) & 4U) | ((ins >> 2) & 8U);
+      return (ulImm != 0U) ? ENC_I(ulImm, 2U, 0U, ulRdc, 0x13U) : ENC_ILLEGAL;
+    case 0x02U:                                         /* c.lw               */
+      ulImm = ((ins >> 7) & 0x38U) | ((ins << 1) & 0x40U) | ((ins >> 4) & 4U);
+      return ENC_I(ulImm, ulRs1c, 2U, ulRdc, 0x03U);
+    case 0x06U:                                         /* c.sw               */
+      ulImm = ((ins >> 7) & 0x38U) | ((ins << 1) & 0x40U) | ((ins >> 4) & 4U);
+      return ENC_S(ulImm, ulRdc, ulRs1c, 2U);
+    case 0x08U:                                         /* c.addi, c.nop      */
+      return ENC_I(ulImm6, ulRd, 0U, ulRd, 0x13U);
+    case 0x09U:                                         /* c.jal              */
+    case 0x0DU:                                         /* c.j                */
+      ulImm = prvSext(((ins >> 1) & 0x800U) | ((ins >> 7) & 0x10U) | ((ins >> 1) & 0x300U) |
+                      ((ins << 2) & 0x400U) | ((ins >> 1) & 0x40U) | ((ins << 1) & 0x80U) |
+                      ((ins >> 2) & 0xEU) | ((ins << 3) & 0x20U), 12U);
+      return ENC_J(ulImm, ((ins >> 13) == 1U) ? 1U : 0U);
+    case 0x0AU:                                         /* c.li               */
+      return ENC_I(ulImm6, 0U, 0U, ulRd, 0x13U);
+    case 0x0BU:
+      if (ulRd == 2U)                                   /* c.addi16sp         */
+      {
+        ulImm = prvSext(((ins >> 3) & 0x200U) | ((ins >> 2) & 0x10U) | ((ins << 1) & 0x40U) |
+                        ((ins << 4) & 0x180U) | ((ins << 3) & 0x20U), 10U);
+        return (ulImm != 0U) ? ENC_I(ulImm, 2U, 0U, 2U, 0x13U) : ENC_ILLEGAL;
+      }
+      ulImm = prvSext(((ins << 5) & 0x20000U) | ((ins << 10) & 0x1F000U), 18U);
+      return (ulImm != 0U) ? ((ulImm & 0xFFFFF000UL) | (ulRd << 7) | 0x37U) : ENC_ILLEGAL;
+    case 0x0CU:
+      switch ((ins >> 10) & 3U)
+      {
+        case 0U:                                        /* c.srli             */
+          return (ins & 0x1000U) ? ENC_ILLEGAL : ENC_R(0x00U, ulRs2, ulRs1c, 5U, ulRs1c, 0x13U);
+        case 1U:                                        /* c.srai             */
+          return (ins & 0x1000U) ? ENC_ILLEGAL : ENC_R(0x20U, ulRs2, ulRs1c, 5U, ulRs1c, 0x13U);
+        case 2U:                                        /* c.andi             */
+          return ENC_I(ulImm6, ulRs1c, 7U, ulRs1c, 0x13U);
+        default:
+          if (ins & 0x1000U) return ENC_ILLEGAL;
+          switch ((ins >> 5) & 3U)
+          {
+            case 0U: return ENC_R(0x20U, ulRdc, ulRs1c, 0U, ulRs1c, 0x33U);   /* c.sub    */
+            case 1U: return ENC_R(0x00U, ulRdc, ulRs1c, 4U, ulRs1c, 0x33U);   /* c.xor    */
+            case 2U: return ENC_R(0x00U, ulRdc, ulRs1c, 6U, ulRs1c, 0x33U);   /* c.or     */
+            default: return ENC_R(0x00U, ulRdc, ulRs1c, 7U, ulRs1c, 0x33U);   /* c.and    */
+          }
+      }
+    case 0x0EU:                                         /* c.beqz             */
+    case 0x0FU:                                         /* c.bnez             */
+      ulImm = prvSext(((ins >> 4) & 0x100U) | ((ins >> 7) & 0x18U) | ((ins << 1) & 0xC0U) |
+                      ((ins >> 2) & 6U) | ((ins << 3) & 0x20U), 9U);
+      return ENC_B(ulImm, 0U, ulRs1c, ((ins >> 13) == 6U) ? 0U : 1U);
+    case 0x10U:                                         /* c.slli             */
+      return (ins & 0x1000U) ? ENC_ILLEGAL : ENC_R(0x00U, ulRs2, ulRd, 1U, ulRd, 0x13U);
+    case 0x12U:                                         /* c.lwsp             */
+      ulImm = ((ins >> 7) & 0x20U) | ((ins >> 2) & 0x1CU) | ((ins << 4) & 0xC0U);
+      return (ulRd != 0U) ? ENC_I(ulImm, 2U, 2U, ulRd, 0x03U) : ENC_ILLEGAL;
+    case 0x14U:
+      if ((ins & 0x1000U) == 0U)
+      {
+        if (ulRs2 != 0U) return ENC_R(0x00U, ulRs2, 0U, 0U, ulRd, 0x33U);        /* c.mv     */
+        return (ulRd != 0U) ? ENC_I(0U, ulRd, 0U, 0U, 0x67U) : ENC_ILLEGAL;      /* c.jr     */
+      }
+      if (ulRs2 != 0U) return ENC_R(0x00U, ulRs2, ulRd, 0U, ulRd, 0x33U);        /* c.add    */
+      if (ulRd == 0U) return 0x00100073UL;                                       /* c.ebreak */
+      return ENC_I(0U, ulRd, 0U, 1U, 0x67U);                                     /* c.jalr   */
+    case 0x16U:                                         /* c.swsp             */
+      ulImm = ((ins >> 7) & 0x3CU) | ((ins >> 1) & 0xC0U);
+      return ENC_S(ulImm, ulRs2, 2U, 2U);
+    default:
+      return ENC_ILLEGAL;
+  }
+}
+
+/*!****************************************************************************
+ * @brief
+ * Take jump or branch: set target and charge the refill penalty
+ *
+ * @param[in] target      Target address
+ * @date  16.10.2026
+ ******************************************************************************/
+static void prvJump(uint32_t target)
+{
+  xSim.ulNextPc = target;
+  xSim.ulCost += ulPenalty + (prvIsFlash(target) ? ulWait : 0U);
+  ++xSim.ullBranches;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Count call of a symbol (jal/jalr with rd = ra)
+ *
+ * @param[in] target      Call target
+ * @date  16.10.2026
+ ******************************************************************************/
+static void prvCall(uint32_t target)
+{
+  Sym_t* pxSym = prvSymAt(target);
+  if (pxSym->ulAddr == target) ++pxSym->ullCalls;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Execute one 32-bit (or expanded) instruction
+ *
+ * Sets xSim.ulNextPc and adds to xSim.ulCost.
+ *
+ * @param[in] ins         Instruction
+ * @param[in] len         Encoded length (2 or 4)
+ * @date  16.10.2026
+ ******************************************************************************/
+static void prvExecute(uint32_t ins, uint32_t len)
+{
+  uint32_t ulRd = (ins >> 7) & 31U, ulRs1 = (ins >> 15) & 31U, ulRs2 = (ins >> 20) & 31U;
+  uint32_t ulF3 = (ins >> 12) & 7U, ulF7 = ins >> 25;
+  uint32_t ulImmI = (uint32_t)((int32_t)ins >> 20);
+  uint32_t ulA, ulB, ulResult = 0, ulAddr;
+  int iWrite = 1;
+
+  xSim.ulNextPc = xSim.ulPc + len;
+  ulA = xSim.x[ulRs1 & 15U];
+  ulB = xSim.x[ulRs2 & 15U];
+
+  /* RV32E: only x0..x15 (fields holding immediates are not checked)          */
+  switch (ins & 0x7FU)
+  {
+    case 0x37U: case 0x17U: case 0x6FU: if (ulRd > 15U) goto illegal; break;
+    case 0x63U: case 0x23U: if ((ulRs1 | ulRs2) > 15U) goto illegal; break;
+    case 0x33U: if ((ulRd | ulRs1 | ulRs2) > 15U) goto illegal; break;
+    case 0x73U: if ((ulRd > 15U) || (!(ulF3 & 4U) && (ulRs1 > 15U))) goto illegal; break;
+    case 0x0FU: break;
+    default: if ((ulRd | ulRs1) > 15U) goto illegal; break;
+  }
+
+  switch (ins & 0x7FU)
+  {
+    case 0x37U:                                         /* lui                */
+      ulResult = ins & 0xFFFFF000UL;
+      break;
+    case 0x17U:                                         /* auipc              */
+      ulResult = xSim.ulPc + (ins & 0xFFFFF000UL);
+      break;
+    case 0x6FU:                                         /* jal                */
+      ulResult = xSim.ulPc + len;
+      ulAddr = xSim.ulPc + (((uint32_t)((int32_t)(ins & 0x80000000UL) >> 11)) | (ins & 0xFF000UL) |
+                            ((ins >> 9) & 0x800U) | ((ins >> 20) & 0x7FEU));
+      if (ulRd == 1U) prvCall(ulAddr);
+      prvJump(ulAddr);
+      if (ulAddr == xSim.ulPc)
+      {
+        prvSpin(prvSymAt(ulAddr));
+      }
+      break;
+    case 0x67U:                                         /* jalr               */
+      if (ulF3 != 0U) goto illegal;
+      ulResult = xSim.ulPc + len;
+      ulAddr = (ulA + ulImmI) & ~1UL;
+      if (ulRd == 1U) prvCall(ulAddr);
+      prvJump(ulAddr);
+      break;
+    case 0x63U:                                         /* branches           */
+    {
+      int iTaken;
+      switch (ulF3)
+      {
+        case 0U: iTaken = (ulA == ulB); break;
+        case 1U: iTaken = (ulA != ulB); break;
+        case 4U: iTaken = ((int32_t)ulA < (int32_t)ulB); break;
+        case 5U: iTaken = ((int32_t)ulA >= (int32_t)ulB); break;
+        case 6U: iTaken = (ulA < ulB); break;
+        case 7U: iTaken = (ulA >= ulB); break;
+        default: goto illegal;
+      }
+      if (iTaken)
+      {
+        prvJump(xSim.ulPc + (((uint32_t)((int32_t)(ins & 0x80000000UL) >> 19)) | ((ins & 0x80U) << 4) |
+                             ((ins >> 20) & 0x7E0U) | ((ins >> 7) & 0x1EU)));
+      }
+      iWrite = 0;
+      break;
+    }
+    case 0x03U:                                         /* loads              */
+    {
+      static const uint8_t aucSize[8] = { 1, 2, 4, 0, 1, 2, 0, 0 };
+      uint32_t ulSize = aucSize[ulF3];
+      if (ulSize == 0U) goto illegal;
+      ulAddr = ulA + ulImmI;
+      if (prvLoad(ulAddr, ulSize, &ulResult) != 0) goto fault;
+      if (ulF3 == 0U) ulResult = prvSext(ulResult, 8U);
+      if (ulF3 == 1U) ulResult = prvSext(ulResult, 16U);
+      if (prvIsFlash(ulAddr))
+      {
+        xSim.ulCost += ulWait;
+        ++xSim.ullFlashLoads;
+      }
+      break;
+    }
+    case 0x23U:                                         /* stores             */
+      if (ulF3 > 2U) goto illegal;
+      ulAddr = ulA + (((uint32_t)((int32_t)(ins & 0xFE000000UL) >> 20)) | ulRd);
+      if (prvStore(ulAddr, 1U << ulF3, xSim.x[ulRs2]) != 0) goto fault;
+      iWrite = 0;
+      break;
+    case 0x13U:                                         /* register-immediate */
+    case 0x33U:                                         /* register-register  */
+    {
+      uint32_t ulAlt;
+      if (ins & 0x20U)
+      {
+        if ((ulF7 != 0U) && (ulF7 != 0x20U)) goto illegal;
+        if ((ulF7 == 0x20U) && (ulF3 != 0U) && (ulF3 != 5U)) goto illegal;
+        ulAlt = (ulF7 == 0x20U);
+      }
+      else
+      {
+        ulB = ulImmI;
+        if ((ulF3 == 1U) && (ulF7 != 0U)) goto illegal;
+        if ((ulF3 == 5U) && (ulF7 != 0U) && (ulF7 != 0x20U)) goto illegal;
+        ulAlt = (ulF3 == 5U) && (ulF7 == 0x20U);
+      }
+      switch (ulF3)
+      {
+        case 0U: ulResult = ulAlt ? (ulA - ulB) : (ulA + ulB); break;
+        case 1U: ulResult = ulA << (ulB & 31U); break;
+        case 2U: ulResult = ((int32_t)ulA < (int32_t)ulB) ? 1U : 0U; break;
+        case 3U: ulResult = (ulA < ulB) ? 1U : 0U; break;
+        case 4U: ulResult = ulA ^ ulB; break;
+        case 5U: ulResult = ulAlt ? (uint32_t)((int32_t)ulA >> (ulB & 31U)) : (ulA >> (ulB & 31U)); break;
+        case 6U: ulResult = ulA | ulB; break;
+        default: ulResult = ulA & ulB; break;
+      }
+      break;
+    }
+    case 0x0FU:                                         /* fence, fence.i     */
+      iWrite = 0;
+      break;
+    case 0x73U:                                         /* system             */
+    {
+      uint32_t ulCsr = ins >> 20, ulOld, ulSrc = (ulF3 & 4U) ? ulRs1 : ulA;
+
+      if (ulF3 == 0U)
+      {
+        iWrite = 0;
+        switch (ins)
+        {
+          case 0x00000073UL:                            /* ecall              */
+            if (xSim.ulDepth >= SIM_LEVELS) goto illegal;
+            ulAddr = xSim.ulPc;
+            if (prvEnter(ECALL_IRQN, ECALL_CAUSE, ulAddr) != 0) goto fault;
+            xSim.ulNextPc = xSim.ulPc;
+            xSim.ulPc = ulAddr;
+            break;
+          case 0x00100073UL:                            /* ebreak             */
+            prvStop("ebreak", 0);
+            break;
+          case 0x30200073UL:                            /* mret               */
+            prvReturn();
+            break;
+          case 0x10500073UL:                            /* wfi                */
+            prvSleep();
+            break;
+          default:
+            goto illegal;
+        }
+        break;
+      }
+      if ((ulF3 == 4U) || (prvCsrRead(ulCsr, &ulOld) != 0)) goto illegal;
+      switch (ulF3 & 3U)
+      {
+        case 1U: if (prvCsrWrite(ulCsr, ulSrc) != 0) goto illegal; break;
+        case 2U: if ((ulRs1 != 0U) && (prvCsrWrite(ulCsr, ulOld | ulSrc) != 0)) goto illegal; break;
+        default: if ((ulRs1 != 0U) && (prvCsrWrite(ulCsr, ulOld & ~ulSrc) != 0)) goto illegal; break;
+      }
+      ulResult = ulOld;
+      break;
+    }
+    default:
+      goto illegal;
+  }
+
+  if (iWrite && (ulRd != 0U)) xSim.x[ulRd] = ulResult;
+  return;
+
+illegal:
+  prvStop("illegal instruction", 1);
+  return;
+fault:
+  prvStop("access fault", 1);
+}
+
+/*!****************************************************************************
+ * @brief
+ * Fetch and execute one instruction, charging it to its symbol
+ *
+ * @date  16.10.2026
+ ******************************************************************************/
+static void prvStep(void)
+{
+  Sym_t* pxSym = prvSymAt(xSim.ulPc);
+  uint32_t ulLo, ulHi, ulIns, ulLen = 2U;
+
+  if ((!prvIsFlash(xSim.ulPc) && (xSim.ulPc - SIM_SRAM_BASE >= xSim.ulSramSize)) ||
+      (prvLoad(xSim.ulPc, 2U, &ulLo) != 0))
+  {
+    prvStop("instruction fetch fault", 1);
+    return;
+  }
+  if ((ulLo & 3U) == 3U)
+  {
+    if (prvLoad(xSim.ulPc + 2U, 2U, &ulHi) != 0)
+    {
+      prvStop("instruction fetch fault", 1);
+      return;
+    }
+    ulIns = ulLo | (ulHi << 16);
+    ulLen = 4U;
+  }
+  else
+  {
+    ulIns = prvExpand(ulLo);
+  }
+
+  xSim.ulCost = 1U;
+  prvExecute(ulIns, ulLen);
+  if (xSim.pcStop != NULL) return;
+
+  xSim.ulPc = xSim.ulNextPc;
+  ++xSim.ullInstret;
+  ++pxSym->ullInstr;
+  pxSym->ullCycles += xSim.ulCost;
+  prvAdvance(xSim.ulCost);
+}
+
+/*!****************************************************************************
+ * @brief
+ * Print run summary and per-interrupt / per-symbol tables
+ *
+ * @date  16.10.2026
+ ******************************************************************************/
+static void prvReport(void)
+{
+  Sym_t** ppxSorted = malloc((ulSyms + 1U) * sizeof(Sym_t*));
+  uint32_t ulCount = 0;
+
+  printf("stop        %s at 0x%08x (%s)\n", xSim.pcStop, xSim.ulPc, prvSymAt(xSim.ulPc)->pcName);
+  printf("instr       %llu\n", (unsigned long long)xSim.ullInstret);
+  printf("cycles      %llu (%llu taken branches x%u, %llu flash loads x%u wait)\n",
+         (unsigned long long)xSim.ullCycle, (unsigned long long)xSim.ullBranches, ulPenalty,
+         (unsigned long long)xSim.ullFlashLoads, ulWait);
+  printf("sleep       %llu\n", (unsigned long long)xSim.ullSleep);
+
+  for (uint32_t i = 0; i < 256U; ++i)
+  {
+    const Irq_Stats_t* pxIrq = &xSim.axIrq[i];
+    if (pxIrq->ullCount == 0U) continue;
+    if (ulCount++ == 0U)
+    {
+      printf("\n%-5s %10s %10s %10s %12s %10s\n", "IRQn", "count", "min", "max", "mean", "max-lat");
+    }
+    printf("%-5u %10llu %10llu %10llu %12.1f %10llu\n", i, (unsigned long long)pxIrq->ullCount,
+           (unsigned long long)pxIrq->ullMin, (unsigned long long)pxIrq->ullMax,
+           (double)pxIrq->ullCycles / (double)pxIrq->ullCount, (unsigned long long)pxIrq->ullLatMax);
+  }
+
+  ulCount = 0;
+  for (uint32_t i = 0; i < ulSyms; ++i)
+  {
+    if (axSym[i].ullCycles != 0U) ppxSorted[ulCount++] = &axSym[i];
+  }
+  if (xUnknown.ullCycles != 0U) ppxSorted[ulCount++] = &xUnknown;
+  qsort(ppxSorted, ulCount, sizeof(Sym_t*), prvSymCompareCycles);
+
+  printf("\n%-32s %8s %10s %10s %6s\n", "symbol", "calls", "instr", "cycles", "%");
+  for (uint32_t i = 0; i < ulCount; ++i)
+  {
+    printf("%-32s %8llu %10llu %10llu %6.2f\n", ppxSorted[i]->pcName,
+           (unsigned long long)ppxSorted[i]->ullCalls, (unsigned long long)ppxSorted[i]->ullInstr,
+           (unsigned long long)ppxSorted[i]->ullCycles,
+           (xSim.ullCycle != 0U) ? (100.0 * (double)ppxSorted[i]->ullCycles / (double)xSim.ullCycle) : 0.0);
+  }
+  free(ppxSorted);
+}
+
+int main(int argc, char** argv)
+{
+  const char* pcStopSym = NULL;
+  const char* apcSkip[SIM_SKIP_MAX];
+  uint32_t aulSkip[SIM_SKIP_MAX];
+  uint32_t ulSkips = 0, ulStopAddr = 0;
+  uint64_t ullLimit = 100000000ULL, ullGate = 0;
+  uint8_t* pucElf;
+  size_t xSize;
+  int iOpt;
+
+  xSim.ulFlashSize = 16384U;
+  xSim.ulSramSize = 2048U;
+  for (iOpt = 1; (iOpt + 1 < argc) && (argv[iOpt][0] == '-'); iOpt += 2)
+  {
+    const char* pcArg = argv[iOpt + 1];
+    switch (argv[iOpt][1])
+    {
+      case 's': pcStopSym = pcArg; break;
+      case 'k':
+        if (ulSkips < SIM_SKIP_MAX) apcSkip[ulSkips++] = pcArg;
+        break;
+      case 'i':
+        if ((ulInjects < SIM_INJECT_MAX) && (strchr(pcArg, '@') != NULL))
+        {
+          axInject[ulInjects].ucIRQn = (uint8_t)strtoul(pcArg, NULL, 0);
+          axInject[ulInjects].ullTime = strtoull(strchr(pcArg, '@') + 1, NULL, 0);
+          ++ulInjects;
+        }
+        break;
+      case 'n': ullLimit = strtoull(pcArg, NULL, 0); break;
+      case 'w': ulWait = (uint32_t)strtoul(pcArg, NULL, 0); break;
+      case 'b': ulPenalty = (uint32_t)strtoul(pcArg, NULL, 0); break;
+      case 'f': xSim.ulFlashSize = (uint32_t)strtoul(pcArg, NULL, 0); break;
+      case 'r': xSim.ulSramSize = (uint32_t)strtoul(pcArg, NULL, 0); break;
+      case 'g': ullGate = strtoull(pcArg, NULL, 0); break;
+      default: iOpt = argc; break;
+    }
+  }
+  if (iOpt + 1 != argc)
+  {
+    fprintf(stderr, "usage: %s [-s stop] [-k skip] [-i IRQn@cycle] [-n limit] [-w waitstates] "
+                    "[-b penalty] [-f flash] [-r sram] [-g maxcycles] <firmware.elf>\n", argv[0]);
+    return 2;
+  }
+
+  pucElf = prvReadFile(argv[iOpt], &xSize);
+  if ((pucElf == NULL) || (xSize < 0x34U) || (memcmp(pucElf, "\177ELF\1\1", 6) != 0) ||
+      (prvRd16(pucElf + 0x12) != 243U))
+  {
+    fprintf(stderr, "%s: not a 32-bit little-endian RISC-V ELF file\n", argv[iOpt]);
+    return 1;
+  }
+  xSim.pucFlash = calloc(xSim.ulFlashSize, 1);
+  xSim.pucSram = calloc(xSim.ulSramSize, 1);
+  xSim.pucPeriph = calloc(SIM_PERIPH_SIZE, 1);
+  if ((xSim.pucFlash == NULL) || (xSim.pucSram == NULL) || (xSim.pucPeriph == NULL) ||
+      (prvLoadSegments(pucElf, xSize) != 0))
+  {
+    return 1;
+  }
+  prvLoadSymbols(pucElf, xSize);
+
+  if (pcStopSym != NULL)
+  {
+    Sym_t* pxSym = prvSymByName(pcStopSym);
+    if (pxSym == NULL)
+    {
+      fprintf(stderr, "%s: symbol not found\n", pcStopSym);
+      return 1;
+    }
+    ulStopAddr = pxSym->ulAddr;
+  }
+  for (uint32_t i = 0; i < ulSkips; ++i)
+  {
+    Sym_t* pxSym = prvSymByName(apcSkip[i]);
+    if (pxSym == NULL)
+    {
+      fprintf(stderr, "%s: symbol not found\n", apcSkip[i]);
+      return 1;
+    }
+    aulSkip[i] = pxSym->ulAddr;
+  }
+
+  /* Reset state                                                              */
+  xSim.ulMstatus = MSTATUS_MPP;
+  xSim.ulPc = 0;
+
+  while (xSim.pcStop == NULL)
+  {
+    int iIRQn;
+
+    if (xSim.ullInstret >= ullLimit)
+    {
+      prvStop("instruction limit", 0);
+      break;
+    }
+    prvPoll();
+    iIRQn = prvSelectIrq();
+    if ((iIRQn >= 0) && (prvEnter((uint32_t)iIRQn, 0x80000000UL | (uint32_t)iIRQn, xSim.ulPc) != 0))
+    {
+      prvStop("vector fetch fault", 1);
+      break;
+    }
+    if ((pcStopSym != NULL) && (xSim.ulPc == ulStopAddr))
+    {
+      prvStop(pcStopSym, 0);
+      break;
+    }
+    for (uint32_t i = 0; i < ulSkips; ++i)
+    {
+      if (xSim.ulPc == aulSkip[i])
+      {
+        xSim.ulPc = xSim.x[1];
+        iIRQn = -2;
+        break;
+      }
+    }
+    if (iIRQn != -2) prvStep();
+  }
+
+  prvReport();
+  free(pucElf);
+  if ((ullGate != 0U) && (xSim.ullCycle > ullGate))
+  {
+    fprintf(stderr, "gate: %llu cycles exceed %llu\n", (unsigned long long)xSim.ullCycle,
+            (unsigned long long)ullGate);
+    return 3;
+  }
+  return xSim.iExit;
+}